@@ -56,6 +56,8 @@ void add_node_options(CLI::App& cli, node::Settings& settings) {
         cli, "--etl.buffersize", settings.etl_buffer_size,
         64_Mebi, 1_Gibi,
         "Buffer size for ETL operations");
+    cli.add_flag("--etl.compress", settings.etl_compress_files,
+                 "Compress ETL temporary files to reduce disk footprint");
 
     cli.add_option("--sync.loop.throttle", settings.sync_loop_throttle_seconds,
                    "Sets the minimum delay between sync loop starts (in seconds)")
@@ -69,6 +71,15 @@ void add_node_options(CLI::App& cli, node::Settings& settings) {
 
     cli.add_flag("--fakepow", settings.fake_pow, "Disables proof-of-work verification");
 
+    cli.add_flag("--execution.parallel", settings.parallel_execution_enabled,
+                 "Executes block transactions speculatively in parallel (experimental)");
+    cli.add_option("--execution.prefetch.blocks", settings.state_prefetch_blocks,
+                   "Number of upcoming blocks whose state is prefetched during execution (0 to disable)")
+        ->capture_default_str()
+        ->check(CLI::Range(0u, 1024u));
+    cli.add_flag("--execution.buffer.arena", settings.arena_state_buffer_enabled,
+                 "Buffers execution state in arena storage with exact memory accounting against --batchsize");
+
     add_option_private_api_address(cli, settings.server_settings.address_uri);
     add_option_remote_sentry_addresses(cli, settings.remote_sentry_addresses, /*is_required=*/false);
 
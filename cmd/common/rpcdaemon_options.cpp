@@ -143,6 +143,14 @@ void add_rpcdaemon_options(CLI::App& cli, silkworm::rpc::DaemonSettings& setting
     cli.add_flag("--http-compression", settings.http_compression)
         ->description("Enable compression on HTTP protocol for Execution Layer and Engine JSON RPC API")
         ->capture_default_str();
+
+    cli.add_flag("--sharded-state-cache", settings.sharded_state_cache)
+        ->description("Enable the state cache split in shards with independent locks, suited to high request rates")
+        ->capture_default_str();
+
+    cli.add_option("--historical-state-cache-size", settings.historical_state_cache_size)
+        ->description("Max number of historical state values cached across requests for past blocks (0 disables it)")
+        ->capture_default_str();
 }
 
 }  // namespace silkworm::cmd::common
@@ -16,6 +16,10 @@
 
 #include "snapshot_options.hpp"
 
+#include <silkworm/core/common/base.hpp>
+
+#include "human_size_option.hpp"
+
 namespace silkworm::cmd::common {
 
 void add_snapshot_options(CLI::App& cli, snapshots::SnapshotSettings& snapshot_settings) {
@@ -28,6 +32,24 @@ void add_snapshot_options(CLI::App& cli, snapshots::SnapshotSettings& snapshot_s
     cli.add_option("--snapshots.repository.path", snapshot_settings.repository_dir)
         ->description("Filesystem path where snapshots will be stored")
         ->capture_default_str();
+    add_option_human_size(
+        cli, "--snapshots.index.memory_budget", snapshot_settings.index_build_memory_budget,
+        256_Mebi, 1_Tebi,
+        "Memory shared by the snapshot indexes built concurrently, keys beyond it are spilled to disk");
+    add_option_human_size(
+        cli, "--snapshots.word_cache.size", snapshot_settings.word_cache_size,
+        0, 64_Gibi,
+        "Memory for the cache of snapshot words decoded by random reads, 0 to disable it");
+    add_option_human_size(
+        cli, "--snapshots.index.hugepage_max_size", snapshot_settings.index_huge_page_max_size,
+        0, 1_Gibi,
+        "Max size of the header and body indexes copied in memory backed by huge pages, 0 to disable it");
+    cli.add_flag("--snapshots.verify.content", snapshot_settings.verify_content)
+        ->description("If set, opening snapshots also decodes their whole content to verify it")
+        ->capture_default_str();
+    cli.add_flag("--snapshots.verify.lazy", snapshot_settings.lazy_verification)
+        ->description("If set, just the newest snapshots are verified on startup and the others in background")
+        ->capture_default_str();
 
     // TODO(canepat) add options for the other snapshot settings and for all bittorrent settings
     cli.add_option("--torrent.verify_on_startup", snapshot_settings.bittorrent_settings.verify_on_startup)
@@ -42,6 +42,7 @@
 #include <silkworm/core/types/block_body_for_storage.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/db/genesis.hpp>
+#include <silkworm/db/log_summary.hpp>
 #include <silkworm/db/mdbx/mdbx.hpp>
 #include <silkworm/db/prune_mode.hpp>
 #include <silkworm/db/stages.hpp>
@@ -2000,6 +2001,62 @@ void do_trie_root(db::EnvConfig& config) {
     }
 }
 
+void do_log_summary_backfill(db::EnvConfig& config, BlockNum from) {
+    if (!config.exclusive) {
+        throw std::runtime_error("Function requires exclusive access to database");
+    }
+
+    static constexpr BlockNum kBlocksPerCommit{100'000};
+
+    auto env{silkworm::db::open_env(config)};
+    db::RWTxnManaged txn{env};
+
+    // Summaries are derived from TransactionLog up to the LogIndex stage height, later blocks are handled by the stage
+    const auto to{db::stages::read_stage_progress(txn, db::stages::kLogIndexKey)};
+    SILK_INFO << "Backfilling ..." << log::Args{"table", db::table::kLogSummary.name, "from", std::to_string(from), "to", std::to_string(to)};
+
+    StopWatch sw(/*auto_start=*/true);
+    size_t written_summaries{0};
+    for (BlockNum batch_start{from}; batch_start <= to; batch_start += kBlocksPerCommit) {
+        const BlockNum batch_end{std::min(to, batch_start + kBlocksPerCommit - 1)};
+        {
+            db::PooledCursor source(*txn, db::table::kLogs);
+            db::PooledCursor target(*txn, db::table::kLogSummary);
+            Bytes block_summary;
+            BlockNum block_number{batch_start};
+            uint32_t block_log_count{0};
+            const auto flush_block_summary = [&]() {
+                if (!block_summary.empty()) {
+                    target.upsert(db::to_slice(db::block_key(block_number)), db::to_slice(block_summary));
+                    block_summary.clear();
+                    ++written_summaries;
+                }
+            };
+
+            auto data{source.lower_bound(db::to_slice(db::block_key(batch_start)), /*throw_notfound=*/false)};
+            while (data) {
+                const auto reached_block_number{endian::load_big_u64(static_cast<uint8_t*>(data.key.data()))};
+                if (reached_block_number > batch_end) break;
+                if (reached_block_number != block_number) {
+                    flush_block_summary();
+                    block_number = reached_block_number;
+                    block_log_count = 0;
+                }
+                const auto tx_index{endian::load_big_u32(static_cast<uint8_t*>(data.key.data()) + sizeof(BlockNum))};
+                block_log_count += static_cast<uint32_t>(append_log_summary(db::from_slice(data.value), tx_index, block_log_count, block_summary));
+                data = source.to_next(/*throw_notfound=*/false);
+            }
+            flush_block_summary();
+        }
+
+        txn.commit_and_renew();
+        SILK_INFO << "Backfilled" << log::Args{"height", std::to_string(batch_end), "summaries", std::to_string(written_summaries), "in", StopWatch::format(sw.since_start())};
+        if (SignalHandler::signalled()) throw std::runtime_error("Aborted");
+    }
+    SILK_INFO << "Closing db" << log::Args{"path", env.get_path().string()};
+    env.close();
+}
+
 void do_reset_to_download(db::EnvConfig& config, bool keep_senders) {
     if (!config.exclusive) {
         throw std::runtime_error("Function requires exclusive access to database");
@@ -2036,6 +2093,9 @@ void do_reset_to_download(db::EnvConfig& config, bool keep_senders) {
     SILK_INFO << db::stages::kLogIndexKey << log::Args{"table", db::table::kLogTopicIndex.name} << " truncating ...";
     source.bind(*txn, db::table::kLogTopicIndex);
     txn->clear_map(source.map());
+    SILK_INFO << db::stages::kLogIndexKey << log::Args{"table", db::table::kLogSummary.name} << " truncating ...";
+    source.bind(*txn, db::table::kLogSummary);
+    txn->clear_map(source.map());
     SILK_INFO << db::stages::kLogIndexKey << log::Args{"table", db::table::kLogAddressIndex.name} << " truncating ...";
     source.bind(*txn, db::table::kLogAddressIndex);
     txn->clear_map(source.map());
@@ -2327,6 +2387,13 @@ int main(int argc, char* argv[]) {
     auto cmd_reset_to_download_keep_senders_opt =
         cmd_reset_to_download->add_flag("--keep-senders", "Keep the recovered transaction senders");
 
+    // Log summary backfill
+    // Builds the per-block log summaries for blocks already indexed before LogSummary table was introduced
+    auto cmd_log_summary_backfill =
+        app_main.add_subcommand("log-summary-backfill", "Build log summaries for blocks already processed by LogIndex stage");
+    auto cmd_log_summary_backfill_from_opt =
+        cmd_log_summary_backfill->add_option("--from", "Initial block number")->default_val(0)->check(CLI::Range(0u, UINT32_MAX));
+
     /*
      * Parse arguments and validate
      */
@@ -2432,6 +2499,8 @@ int main(int argc, char* argv[]) {
             do_trie_root(src_config);
         } else if (*cmd_reset_to_download) {
             do_reset_to_download(src_config, static_cast<bool>(*cmd_reset_to_download_keep_senders_opt));
+        } else if (*cmd_log_summary_backfill) {
+            do_log_summary_backfill(src_config, cmd_log_summary_backfill_from_opt->as<BlockNum>());
         }
 
         return 0;
@@ -39,6 +39,7 @@
 #include <silkworm/db/headers/header_index.hpp>
 #include <silkworm/db/snapshot_bundle_factory_impl.hpp>
 #include <silkworm/db/snapshots/index.hpp>
+#include <silkworm/db/snapshots/index_build_scheduler.hpp>
 #include <silkworm/db/snapshots/index_builder.hpp>
 #include <silkworm/db/snapshots/snapshot_reader.hpp>
 #include <silkworm/db/stages.hpp>
@@ -49,7 +50,6 @@
 #include <silkworm/infra/common/stopwatch.hpp>
 #include <silkworm/infra/concurrency/context_pool_settings.hpp>
 #include <silkworm/infra/concurrency/signal_handler.hpp>
-#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 #include "common.hpp"
 #include "instance.hpp"
@@ -230,8 +230,6 @@ SILKWORM_EXPORT int silkworm_init(SilkwormHandle* handle, const struct SilkwormS
 }
 
 SILKWORM_EXPORT int silkworm_build_recsplit_indexes(SilkwormHandle handle, struct SilkwormMemoryMappedFile* snapshots[], size_t len) SILKWORM_NOEXCEPT {
-    const int kNeededIndexesToBuildInParallel = 2;
-
     if (!handle) {
         return SILKWORM_INVALID_HANDLE;
     }
@@ -286,36 +284,12 @@ SILKWORM_EXPORT int silkworm_build_recsplit_indexes(SilkwormHandle handle, struc
         }
     }
 
-    if (needed_indexes.size() < kNeededIndexesToBuildInParallel) {
-        // sequential build
-        for (const auto& index : needed_indexes) {
-            index->build();
-        }
-    } else {
-        // parallel build
-        ThreadPool workers;
-
-        // Create worker tasks for missing indexes
-        for (const auto& index : needed_indexes) {
-            workers.push_task([=]() {
-                try {
-                    SILK_INFO << "Build index: " << index->path().filename() << " start";
-                    index->build();
-                    SILK_INFO << "Build index: " << index->path().filename() << " end";
-                } catch (const std::exception& ex) {
-                    SILK_CRIT << "Build index: " << index->path().filename() << " failed [" << ex.what() << "]";
-                }
-            });
-        }
-
-        // Wait for all missing indexes to be built or stop request
-        while (workers.get_tasks_total()) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-        }
-
-        // Wait for any already-started-but-unfinished work in case of stop request
-        workers.pause();
-        workers.wait_for_tasks();
+    try {
+        const snapshots::IndexBuildScheduler scheduler;
+        scheduler.build(std::move(needed_indexes));
+    } catch (const std::exception&) {
+        // Failures are already logged by the scheduler, which anyway completes all other builds
+        return SILKWORM_INTERNAL_ERROR;
     }
 
     return SILKWORM_OK;
@@ -33,6 +33,49 @@ ExecutionProcessor::ExecutionProcessor(const Block& block, protocol::RuleSet& ru
 void ExecutionProcessor::execute_transaction(const Transaction& txn, Receipt& receipt) noexcept {
     assert(protocol::validate_transaction(txn, state_, available_gas()) == ValidationResult::kOk);
 
+    const std::optional<evmc::address> sender{txn.sender()};
+    assert(sender);
+
+    const intx::uint256 sender_initial_balance{state_.get_balance(*sender)};
+    const intx::uint256 recipient_initial_balance{state_.get_balance(evm_.beneficiary)};
+
+    const uint64_t gas_used{run_transaction(txn, receipt)};
+
+    credit_fees(txn, gas_used, sender_initial_balance, recipient_initial_balance);
+
+    complete_transaction(gas_used, receipt);
+}
+
+uint64_t ExecutionProcessor::execute_transaction_without_fees(const Transaction& txn, Receipt& receipt) noexcept {
+    const uint64_t gas_used{run_transaction(txn, receipt)};
+
+    complete_transaction(gas_used, receipt);
+
+    return gas_used;
+}
+
+void ExecutionProcessor::apply_transaction(const Transaction& txn, const IntraBlockState& tx_state, uint64_t gas_used,
+                                           Receipt& receipt) {
+    const std::optional<evmc::address> sender{txn.sender()};
+    assert(sender);
+
+    // The transaction did not read any modified account, so here we still have the values at transaction start
+    const intx::uint256 sender_initial_balance{state_.get_balance(*sender)};
+    const intx::uint256 recipient_initial_balance{state_.get_balance(evm_.beneficiary)};
+
+    state_.clear_journal_and_substate();
+
+    // Move the transaction logs into the state, so that fee transfer logs (if any) are appended to them
+    std::swap(receipt.logs, state_.logs());
+
+    state_.apply_transaction_changes(tx_state);
+
+    credit_fees(txn, gas_used, sender_initial_balance, recipient_initial_balance);
+
+    complete_transaction(gas_used, receipt);
+}
+
+uint64_t ExecutionProcessor::run_transaction(const Transaction& txn, Receipt& receipt) noexcept {
     // Optimization: since receipt.logs might have some capacity, let's reuse it.
     std::swap(receipt.logs, state_.logs());
 
@@ -63,9 +106,6 @@ void ExecutionProcessor::execute_transaction(const Transaction& txn, Receipt& re
 
     const BlockHeader& header{evm_.block().header};
 
-    const intx::uint256 sender_initial_balance{state_.get_balance(*sender)};
-    const intx::uint256 recipient_initial_balance{state_.get_balance(evm_.beneficiary)};
-
     // EIP-1559 normal gas cost
     const intx::uint256 base_fee_per_gas{header.base_fee_per_gas.value_or(0)};
     const intx::uint256 effective_gas_price{txn.effective_gas_price(base_fee_per_gas)};
@@ -80,7 +120,18 @@ void ExecutionProcessor::execute_transaction(const Transaction& txn, Receipt& re
 
     const CallResult vm_res{evm_.execute(txn, txn.gas_limit - static_cast<uint64_t>(g0))};
 
-    const uint64_t gas_used{txn.gas_limit - refund_gas(txn, vm_res.gas_left, vm_res.gas_refund)};
+    receipt.type = txn.type;
+    receipt.success = vm_res.status == EVMC_SUCCESS;
+
+    return txn.gas_limit - refund_gas(txn, vm_res.gas_left, vm_res.gas_refund);
+}
+
+void ExecutionProcessor::credit_fees(const Transaction& txn, uint64_t gas_used,
+                                     const intx::uint256& sender_initial_balance,
+                                     const intx::uint256& recipient_initial_balance) {
+    const evmc_revision rev{evm_.revision()};
+    const BlockHeader& header{evm_.block().header};
+    const intx::uint256 base_fee_per_gas{header.base_fee_per_gas.value_or(0)};
 
     // award the fee recipient
     const intx::uint256 amount{txn.priority_fee_per_gas(base_fee_per_gas) * gas_used};
@@ -95,15 +146,15 @@ void ExecutionProcessor::execute_transaction(const Transaction& txn, Receipt& re
         }
     }
 
-    rule_set_.add_fee_transfer_log(state_, amount, *sender, sender_initial_balance,
+    rule_set_.add_fee_transfer_log(state_, amount, *txn.sender(), sender_initial_balance,
                                    evm_.beneficiary, recipient_initial_balance);
+}
 
-    state_.finalize_transaction(rev);
+void ExecutionProcessor::complete_transaction(uint64_t gas_used, Receipt& receipt) {
+    state_.finalize_transaction(evm_.revision());
 
     cumulative_gas_used_ += gas_used;
 
-    receipt.type = txn.type;
-    receipt.success = vm_res.status == EVMC_SUCCESS;
     receipt.cumulative_gas_used = cumulative_gas_used_;
     receipt.bloom = logs_bloom(state_.logs());
     std::swap(receipt.logs, state_.logs());
@@ -129,7 +180,8 @@ uint64_t ExecutionProcessor::refund_gas(const Transaction& txn, uint64_t gas_lef
     return gas_left;
 }
 
-ValidationResult ExecutionProcessor::execute_block_no_post_validation(std::vector<Receipt>& receipts) noexcept {
+ValidationResult ExecutionProcessor::execute_block_no_post_validation(std::vector<Receipt>& receipts,
+                                                                      SpeculativeTransactions* speculative) noexcept {
     const evmc_revision rev{evm_.revision()};
     rule_set_.initialize(evm_);
     state_.finalize_transaction(rev);
@@ -140,14 +192,15 @@ ValidationResult ExecutionProcessor::execute_block_no_post_validation(std::vecto
     notify_block_execution_start(block);
 
     receipts.resize(block.transactions.size());
-    auto receipt_it{receipts.begin()};
-    for (const auto& txn : block.transactions) {
+    for (size_t i{0}; i < block.transactions.size(); ++i) {
+        const Transaction& txn{block.transactions[i]};
         const ValidationResult err{protocol::validate_transaction(txn, state_, available_gas())};
         if (err != ValidationResult::kOk) {
             return err;
         }
-        execute_transaction(txn, *receipt_it);
-        ++receipt_it;
+        if (!speculative || !speculative->try_apply(i, *this, receipts[i])) {
+            execute_transaction(txn, receipts[i]);
+        }
     }
 
     state_.clear_journal_and_substate();
@@ -159,8 +212,9 @@ ValidationResult ExecutionProcessor::execute_block_no_post_validation(std::vecto
     return ValidationResult::kOk;
 }
 
-ValidationResult ExecutionProcessor::execute_block(std::vector<Receipt>& receipts) noexcept {
-    if (const ValidationResult res{execute_block_no_post_validation(receipts)}; res != ValidationResult::kOk) {
+ValidationResult ExecutionProcessor::execute_block(std::vector<Receipt>& receipts,
+                                                   SpeculativeTransactions* speculative) noexcept {
+    if (const ValidationResult res{execute_block_no_post_validation(receipts, speculative)}; res != ValidationResult::kOk) {
         return res;
     }
 
@@ -28,6 +28,18 @@
 
 namespace silkworm {
 
+class ExecutionProcessor;
+
+//! \brief Source of block transactions executed speculatively outside the block processor (e.g. in parallel)
+class SpeculativeTransactions {
+  public:
+    virtual ~SpeculativeTransactions() = default;
+
+    //! \brief Apply the speculative outcome of the i-th block transaction to the processor, if still valid
+    //! \return true if the transaction has been applied, false if it must be executed by the processor
+    virtual bool try_apply(size_t index, ExecutionProcessor& processor, Receipt& receipt) noexcept = 0;
+};
+
 class ExecutionProcessor {
   public:
     ExecutionProcessor(const ExecutionProcessor&) = delete;
@@ -41,10 +53,23 @@ class ExecutionProcessor {
      */
     void execute_transaction(const Transaction& txn, Receipt& receipt) noexcept;
 
+    //! \brief Execute a transaction w/o crediting the fees to the block beneficiary (and burnt contract, if any).
+    //! \return the gas used by the transaction
+    //! \remarks Used for speculative execution: fees are credited when the result is applied by apply_transaction.
+    //! \pre Transaction must be valid.
+    uint64_t execute_transaction_without_fees(const Transaction& txn, Receipt& receipt) noexcept;
+
+    //! \brief Apply a transaction executed by execute_transaction_without_fees on another processor.
+    //! \pre The transaction must not have read any account or storage location modified in this block so far.
+    void apply_transaction(const Transaction& txn, const IntraBlockState& tx_state, uint64_t gas_used,
+                           Receipt& receipt);
+
     //! \brief Execute the block.
+    //! \param speculative: optional source of speculatively executed transactions to apply instead of executing them
     //! \remarks Warning: This method does not verify state root; pre-Byzantium receipt root isn't validated either.
     //! \pre RuleSet's validate_block_header & pre_validate_block_body must return kOk.
-    [[nodiscard]] ValidationResult execute_block(std::vector<Receipt>& receipts) noexcept;
+    [[nodiscard]] ValidationResult execute_block(std::vector<Receipt>& receipts,
+                                                 SpeculativeTransactions* speculative = nullptr) noexcept;
 
     //! \brief Flush IntraBlockState into cumulative State.
     void flush_state();
@@ -60,7 +85,18 @@ class ExecutionProcessor {
      * Does not perform any post-execution validation (for example, receipt root is not checked).
      * Precondition: validate_block_header & pre_validate_block_body must return kOk.
      */
-    [[nodiscard]] ValidationResult execute_block_no_post_validation(std::vector<Receipt>& receipts) noexcept;
+    [[nodiscard]] ValidationResult execute_block_no_post_validation(std::vector<Receipt>& receipts,
+                                                                    SpeculativeTransactions* speculative) noexcept;
+
+    //! \brief Run the transaction up to the sender refund, returning the gas used.
+    uint64_t run_transaction(const Transaction& txn, Receipt& receipt) noexcept;
+
+    //! \brief Credit the transaction fees to the block beneficiary (and burnt contract, if any).
+    void credit_fees(const Transaction& txn, uint64_t gas_used, const intx::uint256& sender_initial_balance,
+                     const intx::uint256& recipient_initial_balance);
+
+    //! \brief Finalize the transaction in the block state and complete its receipt.
+    void complete_transaction(uint64_t gas_used, Receipt& receipt);
 
     //! \brief Notify the registered tracers at the start of block execution.
     void notify_block_execution_start(const Block& block);
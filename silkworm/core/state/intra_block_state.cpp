@@ -356,6 +356,57 @@ void IntraBlockState::write_to_db(uint64_t block_number) {
     }
 }
 
+bool IntraBlockState::is_account_modified(const evmc::address& address) const noexcept {
+    auto it{objects_.find(address)};
+    if (it == objects_.end()) {
+        return false;
+    }
+    const state::Object& obj{it->second};
+    // Objects w/o initial value have been created within the block, even if later destructed
+    return !obj.initial || obj.current != obj.initial;
+}
+
+bool IntraBlockState::is_storage_modified(const evmc::address& address, const evmc::bytes32& key) const noexcept {
+    auto it1{storage_.find(address)};
+    if (it1 == storage_.end()) {
+        return false;
+    }
+    auto it2{it1->second.committed.find(key)};
+    return it2 != it1->second.committed.end() && it2->second.original != it2->second.initial;
+}
+
+void IntraBlockState::apply_transaction_changes(const IntraBlockState& tx_state) {
+    for (const auto& [address, obj] : tx_state.objects_) {
+        auto [it, inserted]{objects_.try_emplace(address, obj)};
+        if (!inserted) {
+            it->second.current = obj.current;
+        }
+
+        // Account destruction and contract creation both wipe out the storage
+        const bool storage_wiped{!obj.current || !obj.initial || obj.current->incarnation != obj.initial->incarnation};
+        if (storage_wiped) {
+            storage_.erase(address);
+        }
+    }
+
+    for (const auto& [address, tx_storage] : tx_state.storage_) {
+        state::Storage& storage{storage_[address]};
+        for (const auto& [key, val] : tx_storage.committed) {
+            auto [it, inserted]{storage.committed.try_emplace(key, val)};
+            if (!inserted) {
+                it->second.original = val.original;
+            }
+        }
+    }
+
+    for (const auto& [code_hash, code] : tx_state.new_code_) {
+        new_code_.try_emplace(code_hash, code);
+    }
+    for (const auto& [code_hash, code] : tx_state.existing_code_) {
+        existing_code_.try_emplace(code_hash, code);
+    }
+}
+
 IntraBlockState::Snapshot IntraBlockState::take_snapshot() const noexcept {
     IntraBlockState::Snapshot snapshot;
     snapshot.journal_size_ = journal_.size();
@@ -98,6 +98,17 @@ class IntraBlockState {
 
     void write_to_db(uint64_t block_number);
 
+    //! \brief Whether the account has been changed w.r.t. its value at the beginning of the block
+    bool is_account_modified(const evmc::address& address) const noexcept;
+
+    //! \brief Whether the storage location has been changed w.r.t. its value at the beginning of the block
+    //! \remarks Only committed values are considered, i.e. this must be called in between transactions
+    bool is_storage_modified(const evmc::address& address, const evmc::bytes32& key) const noexcept;
+
+    //! \brief Apply to this state the changes made by a single finalized transaction executed on another state
+    //! \pre Every account and storage location read by the transaction must be unmodified in this state
+    void apply_transaction_changes(const IntraBlockState& tx_state);
+
     Snapshot take_snapshot() const noexcept;
     void revert_to_snapshot(const Snapshot& snapshot) noexcept;
 
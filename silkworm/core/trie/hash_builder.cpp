@@ -113,9 +113,54 @@ void HashBuilder::finalize() {
         gen_struct_step(key_, {});
         key_.clear();
         value_ = Bytes{};
+    } else if (has_subtries_) {
+        close_root_branch();
     }
 }
 
+void HashBuilder::close_subtrie() {
+    if (key_.empty()) {
+        return;
+    }
+    // Any succeeding key with a different first nibble closes all the nodes below the root branch node while
+    // leaving the latter open: its group, masks and child reference are what add_subtrie needs
+    const Bytes succeeding(1, static_cast<uint8_t>(key_[0] ^ 1u));
+    gen_struct_step(key_, succeeding);
+    key_.clear();
+    value_ = Bytes{};
+}
+
+void HashBuilder::add_subtrie(HashBuilder& other) {
+    SILKWORM_ASSERT(key_.empty() && other.key_.empty());
+    if (other.stack_.empty()) {
+        return;
+    }
+    SILKWORM_ASSERT(other.stack_.size() == 1 && other.groups_.size() == 1);
+    SILKWORM_ASSERT(groups_.empty() || groups_[0] < other.groups_[0]);
+
+    groups_.resize(1);
+    tree_masks_.resize(1);
+    hash_masks_.resize(1);
+    groups_[0] |= other.groups_[0];
+    tree_masks_[0] |= other.tree_masks_[0];
+    hash_masks_[0] |= other.hash_masks_[0];
+    stack_.push_back(std::move(other.stack_.back()));
+    has_subtries_ = true;
+    other.reset();
+}
+
+void HashBuilder::close_root_branch() {
+    SILKWORM_ASSERT(std::popcount(groups_[0]) > 1);
+    std::vector<Bytes> child_hashes{branch_ref(groups_[0], hash_masks_[0])};
+    if (node_collector && (tree_masks_[0] || hash_masks_[0])) {
+        collect_branch_node({}, 0, child_hashes);
+    }
+    groups_.clear();
+    tree_masks_.clear();
+    hash_masks_.clear();
+    has_subtries_ = false;
+}
+
 evmc::bytes32 HashBuilder::root_hash() { return root_hash(/*auto_finalize=*/true); }
 
 evmc::bytes32 HashBuilder::root_hash(bool auto_finalize) {
@@ -224,17 +269,7 @@ void HashBuilder::gen_struct_step(ByteView current, const ByteView succeeding) {
                         tree_masks_[len - 1] |= 1u << current[len - 1];  // register myself in parent bitmap
                     }
 
-                    std::vector<evmc::bytes32> hashes(child_hashes.size());
-                    for (size_t i{0}; i < child_hashes.size(); ++i) {
-                        SILKWORM_ASSERT(child_hashes[i].size() == kHashLength + 1);
-                        std::memcpy(hashes[i].bytes, &child_hashes[i][1], kHashLength);
-                    }
-                    Node node{groups_[len], tree_masks_[len], hash_masks_[len], hashes};
-                    if (len == 0) {
-                        node.set_root_hash(root_hash(/*auto_finalize=*/false));
-                    }
-
-                    node_collector(current.substr(0, len), node);
+                    collect_branch_node(current.substr(0, len), len, child_hashes);
                 }
             }
         }
@@ -255,6 +290,20 @@ void HashBuilder::gen_struct_step(ByteView current, const ByteView succeeding) {
     }
 }
 
+void HashBuilder::collect_branch_node(ByteView nibbled_key, size_t len, const std::vector<Bytes>& child_hashes) {
+    std::vector<evmc::bytes32> hashes(child_hashes.size());
+    for (size_t i{0}; i < child_hashes.size(); ++i) {
+        SILKWORM_ASSERT(child_hashes[i].size() == kHashLength + 1);
+        std::memcpy(hashes[i].bytes, &child_hashes[i][1], kHashLength);
+    }
+    Node node{groups_[len], tree_masks_[len], hash_masks_[len], hashes};
+    if (len == 0) {
+        node.set_root_hash(root_hash(/*auto_finalize=*/false));
+    }
+
+    node_collector(nibbled_key, node);
+}
+
 // Takes children from the stack and replaces them with branch node ref.
 std::vector<Bytes> HashBuilder::branch_ref(uint16_t state_mask, uint16_t hash_mask) {
     SILKWORM_ASSERT(is_subset(hash_mask, state_mask));
@@ -301,6 +350,7 @@ void HashBuilder::reset() {
     key_.clear();
     value_ = Bytes();
     is_in_db_trie_ = false;
+    has_subtries_ = false;
     groups_.clear();
     tree_masks_.clear();
     hash_masks_.clear();
@@ -54,6 +54,17 @@ class HashBuilder {
     //! Nodes whose RLP is shorter than 32 bytes may not be added.
     void add_branch_node(Bytes nibbled_key, const evmc::bytes32& hash, bool is_in_db_trie = false);
 
+    //! \brief Closes all the nodes added so far below the root branch node, so that this builder can be appended to
+    //! another one by add_subtrie()
+    //! \remarks All the added keys must share the same first nibble
+    void close_subtrie();
+
+    //! \brief Appends the subtrie built by other (see close_subtrie()) as the next child of the root branch node
+    //! \details Subtries must be appended in increasing order of their first nibble and no entries may be added to
+    //! this builder. Root hash and collected nodes are the same as if all the entries of the subtries had been added
+    //! to this builder, provided at least two subtries are not empty
+    void add_subtrie(HashBuilder& other);
+
     //! \brief Returns the root hash computed on behalf of added entries
     //! \remarks If no entries in the stack_ the kEmptyRoot is returned
     evmc::bytes32 root_hash();
@@ -74,6 +85,10 @@ class HashBuilder {
 
     std::vector<Bytes> branch_ref(uint16_t state_mask, uint16_t hash_mask);
 
+    void collect_branch_node(ByteView nibbled_key, size_t len, const std::vector<Bytes>& child_hashes);
+
+    void close_root_branch();
+
     ByteView leaf_node_rlp(ByteView path, ByteView value);
 
     ByteView extension_node_rlp(ByteView path, ByteView child_ref);
@@ -81,6 +96,7 @@ class HashBuilder {
     Bytes key_;                                 // unpacked – one nibble per byte
     std::variant<Bytes, evmc::bytes32> value_;  // leaf value or node hash
     bool is_in_db_trie_{false};
+    bool has_subtries_{false};  // whether the root branch node is made of subtries (see add_subtrie)
 
     std::vector<uint16_t> groups_;
     std::vector<uint16_t> tree_masks_;
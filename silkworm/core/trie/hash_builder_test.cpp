@@ -14,12 +14,15 @@
    limitations under the License.
 */
 
+#include <algorithm>
 #include <iterator>
+#include <map>
 
 #include <catch2/catch_test_macros.hpp>
 #include <ethash/keccak.hpp>
 
 #include <silkworm/core/common/empty_hashes.hpp>
+#include <silkworm/core/common/endian.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/rlp/encode.hpp>
 #include <silkworm/core/trie/hash_builder.hpp>
@@ -199,4 +202,49 @@ TEST_CASE("Known root hash") {
     CHECK(to_hex(hb.root_hash()) == to_hex(root_hash.bytes));
 }
 
+TEST_CASE("Subtries stitched into root") {
+    using CollectedNodes = std::map<Bytes, Bytes>;
+    const auto collect_into{[](CollectedNodes& nodes) {
+        return [&nodes](ByteView nibbled_key, const Node& node) {
+            nodes.insert_or_assign(Bytes{nibbled_key}, node.encode_for_storage());
+        };
+    }};
+    const Bytes value(kHashLength, 0xab);
+
+    for (const uint64_t num_keys : {17u, 100u, 2'000u}) {
+        std::vector<Bytes> keys;
+        for (uint64_t i{0}; i < num_keys; ++i) {
+            Bytes seed(8, '\0');
+            endian::store_big_u64(seed.data(), i);
+            keys.push_back(unpack_nibbles(keccak256(seed).bytes));
+        }
+        std::sort(keys.begin(), keys.end());
+
+        CollectedNodes expected_nodes;
+        HashBuilder hb;
+        hb.node_collector = collect_into(expected_nodes);
+        for (const auto& key : keys) {
+            hb.add_leaf(key, value);
+        }
+        const evmc::bytes32 expected_root{hb.root_hash()};
+
+        CollectedNodes nodes;
+        HashBuilder root_hb;
+        root_hb.node_collector = collect_into(nodes);
+        auto it{keys.begin()};
+        for (uint8_t nibble{0}; nibble < 0x10; ++nibble) {
+            HashBuilder subtrie_hb;
+            subtrie_hb.node_collector = collect_into(nodes);
+            for (; it != keys.end() && it->front() == nibble; ++it) {
+                subtrie_hb.add_leaf(*it, value);
+            }
+            subtrie_hb.close_subtrie();
+            root_hb.add_subtrie(subtrie_hb);
+        }
+
+        CHECK(to_hex(root_hb.root_hash()) == to_hex(expected_root.bytes));
+        CHECK(nodes == expected_nodes);
+    }
+}
+
 }  // namespace silkworm::trie
@@ -78,6 +78,34 @@ std::pair<bool, ByteView> PrefixSet::contains_and_next_marked(ByteView prefix, s
     return {is_contained, next_created};
 }
 
+std::vector<std::pair<Bytes, size_t>> PrefixSet::count_by_prefix(size_t prefix_len) {
+    ensure_sorted();
+    std::vector<std::pair<Bytes, size_t>> ret;
+    for (const auto& [key, _] : keys_) {
+        if (key.length() < prefix_len) {
+            continue;
+        }
+        const ByteView key_prefix{key.data(), prefix_len};
+        if (ret.empty() || ByteView{ret.back().first} != key_prefix) {
+            ret.emplace_back(Bytes{key_prefix}, 0);
+        }
+        ++ret.back().second;
+    }
+    return ret;
+}
+
+PrefixSet PrefixSet::subset(ByteView prefix) {
+    ensure_sorted();
+    PrefixSet ret;
+    auto it{std::lower_bound(keys_.begin(), keys_.end(), prefix,
+                             [](const std::pair<Bytes, bool>& item, ByteView value) { return ByteView{item.first} < value; })};
+    for (; it != keys_.end() && it->first.starts_with(prefix); ++it) {
+        ret.keys_.push_back(*it);
+    }
+    ret.sorted_ = true;
+    return ret;
+}
+
 void PrefixSet::ensure_sorted() {
     if (!sorted_) {
         std::sort(keys_.begin(), keys_.end());
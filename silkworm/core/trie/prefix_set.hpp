@@ -52,6 +52,15 @@ class PrefixSet {
     //! of identical bytes
     std::pair<bool, ByteView> contains_and_next_marked(ByteView prefix, size_t invariant_prefix_len = 0);
 
+    //! \brief Returns the distinct prefixes of prefix_len bytes among the keys along with the number of keys sharing
+    //! each of them (keys shorter than prefix_len are skipped)
+    //! \remarks Not safe to call concurrently (see contains)
+    std::vector<std::pair<Bytes, size_t>> count_by_prefix(size_t prefix_len);
+
+    //! \brief Returns a new set made of the keys (and their markers) starting with provided prefix
+    //! \remarks Not safe to call concurrently (see contains)
+    PrefixSet subset(ByteView prefix);
+
     [[nodiscard]] size_t size() const { return keys_.size(); }
     [[nodiscard]] bool empty() const { return keys_.empty(); }
 
@@ -105,4 +105,31 @@ TEST_CASE("Prefix set - storage prefix") {
     }
 }
 
+TEST_CASE("Prefix set - split by prefix") {
+    PrefixSet ps;
+    ps.insert(string_view_to_byte_view("abc"));
+    ps.insert(string_view_to_byte_view("abd"), true);
+    ps.insert(string_view_to_byte_view("abc"));  // duplicate
+    ps.insert(string_view_to_byte_view("acx"));
+    ps.insert(string_view_to_byte_view("b"));
+    ps.insert(string_view_to_byte_view("a"));
+
+    const auto counts{ps.count_by_prefix(2)};
+    REQUIRE(counts.size() == 2);
+    CHECK(ByteView{counts[0].first} == string_view_to_byte_view("ab"));
+    CHECK(counts[0].second == 2);
+    CHECK(ByteView{counts[1].first} == string_view_to_byte_view("ac"));
+    CHECK(counts[1].second == 1);
+
+    PrefixSet subset{ps.subset(string_view_to_byte_view("ab"))};
+    CHECK(subset.size() == 2);
+    CHECK(subset.contains(string_view_to_byte_view("abc")));
+    CHECK(!subset.contains(string_view_to_byte_view("acx")));
+    auto [contains, next_created]{subset.contains_and_next_marked(string_view_to_byte_view("abc"))};
+    CHECK(contains);
+    CHECK(next_created == string_view_to_byte_view("abd"));
+
+    CHECK(ps.subset(string_view_to_byte_view("z")).empty());
+}
+
 }  // namespace silkworm::trie
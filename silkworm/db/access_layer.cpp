@@ -27,6 +27,7 @@
 #include <silkworm/db/headers/header_queries.hpp>
 #include <silkworm/db/mdbx/bitmap.hpp>
 #include <silkworm/db/receipt_cbor.hpp>
+#include <silkworm/db/receipts/receipt_queries.hpp>
 #include <silkworm/db/snapshots/repository.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/db/transactions/txn_queries.hpp>
@@ -1333,6 +1334,17 @@ std::optional<BlockBodyForStorage> DataModel::read_body_for_storage_from_snapsho
     return stored_body;
 }
 
+std::optional<snapshots::BlockReceiptsForStorage> DataModel::read_receipts_for_storage_from_snapshot(BlockNum height) {
+    if (!repository_) {
+        return std::nullopt;
+    }
+
+    const auto snapshot_and_index = repository_->find_segment(SnapshotType::receipts, height);
+    if (!snapshot_and_index) return std::nullopt;
+
+    return ReceiptsFindByBlockNumQuery{*snapshot_and_index}.exec(height);
+}
+
 bool DataModel::read_body_from_snapshot(BlockNum height, BlockBody& body) {
     auto stored_body = read_body_for_storage_from_snapshot(height);
     if (!stored_body) return false;
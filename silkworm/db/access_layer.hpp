@@ -34,6 +34,7 @@
 #include <silkworm/core/types/hash.hpp>
 #include <silkworm/core/types/receipt.hpp>
 #include <silkworm/db/mdbx/mdbx.hpp>
+#include <silkworm/db/receipts/receipt_snapshot.hpp>
 #include <silkworm/db/util.hpp>
 
 namespace silkworm::snapshots {
@@ -317,9 +318,15 @@ class DataModel {
     [[nodiscard]] bool read_body(const Hash& hash, BlockNum height, BlockBody& body) const;
     [[nodiscard]] bool read_body(const Hash& hash, BlockBody& body) const;
 
+    //! Read block (senders excluded) from the snapshot repository, without accessing the db
+    [[nodiscard]] static bool read_block_from_snapshot(BlockNum height, Block& block);
+
     //! Read block body for storage from the snapshot repository
     [[nodiscard]] static std::optional<BlockBodyForStorage> read_body_for_storage_from_snapshot(BlockNum height);
 
+    //! Read block receipts for storage from the snapshot repository, std::nullopt if not frozen with receipts
+    [[nodiscard]] static std::optional<snapshots::BlockReceiptsForStorage> read_receipts_for_storage_from_snapshot(BlockNum height);
+
     //! Read the canonical block header at specified height
     [[nodiscard]] std::optional<Hash> read_canonical_hash(BlockNum height) const;
 
@@ -355,7 +362,6 @@ class DataModel {
     void for_last_n_headers(size_t n, absl::FunctionRef<void(BlockHeader&&)> callback) const;
 
   private:
-    static bool read_block_from_snapshot(BlockNum height, Block& block);
     static std::optional<BlockHeader> read_header_from_snapshot(BlockNum height);
     static std::optional<BlockHeader> read_header_from_snapshot(const Hash& hash);
     static bool read_body_from_snapshot(BlockNum height, BlockBody& body);
@@ -0,0 +1,96 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "arena_state_storage.hpp"
+
+namespace silkworm::db {
+
+//! Number of bytes per slot of a Swiss table: the slot itself plus one control byte
+template <typename TIndex>
+static constexpr size_t kIndexSlotBytes{sizeof(typename TIndex::value_type) + 1};
+
+ArenaStateStorage::ArenaStateStorage()
+    : account_index_{CountingAllocator<std::pair<const evmc::address, AccountEntry*>>{index_bytes_}},
+      storage_index_{CountingAllocator<std::pair<const StorageKey, StorageEntry*>>{index_bytes_}} {}
+
+const std::optional<Account>* ArenaStateStorage::find_account(const evmc::address& address) const {
+    if (const auto it{account_index_.find(address)}; it != account_index_.end()) {
+        return &it->second->account;
+    }
+    return nullptr;
+}
+
+void ArenaStateStorage::update_account(const evmc::address& address, const std::optional<Account>& account) {
+    if (const auto it{account_index_.find(address)}; it != account_index_.end()) {
+        it->second->account = account;
+        return;
+    }
+    AccountEntry& entry{accounts_.push_back({address, account})};
+    account_index_.emplace(address, &entry);
+}
+
+const evmc::bytes32* ArenaStateStorage::find_storage(const evmc::address& address, uint64_t incarnation,
+                                                     const evmc::bytes32& location) const {
+    if (const auto it{storage_index_.find(StorageKey{address, incarnation, location})}; it != storage_index_.end()) {
+        return &it->second->value;
+    }
+    return nullptr;
+}
+
+void ArenaStateStorage::update_storage(const evmc::address& address, uint64_t incarnation,
+                                       const evmc::bytes32& location, const evmc::bytes32& value) {
+    const StorageKey key{address, incarnation, location};
+    if (const auto it{storage_index_.find(key)}; it != storage_index_.end()) {
+        it->second->value = value;
+        return;
+    }
+    StorageEntry& entry{storage_.push_back({key, value})};
+    storage_index_.emplace(key, &entry);
+}
+
+size_t ArenaStateStorage::memory_usage() const noexcept {
+    return accounts_.memory_usage() + storage_.memory_usage() + index_bytes_;
+}
+
+size_t ArenaStateStorage::memory_usage_after_account_inserts(size_t inserts_count) const noexcept {
+    using AccountArray = ArenaArray<AccountEntry>;
+    const size_t size_after_inserts{account_index_.size() + inserts_count};
+
+    // The arena grows by whole chunks
+    const size_t chunks_after_inserts{(accounts_.size() + inserts_count + AccountArray::kItemsPerChunk - 1) /
+                                      AccountArray::kItemsPerChunk};
+    const size_t arena_growth{chunks_after_inserts * AccountArray::kItemsPerChunk * sizeof(AccountEntry) -
+                              std::min(accounts_.memory_usage(),
+                                       chunks_after_inserts * AccountArray::kItemsPerChunk * sizeof(AccountEntry))};
+
+    // The index doubles its capacity when the max load factor (7/8) is exceeded
+    size_t capacity{account_index_.capacity()};
+    while (size_after_inserts > capacity - capacity / 8) {
+        capacity = capacity * 2 + 1;
+    }
+    const size_t index_growth{(capacity - account_index_.capacity()) * kIndexSlotBytes<decltype(account_index_)>};
+
+    return memory_usage() + arena_growth + index_growth;
+}
+
+void ArenaStateStorage::clear() {
+    account_index_ = decltype(account_index_){CountingAllocator<std::pair<const evmc::address, AccountEntry*>>{index_bytes_}};
+    storage_index_ = decltype(storage_index_){CountingAllocator<std::pair<const StorageKey, StorageEntry*>>{index_bytes_}};
+    accounts_.clear();
+    storage_.clear();
+}
+
+}  // namespace silkworm::db
@@ -0,0 +1,192 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/types/account.hpp>
+
+namespace silkworm::db {
+
+//! \brief Standard allocator keeping track of the allocated bytes in an external counter
+template <typename T>
+class CountingAllocator {
+  public:
+    using value_type = T;
+
+    explicit CountingAllocator(size_t& allocated_bytes) noexcept : allocated_bytes_{&allocated_bytes} {}
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+        : allocated_bytes_{other.allocated_bytes_} {}
+
+    T* allocate(size_t n) {
+        T* p{std::allocator<T>{}.allocate(n)};
+        *allocated_bytes_ += n * sizeof(T);
+        return p;
+    }
+    void deallocate(T* p, size_t n) noexcept {
+        std::allocator<T>{}.deallocate(p, n);
+        *allocated_bytes_ -= n * sizeof(T);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& other) const noexcept { return allocated_bytes_ == other.allocated_bytes_; }
+
+  private:
+    template <typename U>
+    friend class CountingAllocator;
+
+    size_t* allocated_bytes_;
+};
+
+//! \brief Append-only array of fixed-size items allocated in big chunks (i.e. a bump allocator for items)
+//! \details Items never move once appended, so they can be referenced by address, and the memory usage is exact.
+template <typename T>
+class ArenaArray {
+  public:
+    static constexpr size_t kChunkBytes{1 << 20};
+    static constexpr size_t kItemsPerChunk{std::max<size_t>(kChunkBytes / sizeof(T), 1)};
+
+    T& push_back(T item) {
+        if (size_ == chunks_.size() * kItemsPerChunk) {
+            chunks_.emplace_back(new T[kItemsPerChunk]);
+        }
+        T& slot{chunks_[size_ / kItemsPerChunk][size_ % kItemsPerChunk]};
+        slot = std::move(item);
+        ++size_;
+        return slot;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    //! \brief The number of bytes allocated for items plus chunk bookkeeping
+    [[nodiscard]] size_t memory_usage() const noexcept {
+        return chunks_.size() * kItemsPerChunk * sizeof(T) + chunks_.capacity() * sizeof(std::unique_ptr<T[]>);
+    }
+
+    //! \brief Visits all the items in insertion order
+    template <typename F>
+    void for_each(F&& visitor) const {
+        for (size_t i{0}; i < size_; ++i) {
+            visitor(chunks_[i / kItemsPerChunk][i % kItemsPerChunk]);
+        }
+    }
+
+    void clear() {
+        chunks_.clear();
+        chunks_.shrink_to_fit();
+        size_ = 0;
+    }
+
+  private:
+    std::vector<std::unique_ptr<T[]>> chunks_;
+    size_t size_{0};
+};
+
+//! \brief Storage engine for the plain state accrued by db::Buffer, alternative to node-based containers
+//! \details Accounts and storage slots are appended as fixed-size entries to arena arrays and indexed by hash maps
+//! pointing into them, so there is no per-key heap allocation. Entries are sorted only once, when flushed.
+//! Memory usage is counted exactly for both arrays and indices.
+class ArenaStateStorage {
+  public:
+    struct StorageKey {
+        evmc::address address;
+        uint64_t incarnation{0};
+        evmc::bytes32 location;
+
+        friend bool operator==(const StorageKey&, const StorageKey&) = default;
+        friend bool operator<(const StorageKey& lhs, const StorageKey& rhs) {
+            return std::tie(lhs.address, lhs.incarnation, lhs.location) <
+                   std::tie(rhs.address, rhs.incarnation, rhs.location);
+        }
+        template <typename H>
+        friend H AbslHashValue(H h, const StorageKey& key) {
+            return H::combine(std::move(h), key.address, key.incarnation, key.location);
+        }
+    };
+
+    struct AccountEntry {
+        evmc::address address;
+        std::optional<Account> account;
+    };
+
+    struct StorageEntry {
+        StorageKey key;
+        evmc::bytes32 value;
+    };
+
+    ArenaStateStorage();
+
+    // Not copyable nor movable: indices reference the memory counter
+    ArenaStateStorage(const ArenaStateStorage&) = delete;
+    ArenaStateStorage& operator=(const ArenaStateStorage&) = delete;
+
+    //! \return the buffered account value or nullptr if the account is not buffered
+    [[nodiscard]] const std::optional<Account>* find_account(const evmc::address& address) const;
+
+    void update_account(const evmc::address& address, const std::optional<Account>& account);
+
+    //! \return the buffered storage value or nullptr if the storage slot is not buffered
+    [[nodiscard]] const evmc::bytes32* find_storage(const evmc::address& address, uint64_t incarnation,
+                                                    const evmc::bytes32& location) const;
+
+    void update_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
+                        const evmc::bytes32& value);
+
+    [[nodiscard]] size_t accounts_count() const noexcept { return account_index_.size(); }
+    [[nodiscard]] size_t storage_count() const noexcept { return storage_index_.size(); }
+
+    //! \brief The exact number of bytes allocated for the buffered state
+    [[nodiscard]] size_t memory_usage() const noexcept;
+
+    //! \brief The number of bytes allocated after inserting the specified number of accounts
+    [[nodiscard]] size_t memory_usage_after_account_inserts(size_t inserts_count) const noexcept;
+
+    //! \brief Visits all the buffered accounts in insertion order
+    template <typename F>
+    void for_each_account(F&& visitor) const { accounts_.for_each(std::forward<F>(visitor)); }
+
+    //! \brief Visits all the buffered storage slots in insertion order
+    template <typename F>
+    void for_each_storage(F&& visitor) const { storage_.for_each(std::forward<F>(visitor)); }
+
+    //! \brief Releases all the buffered state
+    void clear();
+
+  private:
+    template <typename K, typename V>
+    using Index = absl::flat_hash_map<K, V, typename absl::flat_hash_map<K, V>::hasher,
+                                      typename absl::flat_hash_map<K, V>::key_equal,
+                                      CountingAllocator<std::pair<const K, V>>>;
+
+    size_t index_bytes_{0};  // Bytes allocated by the indices
+    ArenaArray<AccountEntry> accounts_;
+    ArenaArray<StorageEntry> storage_;
+    Index<evmc::address, AccountEntry*> account_index_;
+    Index<StorageKey, StorageEntry*> storage_index_;
+};
+
+}  // namespace silkworm::db
@@ -0,0 +1,124 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "arena_state_storage.hpp"
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/types/evmc_bytes32.hpp>
+
+namespace silkworm::db {
+
+using namespace evmc::literals;
+
+TEST_CASE("ArenaArray", "[silkworm][db][buffer]") {
+    ArenaArray<uint64_t> array;
+    CHECK(array.empty());
+    CHECK(array.memory_usage() == 0);
+
+    const uint64_t* first{&array.push_back(1)};
+    CHECK(array.size() == 1);
+    const size_t one_chunk_usage{array.memory_usage()};
+    CHECK(one_chunk_usage >= ArenaArray<uint64_t>::kChunkBytes);
+
+    for (uint64_t i{2}; i <= ArenaArray<uint64_t>::kItemsPerChunk + 1; ++i) {
+        array.push_back(i);
+    }
+    CHECK(array.size() == ArenaArray<uint64_t>::kItemsPerChunk + 1);
+    CHECK(array.memory_usage() > one_chunk_usage);
+    CHECK(*first == 1);  // items never move
+
+    uint64_t expected_item{1};
+    array.for_each([&](const uint64_t& item) {
+        CHECK(item == expected_item);
+        ++expected_item;
+    });
+    CHECK(expected_item == array.size() + 1);
+
+    array.clear();
+    CHECK(array.empty());
+    CHECK(array.memory_usage() == 0);
+}
+
+TEST_CASE("ArenaStateStorage", "[silkworm][db][buffer]") {
+    const auto address1{0xbe00000000000000000000000000000000000000_address};
+    const auto address2{0xaf00000000000000000000000000000000000000_address};
+    const auto location_a{0x0000000000000000000000000000000000000000000000000000000000000013_bytes32};
+    const auto location_b{0x0000000000000000000000000000000000000000000000000000000000000002_bytes32};
+    const auto value1{0x000000000000000000000000000000000000000000000000000000000000006b_bytes32};
+    const auto value2{0x0000000000000000000000000000000000000000000000000000000000000085_bytes32};
+
+    Account account;
+    account.balance = 1'000;
+    account.incarnation = kDefaultIncarnation;
+
+    ArenaStateStorage storage;
+    CHECK(storage.memory_usage() == 0);
+
+    SECTION("find and update") {
+        CHECK(storage.find_account(address1) == nullptr);
+        storage.update_account(address1, account);
+        REQUIRE(storage.find_account(address1) != nullptr);
+        CHECK(*storage.find_account(address1) == account);
+        storage.update_account(address1, std::nullopt);
+        REQUIRE(storage.find_account(address1) != nullptr);
+        CHECK(!storage.find_account(address1)->has_value());
+        CHECK(storage.accounts_count() == 1);
+
+        CHECK(storage.find_storage(address1, kDefaultIncarnation, location_a) == nullptr);
+        storage.update_storage(address1, kDefaultIncarnation, location_a, value1);
+        storage.update_storage(address1, kDefaultIncarnation, location_a, value2);
+        REQUIRE(storage.find_storage(address1, kDefaultIncarnation, location_a) != nullptr);
+        CHECK(*storage.find_storage(address1, kDefaultIncarnation, location_a) == value2);
+        CHECK(storage.find_storage(address1, kDefaultIncarnation + 1, location_a) == nullptr);
+        CHECK(storage.storage_count() == 1);
+    }
+
+    SECTION("memory usage") {
+        storage.update_account(address1, account);
+        const size_t usage{storage.memory_usage()};
+        CHECK(usage > 0);
+        CHECK(storage.memory_usage_after_account_inserts(0) == usage);
+        CHECK(storage.memory_usage_after_account_inserts(1'000'000) > usage);
+        storage.clear();
+        CHECK(storage.accounts_count() == 0);
+        CHECK(storage.memory_usage() == 0);
+    }
+
+    SECTION("visit in insertion order") {
+        storage.update_account(address1, account);
+        storage.update_account(address2, account);
+        storage.update_storage(address1, kDefaultIncarnation, location_a, value1);
+        storage.update_storage(address2, kDefaultIncarnation, location_b, value2);
+        storage.update_storage(address1, kDefaultIncarnation, location_a, value2);
+
+        std::vector<evmc::address> addresses;
+        storage.for_each_account([&](const ArenaStateStorage::AccountEntry& entry) {
+            addresses.push_back(entry.address);
+        });
+        CHECK(addresses == std::vector<evmc::address>{address1, address2});
+
+        std::vector<evmc::bytes32> values;
+        storage.for_each_storage([&](const ArenaStateStorage::StorageEntry& entry) {
+            values.push_back(entry.value);
+        });
+        CHECK(values == std::vector<evmc::bytes32>{value2, value2});
+    }
+}
+
+}  // namespace silkworm::db
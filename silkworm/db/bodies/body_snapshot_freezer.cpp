@@ -25,6 +25,10 @@
 namespace silkworm::db {
 
 void BodySnapshotFreezer::copy(ROTxn& txn, const FreezerCommand& command, snapshots::SnapshotFileWriter& file_writer) const {
+    copy_bodies(txn, command, file_writer);
+}
+
+uint64_t BodySnapshotFreezer::copy_bodies(ROTxn& txn, const FreezerCommand& command, snapshots::SnapshotFileWriter& file_writer) const {
     BlockNumRange range = command.range;
     uint64_t base_txn_id = command.base_txn_id;
 
@@ -39,6 +43,7 @@ void BodySnapshotFreezer::copy(ROTxn& txn, const FreezerCommand& command, snapsh
         base_txn_id += value.txn_count;
         *out++ = value;
     }
+    return base_txn_id;
 }
 
 void BodySnapshotFreezer::cleanup(RWTxn& txn, BlockNumRange range) const {
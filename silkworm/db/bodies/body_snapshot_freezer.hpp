@@ -24,6 +24,8 @@ class BodySnapshotFreezer : public SnapshotFreezer {
   public:
     ~BodySnapshotFreezer() override = default;
     void copy(ROTxn& txn, const FreezerCommand& command, snapshots::SnapshotFileWriter& file_writer) const override;
+    //! Copies the bodies of the command range and returns the base txn id of the block following the range
+    uint64_t copy_bodies(ROTxn& txn, const FreezerCommand& command, snapshots::SnapshotFileWriter& file_writer) const;
     void cleanup(RWTxn& txn, BlockNumRange range) const override;
 };
 
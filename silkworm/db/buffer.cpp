@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <tuple>
 
 #include <absl/container/btree_set.h>
 
@@ -28,6 +29,7 @@
 #include <silkworm/db/tables.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 namespace silkworm::db {
 
@@ -55,7 +57,12 @@ void Buffer::begin_block(uint64_t block_number, size_t updated_accounts_count) {
     if (current_batch_state_size() > memory_limit_) {
         throw MemoryLimitError();
     }
-    if (flat_hash_map_memory_size_after_inserts(accounts_, updated_accounts_count) > memory_limit_) {
+    if (arena_state_) {
+        if (batch_state_size_ + arena_state_->memory_usage_after_account_inserts(updated_accounts_count) >
+            memory_limit_) {
+            throw MemoryLimitError();
+        }
+    } else if (flat_hash_map_memory_size_after_inserts(accounts_, updated_accounts_count) > memory_limit_) {
         throw MemoryLimitError();
     }
 
@@ -68,7 +75,9 @@ void Buffer::update_account(const evmc::address& address, std::optional<Account>
     // Skip update if both initial and final state are non-existent (i.e. contract creation+destruction within the same block)
     if (!initial && !current) {
         // Only to perfectly match Erigon state batch size (Erigon does count any account w/ old=new=empty value).
-        batch_state_size_ += kAddressLength;
+        if (!arena_state_) {
+            batch_state_size_ += kAddressLength;
+        }
         return;
     }
 
@@ -92,11 +101,14 @@ void Buffer::update_account(const evmc::address& address, std::optional<Account>
     }
 
     if (equal) {
-        batch_state_size_ += kAddressLength + (current ? current->encoding_length_for_storage() : 0);
+        if (!arena_state_) {
+            batch_state_size_ += kAddressLength + (current ? current->encoding_length_for_storage() : 0);
+        }
         return;
     }
-    auto it{accounts_.find(address)};
-    if (it != accounts_.end()) {
+    if (arena_state_) {
+        arena_state_->update_account(address, current);
+    } else if (auto it{accounts_.find(address)}; it != accounts_.end()) {
         batch_state_size_ -= it->second.has_value() ? it->second->encoding_length_for_storage() : 0;
         batch_state_size_ += (current ? current->encoding_length_for_storage() : 0);
         it->second = current;
@@ -140,6 +152,11 @@ void Buffer::update_storage(const evmc::address& address, uint64_t incarnation,
         block_storage_changes_[block_number_][address][incarnation].insert_or_assign(location, initial_val);
     }
 
+    if (arena_state_) {
+        arena_state_->update_storage(address, incarnation, location, current);
+        return;
+    }
+
     // Iterator in insert_or_assign return value "is pointing at the element that was inserted or updated"
     // so we cannot use it to determine the old value size: we need to use initial instead
     const auto [_, inserted] = storage_[address][incarnation].insert_or_assign(location, current);
@@ -283,6 +300,10 @@ void Buffer::write_history_to_db(bool write_change_sets) {
 }
 
 void Buffer::write_state_to_db() {
+    write_state_to_db(/*shards=*/nullptr);
+}
+
+void Buffer::write_state_to_db(std::vector<std::future<StateShard>>* shards) {
     /*
      * ENSURE PlainState updates are Last !!!
      * Also ensure to clear unneeded memory data ASAP to let the OS cache
@@ -343,6 +364,20 @@ void Buffer::write_state_to_db() {
         written_size = 0;
     }
 
+    auto state_table = txn_.rw_cursor_dup_sort(table::kPlainState);
+    if (shards) {
+        for (auto& shard : *shards) {
+            written_size += write_state_shard(*state_table, shard.get());
+        }
+        accounts_.clear();
+        storage_.clear();
+    } else if (arena_state_) {
+        written_size = write_state_shard(*state_table, prepare_state_shard(0, 1));
+    }
+    if (arena_state_) {
+        arena_state_->clear();
+    }
+
     // Extract sorted index of unique addresses before inserting into the DB
     absl::btree_set<evmc::address> addresses;
     for (auto& x : accounts_) {
@@ -357,7 +392,6 @@ void Buffer::write_state_to_db() {
         log::Trace("Sorted addresses", {"in", StopWatch::format(duration)});
     }
 
-    auto state_table = txn_.rw_cursor_dup_sort(table::kPlainState);
     for (const auto& address : addresses) {
         if (auto it{accounts_.find(address)}; it != accounts_.end()) {
             auto key{to_slice(address)};
@@ -403,11 +437,114 @@ void Buffer::write_state_to_db() {
 }
 
 void Buffer::write_to_db(bool write_change_sets) {
+    if (flush_workers_ == 0) {
+        write_history_to_db(write_change_sets);
+
+        // This should be very last to be written so updated pages
+        // have higher chances not to be evicted from RAM
+        write_state_to_db();
+        return;
+    }
+
+    // PlainState updates get sorted and encoded in background while history is written
+    ThreadPool workers{static_cast<unsigned>(flush_workers_)};
+    const size_t shard_count{flush_workers_ * kStateShardsPerWorker};
+    std::vector<std::future<StateShard>> shards;
+    shards.reserve(shard_count);
+    for (size_t shard_index{0}; shard_index < shard_count; ++shard_index) {
+        shards.push_back(workers.submit([this, shard_index, shard_count]() {
+            return prepare_state_shard(shard_index, shard_count);
+        }));
+    }
+
     write_history_to_db(write_change_sets);
+    write_state_to_db(&shards);
+}
+
+Buffer::StateShard Buffer::prepare_state_shard(size_t shard_index, size_t shard_count) const {
+    // Shards split the address space in contiguous ranges, so writing them in order keeps PlainState key order
+    const auto in_shard{[&](const evmc::address& address) {
+        return address.bytes[0] * shard_count / 256 == shard_index;
+    }};
+
+    StateShard shard;
+    const auto add_account{[&](const evmc::address& address, const std::optional<Account>& account) {
+        shard.accounts.push_back({address, account ? std::make_optional(account->encode_for_storage()) : std::nullopt});
+    }};
+    if (arena_state_) {
+        arena_state_->for_each_account([&](const ArenaStateStorage::AccountEntry& entry) {
+            if (in_shard(entry.address)) {
+                add_account(entry.address, entry.account);
+            }
+        });
+        arena_state_->for_each_storage([&](const ArenaStateStorage::StorageEntry& entry) {
+            if (in_shard(entry.key.address)) {
+                shard.storage.push_back({&entry.key.address, entry.key.incarnation, &entry.key.location, &entry.value});
+            }
+        });
+    } else {
+        for (const auto& [address, account] : accounts_) {
+            if (in_shard(address)) {
+                add_account(address, account);
+            }
+        }
+        for (const auto& [address, storage_by_incarnation] : storage_) {
+            if (!in_shard(address)) {
+                continue;
+            }
+            for (const auto& [incarnation, contract_storage] : storage_by_incarnation) {
+                for (const auto& [location, value] : contract_storage) {
+                    shard.storage.push_back({&address, incarnation, &location, &value});
+                }
+            }
+        }
+    }
 
-    // This should be very last to be written so updated pages
-    // have higher chances not to be evicted from RAM
-    write_state_to_db();
+    std::sort(shard.accounts.begin(), shard.accounts.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.address < rhs.address;
+    });
+    std::sort(shard.storage.begin(), shard.storage.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(*lhs.address, lhs.incarnation, *lhs.location) <
+               std::tie(*rhs.address, rhs.incarnation, *rhs.location);
+    });
+    return shard;
+}
+
+size_t Buffer::write_state_shard(RWCursorDupSort& plain_state, const StateShard& shard) {
+    size_t written_size{0};
+
+    // Merge account and storage updates by address, so that PlainState is written in key order
+    auto account_it{shard.accounts.cbegin()};
+    auto storage_it{shard.storage.cbegin()};
+    while (account_it != shard.accounts.cend() || storage_it != shard.storage.cend()) {
+        const bool account_first{storage_it == shard.storage.cend() ||
+                                 (account_it != shard.accounts.cend() && !(*storage_it->address < account_it->address))};
+        const evmc::address address{account_first ? account_it->address : *storage_it->address};
+
+        if (account_it != shard.accounts.cend() && account_it->address == address) {
+            const auto key{to_slice(address)};
+            plain_state.erase(key, /*whole_multivalue=*/true);  // PlainState is multivalue
+            if (account_it->encoded) {
+                plain_state.upsert(key, to_slice(*account_it->encoded));
+                written_size += kAddressLength + account_it->encoded->length();
+            }
+            ++account_it;
+        }
+
+        Bytes prefix;
+        std::optional<uint64_t> prefix_incarnation;
+        for (; storage_it != shard.storage.cend() && *storage_it->address == address; ++storage_it) {
+            if (prefix_incarnation != storage_it->incarnation) {
+                prefix = storage_prefix(address, storage_it->incarnation);
+                prefix_incarnation = storage_it->incarnation;
+            }
+            const auto& value{*storage_it->value};
+            upsert_storage_value(plain_state, prefix, storage_it->location->bytes, value.bytes);
+            written_size += prefix.length() + kLocationLength + zeroless_view(value.bytes).size();
+        }
+    }
+
+    return written_size;
 }
 
 // Erigon WriteReceipts in core/rawdb/accessors_chain.go
@@ -517,7 +654,11 @@ bool Buffer::read_body(uint64_t block_number, const evmc::bytes32& block_hash, B
 }
 
 std::optional<Account> Buffer::read_account(const evmc::address& address) const noexcept {
-    if (auto it{accounts_.find(address)}; it != accounts_.end()) {
+    if (arena_state_) {
+        if (const auto* account{arena_state_->find_account(address)}) {
+            return *account;
+        }
+    } else if (auto it{accounts_.find(address)}; it != accounts_.end()) {
         return it->second;
     }
     auto db_account{db::read_account(txn_, address, historical_block_)};
@@ -538,7 +679,11 @@ ByteView Buffer::read_code(const evmc::bytes32& code_hash) const noexcept {
 
 evmc::bytes32 Buffer::read_storage(const evmc::address& address, uint64_t incarnation,
                                    const evmc::bytes32& location) const noexcept {
-    if (auto it1{storage_.find(address)}; it1 != storage_.end()) {
+    if (arena_state_) {
+        if (const auto* value{arena_state_->find_storage(address, incarnation, location)}) {
+            return *value;
+        }
+    } else if (auto it1{storage_.find(address)}; it1 != storage_.end()) {
         if (auto it2{it1->second.find(incarnation)}; it2 != it1->second.end()) {
             if (auto it3{it2->second.find(location)}; it3 != it2->second.end()) {
                 return it3->second;
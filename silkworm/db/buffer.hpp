@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <future>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <vector>
@@ -32,6 +34,7 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/receipt.hpp>
 #include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/arena_state_storage.hpp>
 #include <silkworm/db/mdbx/mdbx.hpp>
 #include <silkworm/db/util.hpp>
 
@@ -39,9 +42,16 @@ namespace silkworm::db {
 
 class Buffer : public State {
   public:
-    explicit Buffer(RWTxn& txn)
+    //! \brief Storage engine for the accrued plain state (accounts and storage)
+    enum class StateStorage {
+        kHashMaps,  // Node-based hash maps, memory size estimated on encoded data
+        kArena,     // Arena-backed fixed-size entries sorted on flush, memory size counted exactly
+    };
+
+    explicit Buffer(RWTxn& txn, StateStorage state_storage = StateStorage::kHashMaps)
         : txn_{txn},
-          access_layer_{txn_} {}
+          access_layer_{txn_},
+          arena_state_{state_storage == StateStorage::kArena ? std::make_unique<ArenaStateStorage>() : nullptr} {}
 
     /** @name Settings */
     //!@{
@@ -58,6 +68,11 @@ class Buffer : public State {
         memory_limit_ = memory_limit;
     }
 
+    //! \brief Number of worker threads sorting and encoding PlainState updates in write_to_db (0 means no workers)
+    void set_flush_workers(size_t flush_workers) {
+        flush_workers_ = flush_workers;
+    }
+
     //!@}
 
     /** @name Readers */
@@ -133,11 +148,16 @@ class Buffer : public State {
         return block_storage_changes_;
     }
 
-    //! \brief Approximate size of accrued state in bytes.
-    [[nodiscard]] size_t current_batch_state_size() const noexcept { return batch_state_size_; }
+    //! \brief Size of accrued state in bytes: approximate for hash maps, exact memory usage for arena storage
+    //! (besides code and incarnations, which are always approximate)
+    [[nodiscard]] size_t current_batch_state_size() const noexcept {
+        return batch_state_size_ + (arena_state_ ? arena_state_->memory_usage() : 0);
+    }
 
     //! \brief Persists *all* accrued contents into db
-    //! \remarks write_history_to_db is implicitly called
+    //! \remarks write_history_to_db is implicitly called. If flush workers are set, PlainState updates are sorted
+    //! and encoded by the workers in shards by address range while history is written, then the shards are written
+    //! in order on the calling thread (which is the only one using the db transaction)
     //! @param write_change_sets flag indicating if state changes should be written or not (default: true)
     void write_to_db(bool write_change_sets = true);
 
@@ -154,6 +174,36 @@ class Buffer : public State {
     };
 
   private:
+    //! \brief PlainState updates for a range of addresses, sorted by key and encoded ahead of writing
+    //! \remarks Storage updates refer to buffered entries, so the buffer must not change until the shard is written
+    struct StateShard {
+        struct AccountUpdate {
+            evmc::address address;
+            std::optional<Bytes> encoded;  // std::nullopt means deleted account
+        };
+        struct StorageUpdate {
+            const evmc::address* address{nullptr};
+            uint64_t incarnation{0};
+            const evmc::bytes32* location{nullptr};
+            const evmc::bytes32* value{nullptr};
+        };
+        std::vector<AccountUpdate> accounts;
+        std::vector<StorageUpdate> storage;
+    };
+
+    //! Number of shards per flush worker, more than one to balance uneven address distributions
+    static constexpr size_t kStateShardsPerWorker{4};
+
+    //! \brief Collects, sorts and encodes the updates for the addresses falling into the specified shard
+    [[nodiscard]] StateShard prepare_state_shard(size_t shard_index, size_t shard_count) const;
+
+    //! \brief Writes the shard updates into PlainState
+    //! \return the number of bytes written
+    static size_t write_state_shard(RWCursorDupSort& plain_state, const StateShard& shard);
+
+    //! \brief Persists *state* accrued contents into db, getting PlainState updates from the shards if any
+    void write_state_to_db(std::vector<std::future<StateShard>>* shards);
+
     RWTxn& txn_;
     db::DataModel access_layer_;
 
@@ -164,6 +214,8 @@ class Buffer : public State {
 
     size_t memory_limit_{std::numeric_limits<size_t>::max()};
 
+    size_t flush_workers_{0};
+
     absl::btree_map<Bytes, BlockHeader> headers_;
     absl::btree_map<Bytes, BlockBody> bodies_;
     absl::btree_map<Bytes, intx::uint256> difficulty_;
@@ -189,6 +241,9 @@ class Buffer : public State {
     absl::btree_map<Bytes, Bytes> logs_;
     absl::btree_map<BlockNum, absl::btree_set<Bytes>> call_traces_;
 
+    // Accounts and storage when using arena storage engine (replaces accounts_ and storage_)
+    std::unique_ptr<ArenaStateStorage> arena_state_;
+
     // Accounts in memory data for state
     mutable size_t batch_state_size_{0};
 
@@ -15,8 +15,10 @@
 */
 
 #include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <silkworm/core/common/endian.hpp>
 #include <silkworm/core/types/address.hpp>
@@ -54,7 +56,8 @@ TEST_CASE("Buffer storage", "[silkworm][db][buffer]") {
     upsert_storage_value(*state, key, location_a.bytes, value_a1.bytes);
     upsert_storage_value(*state, key, location_b.bytes, value_b.bytes);
 
-    Buffer buffer{txn};
+    const auto state_storage{GENERATE(Buffer::StateStorage::kHashMaps, Buffer::StateStorage::kArena)};
+    Buffer buffer{txn, state_storage};
 
     SECTION("Reads storage by address and location") {
         CHECK(buffer.read_storage(address, kDefaultIncarnation, location_a) == value_a1);
@@ -382,4 +385,74 @@ TEST_CASE("Buffer account", "[silkworm][db][buffer]") {
     }
 }
 
+TEST_CASE("Buffer arena state storage", "[silkworm][db][buffer]") {
+    SetLogVerbosityGuard log_guard{log::Level::kNone};
+    db::test_util::TempChainData context;
+    auto& txn{context.rw_txn()};
+
+    const auto address{0xbe00000000000000000000000000000000000000_address};
+    Account current_account;
+    current_account.balance = kEther;
+
+    Buffer buffer{txn, Buffer::StateStorage::kArena};
+    CHECK(buffer.current_batch_state_size() == 0);
+
+    SECTION("Memory usage is counted exactly") {
+        buffer.begin_block(1, 1);
+        buffer.update_account(address, /*initial=*/std::nullopt, current_account);
+        CHECK(buffer.read_account(address) == current_account);
+        CHECK(buffer.current_batch_state_size() > 0);
+
+        buffer.set_memory_limit(buffer.current_batch_state_size());
+        CHECK_THROWS_AS(buffer.begin_block(2, 1'000'000), Buffer::MemoryLimitError);
+
+        REQUIRE_NOTHROW(buffer.write_to_db());
+        CHECK(buffer.current_batch_state_size() == 0);
+        CHECK(read_account(txn, address) == current_account);
+    }
+}
+
+TEST_CASE("Buffer flush with workers", "[silkworm][db][buffer]") {
+    SetLogVerbosityGuard log_guard{log::Level::kNone};
+    db::test_util::TempChainData context;
+    auto& txn{context.rw_txn()};
+
+    const auto state_storage{GENERATE(Buffer::StateStorage::kHashMaps, Buffer::StateStorage::kArena)};
+    Buffer buffer{txn, state_storage};
+    buffer.set_flush_workers(3);
+
+    const auto location{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+    const auto value{0x00000000000000000000000000000000000000000000000000000000000000ff_bytes32};
+
+    // Spread addresses over the whole first-byte range so that every shard gets some updates
+    std::vector<evmc::address> addresses;
+    for (size_t i{0}; i < 256; i += 5) {
+        evmc::address address;
+        address.bytes[0] = static_cast<uint8_t>(255 - i);
+        address.bytes[19] = static_cast<uint8_t>(i);
+        addresses.push_back(address);
+    }
+
+    buffer.begin_block(1, addresses.size());
+    for (size_t i{0}; i < addresses.size(); ++i) {
+        Account account;
+        account.balance = i + 1;
+        account.incarnation = kDefaultIncarnation;
+        buffer.update_account(addresses[i], /*initial=*/std::nullopt, account);
+        buffer.update_storage(addresses[i], kDefaultIncarnation, location, /*initial=*/{}, value);
+    }
+    REQUIRE_NOTHROW(buffer.write_to_db());
+    CHECK(buffer.current_batch_state_size() == 0);
+
+    for (size_t i{0}; i < addresses.size(); ++i) {
+        const auto account{read_account(txn, addresses[i])};
+        REQUIRE(account);
+        CHECK(account->balance == i + 1);
+        CHECK(read_storage(txn, addresses[i], kDefaultIncarnation, location) == value);
+    }
+
+    auto state{txn.ro_cursor_dup_sort(table::kPlainState)};
+    CHECK(state->size() == 2 * addresses.size());
+}
+
 }  // namespace silkworm::db
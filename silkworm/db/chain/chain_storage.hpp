@@ -21,6 +21,7 @@
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
 #include <silkworm/core/types/block.hpp>
+#include <silkworm/db/receipts/receipt_snapshot.hpp>
 
 namespace silkworm::db::chain {
 
@@ -89,6 +90,9 @@ class ChainStorage {
     [[nodiscard]] virtual Task<std::optional<intx::uint256>> read_total_difficulty(const Hash& block_hash, BlockNum block_number) const = 0;
 
     virtual Task<std::optional<BlockNum>> read_block_number_by_transaction_hash(const evmc::bytes32& transaction_hash) const = 0;
+
+    //! Read receipts and logs of block specified by number from the receipts snapshot, if available
+    [[nodiscard]] virtual Task<std::optional<snapshots::BlockReceiptsForStorage>> read_frozen_receipts(BlockNum number) const = 0;
 };
 
 }  // namespace silkworm::db::chain
@@ -147,4 +147,8 @@ Task<std::optional<BlockNum>> LocalChainStorage::read_block_number_by_transactio
     co_return data_model_.read_tx_lookup(transaction_hash);
 }
 
+Task<std::optional<snapshots::BlockReceiptsForStorage>> LocalChainStorage::read_frozen_receipts(BlockNum number) const {
+    co_return DataModel::read_receipts_for_storage_from_snapshot(number);
+}
+
 }  // namespace silkworm::db::chain
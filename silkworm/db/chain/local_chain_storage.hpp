@@ -68,6 +68,8 @@ class LocalChainStorage : public ChainStorage {
 
     Task<std::optional<BlockNum>> read_block_number_by_transaction_hash(const evmc::bytes32& transaction_hash) const override;
 
+    Task<std::optional<snapshots::BlockReceiptsForStorage>> read_frozen_receipts(BlockNum number) const override;
+
   private:
     db::DataModel data_model_;
 };
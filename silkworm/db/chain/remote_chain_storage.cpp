@@ -190,4 +190,9 @@ Task<std::optional<BlockNum>> RemoteChainStorage::read_block_number_by_transacti
     co_return co_await block_number_from_txn_hash_provider_(transaction_hash.bytes);
 }
 
+Task<std::optional<snapshots::BlockReceiptsForStorage>> RemoteChainStorage::read_frozen_receipts(BlockNum /*number*/) const {
+    // Snapshot segments are not accessible remotely, receipts are served by the remote database
+    co_return std::nullopt;
+}
+
 }  // namespace silkworm::db::chain
@@ -76,6 +76,8 @@ class RemoteChainStorage : public ChainStorage {
 
     Task<std::optional<BlockNum>> read_block_number_by_transaction_hash(const evmc::bytes32& transaction_hash) const override;
 
+    Task<std::optional<snapshots::BlockReceiptsForStorage>> read_frozen_receipts(BlockNum number) const override;
+
   private:
     kv::api::Transaction& tx_;
     BlockProvider block_provider_;
@@ -23,8 +23,11 @@ void DataMigration::run() {
     auto command = next_command();
     if (!command) return;
     auto result = migrate(std::move(command));
-    index(result);
-    commit(result);
+    // A migration may make progress without a result ready to be committed yet
+    if (result) {
+        index(result);
+        commit(result);
+    }
     cleanup();
 }
 
@@ -33,6 +33,7 @@ struct DataMigration {
 
   protected:
     virtual std::unique_ptr<DataMigrationCommand> next_command() = 0;
+    //! \return the result to index and commit, nullptr if the migrated data is not complete yet
     virtual std::shared_ptr<DataMigrationResult> migrate(std::unique_ptr<DataMigrationCommand> command) = 0;
     virtual void index(std::shared_ptr<DataMigrationResult> result) = 0;
     virtual void commit(std::shared_ptr<DataMigrationResult> result) = 0;
@@ -0,0 +1,89 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "buffer.hpp"
+
+#include <array>
+#include <thread>
+
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+
+namespace silkworm::db::etl {
+
+bool Buffer::less(const IndexEntry& lhs, const IndexEntry& rhs) const noexcept {
+    if (lhs.key_prefix != rhs.key_prefix) {
+        return lhs.key_prefix < rhs.key_prefix;
+    }
+    const EntryView lhs_view{view(lhs)};
+    const EntryView rhs_view{view(rhs)};
+    const auto diff{lhs_view.key.compare(rhs_view.key)};
+    if (diff == 0) {
+        return lhs_view.value < rhs_view.value;
+    }
+    return diff < 0;
+}
+
+void Buffer::sort() {
+    const auto compare{[this](const IndexEntry& lhs, const IndexEntry& rhs) { return less(lhs, rhs); }};
+    const auto num_workers{std::thread::hardware_concurrency()};
+    if (index_.size() < kParallelSortThreshold || num_workers < 2) {
+        std::sort(index_.begin(), index_.end(), compare);
+        return;
+    }
+
+    // Keys often share a long common prefix (e.g. big-endian block numbers): find the first byte where they differ
+    const ByteView first_key{view(index_.front()).key};
+    size_t radix_pos{first_key.size()};
+    for (const auto& index_entry : index_) {
+        const ByteView key{view(index_entry).key};
+        const auto [mismatch, _]{std::mismatch(first_key.cbegin(), first_key.cbegin() + static_cast<ptrdiff_t>(radix_pos),
+                                               key.cbegin(), key.cend())};
+        radix_pos = static_cast<size_t>(mismatch - first_key.cbegin());
+    }
+
+    // Bucket 0 holds keys equal to the common prefix, which sort before any longer key
+    const auto bucket_of{[this, radix_pos](const IndexEntry& index_entry) -> size_t {
+        return index_entry.key_length == radix_pos ? 0 : 1 + size_t{slab_[index_entry.offset + radix_pos]};
+    }};
+    static constexpr size_t kNumBuckets{257};
+    std::array<size_t, kNumBuckets + 1> offsets{};
+    for (const auto& index_entry : index_) {
+        ++offsets[bucket_of(index_entry) + 1];
+    }
+    for (size_t i{1}; i < offsets.size(); ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+
+    std::vector<IndexEntry> distributed(index_.size());
+    std::array<size_t, kNumBuckets> positions{};
+    std::copy_n(offsets.cbegin(), kNumBuckets, positions.begin());
+    for (const auto& index_entry : index_) {
+        distributed[positions[bucket_of(index_entry)]++] = index_entry;
+    }
+    index_.swap(distributed);
+
+    ThreadPool workers{num_workers};
+    for (size_t bucket{0}; bucket < kNumBuckets; ++bucket) {
+        const auto first{index_.begin() + static_cast<ptrdiff_t>(offsets[bucket])};
+        const auto last{index_.begin() + static_cast<ptrdiff_t>(offsets[bucket + 1])};
+        if (last - first > 1) {
+            workers.push_task([first, last, &compare]() { std::sort(first, last, compare); });
+        }
+    }
+    workers.wait_for_tasks();
+}
+
+}  // namespace silkworm::db::etl
@@ -17,34 +17,55 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
+#include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/common/endian.hpp>
 
 #include "util.hpp"
 
 namespace silkworm::db::etl {
 
 inline constexpr size_t kInitialBufferCapacity = 32768;
+inline constexpr size_t kInitialSlabCapacity = 1_Mebi;
+inline constexpr size_t kParallelSortThreshold = 65536;  // Min number of entries to sort in parallel
+
+// A view on an entry stored in a buffer, valid until the buffer is cleared or a new entry is added
+struct EntryView {
+    ByteView key;
+    ByteView value;
+};
 
 // In ETL, a buffer must be used stores entries, sort them and write them to file
+// Keys and values are appended to one contiguous slab, entries are only referenced by a compact index
 class Buffer {
   public:
     // Not copyable nor movable
     Buffer(const Buffer&) = delete;
     Buffer& operator=(const Buffer&) = delete;
 
-    explicit Buffer(size_t optimal_size) : optimal_size_(optimal_size) { buffer_.reserve(kInitialBufferCapacity); }
+    explicit Buffer(size_t optimal_size) : optimal_size_(optimal_size) {
+        index_.reserve(kInitialBufferCapacity);
+        slab_.reserve(std::min(optimal_size, kInitialSlabCapacity));
+    }
 
-    void put(Entry entry) {
+    void put(ByteView key, ByteView value) {
         // Add a new entry to the buffer
-        size_ += entry.size() + sizeof(head_t);
-        buffer_.push_back(std::move(entry));
+        size_ += key.size() + value.size() + sizeof(head_t);
+        index_.push_back({key_prefix(key), slab_.size(), static_cast<uint32_t>(key.size()),
+                          static_cast<uint32_t>(value.size())});
+        slab_.append(key.data(), key.size());
+        slab_.append(value.data(), value.size());
     }
 
+    void put(const Entry& entry) { put(entry.key, entry.value); }
+
     void clear() noexcept {
         // Set the buffer to contain 0 entries
-        buffer_.clear();
+        index_.clear();
+        slab_.clear();
         size_ = 0;
     }
 
@@ -53,23 +74,47 @@ class Buffer {
         return size_ >= optimal_size_;
     }
 
-    void sort() {
-        // Sort buffer in increasing order by key comparison
-        std::sort(buffer_.begin(), buffer_.end());
-    }
+    // Sort buffer in increasing order by key comparison
+    // Large buffers get distributed by radix on the first differing key byte and buckets are sorted in parallel
+    void sort();
 
     [[nodiscard]] size_t size() const noexcept {
         // Actual size of accounted data
         return size_;
     }
 
-    [[nodiscard]] const std::vector<Entry>& entries() const noexcept { return buffer_; }
+    [[nodiscard]] size_t entries_count() const noexcept { return index_.size(); }
+
+    [[nodiscard]] EntryView entry(size_t i) const noexcept { return view(index_[i]); }
 
   private:
+    struct IndexEntry {
+        uint64_t key_prefix;  // First 8 bytes of key (big-endian, zero padded): decides most comparisons
+        size_t offset;        // Position of key followed by value in slab
+        uint32_t key_length;
+        uint32_t value_length;
+    };
+
+    static uint64_t key_prefix(ByteView key) noexcept {
+        uint8_t prefix[sizeof(uint64_t)]{};
+        if (!key.empty()) {
+            std::memcpy(prefix, key.data(), std::min(key.size(), sizeof(uint64_t)));
+        }
+        return endian::load_big_u64(prefix);
+    }
+
+    [[nodiscard]] EntryView view(const IndexEntry& index_entry) const noexcept {
+        const uint8_t* data{slab_.data() + index_entry.offset};
+        return {{data, index_entry.key_length}, {data + index_entry.key_length, index_entry.value_length}};
+    }
+
+    [[nodiscard]] bool less(const IndexEntry& lhs, const IndexEntry& rhs) const noexcept;
+
     size_t optimal_size_;
     size_t size_ = 0;
 
-    std::vector<Entry> buffer_;  // buffer for holding entries
+    std::vector<IndexEntry> index_;  // index of entries in slab
+    Bytes slab_;                     // contiguous storage for keys and values
 };
 
 }  // namespace silkworm::db::etl
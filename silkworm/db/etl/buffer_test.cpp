@@ -0,0 +1,80 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "buffer.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/random_number.hpp>
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::db::etl {
+
+TEST_CASE("ETL Buffer sort") {
+    Buffer buffer{256_Mebi};
+    std::vector<Entry> expected;
+
+    // Keys share a common prefix, some are equal to it and some are duplicated with different values
+    RandomNumber rnd{0, 5'000'000};
+    for (size_t i{0}; i < 2 * kParallelSortThreshold; ++i) {
+        Bytes key(12, '\0');
+        key[0] = 0x42;
+        endian::store_big_u64(&key[4], rnd.generate_one());
+        if (i % 1000 == 0) {
+            key.resize(4);
+        }
+        Bytes value(1, static_cast<uint8_t>(i % 3));
+        buffer.put(key, value);
+        expected.emplace_back(std::move(key), std::move(value));
+    }
+    CHECK(buffer.size() == buffer.entries_count() * (13 + sizeof(head_t)) - (2 * kParallelSortThreshold / 1000 + 1) * 8);
+
+    buffer.sort();
+    std::sort(expected.begin(), expected.end());
+
+    REQUIRE(buffer.entries_count() == expected.size());
+    bool sorted_as_expected{true};
+    for (size_t i{0}; i < expected.size() && sorted_as_expected; ++i) {
+        const auto [key, value]{buffer.entry(i)};
+        sorted_as_expected = key == ByteView{expected[i].key} && value == ByteView{expected[i].value};
+    }
+    CHECK(sorted_as_expected);
+}
+
+TEST_CASE("ETL Buffer sort keys shorter than prefix") {
+    Buffer buffer{1_Mebi};
+    buffer.put(*from_hex("0100"), *from_hex("02"));
+    buffer.put(*from_hex("01"), *from_hex("03"));
+    buffer.put(*from_hex("010000000000000000"), {});
+    buffer.put(*from_hex("0100"), *from_hex("01"));
+    buffer.put({}, *from_hex("ff"));
+    buffer.sort();
+
+    REQUIRE(buffer.entries_count() == 5);
+    CHECK(to_hex(buffer.entry(0).key) == "");
+    CHECK(to_hex(buffer.entry(1).key) == "01");
+    CHECK(to_hex(buffer.entry(2).key) == "0100");
+    CHECK(to_hex(buffer.entry(2).value) == "01");
+    CHECK(to_hex(buffer.entry(3).key) == "0100");
+    CHECK(to_hex(buffer.entry(3).value) == "02");
+    CHECK(to_hex(buffer.entry(4).key) == "010000000000000000");
+}
+
+}  // namespace silkworm::db::etl
@@ -16,6 +16,7 @@
 
 #include "collector.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iomanip>
 #include <queue>
@@ -25,11 +26,15 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
 #include <silkworm/infra/concurrency/signal_handler.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 namespace silkworm::db::etl {
 
 namespace fs = std::filesystem;
 
+//! Reading ahead is disk-bound, so a few threads keep the merge busy however many files have been flushed
+static constexpr size_t kMaxReadAheadThreads{4};
+
 Collector::~Collector() {
     clear();  // Will ensure all files (if any) have been orderly closed and deleted
     if (work_path_managed_ && fs::exists(work_path_)) {
@@ -41,15 +46,17 @@ void Collector::flush_buffer() {
     if (buffer_.size()) {
         StopWatch sw(/*auto_start=*/true);
         buffer_.sort();
+        const auto [sort_time, sort_duration]{sw.lap()};
 
         /* Build a unique file name to pass FileProvider */
         fs::path new_file_path{
             work_path_ / fs::path(std::to_string(unique_id_) + "-" + std::to_string(file_providers_.size()) + ".bin")};
 
-        file_providers_.emplace_back(new FileProvider(new_file_path.string(), file_providers_.size()));
+        file_providers_.emplace_back(new FileProvider(new_file_path.string(), file_providers_.size(), compress_files_));
         file_providers_.back()->flush(buffer_);
+        const size_t flushed_size{buffer_.size()};
         buffer_.clear();
-        const auto [_, duration]{sw.stop()};
+        const auto [stop_time, _]{sw.stop()};
         log::Debug(
             "ETL collector flushed file",
             {
@@ -57,56 +64,105 @@ void Collector::flush_buffer() {
                 std::string(file_providers_.back()->get_file_name()),
                 "size",
                 human_size(file_providers_.back()->get_file_size()),
+                "data",
+                human_size(flushed_size),
+                "sort",
+                StopWatch::format(sort_duration),
                 "in",
-                StopWatch::format(duration),
+                StopWatch::format(sw.since_start(stop_time)),
             });
     }
 }
 
-void Collector::collect(Entry entry) {
+void Collector::collect(const Entry& entry) {
+    collect(entry.key, entry.value);
+}
+
+void Collector::collect(ByteView key, ByteView value) {
     ++size_;
-    bytes_size_ += entry.size();
-    buffer_.put(std::move(entry));
+    bytes_size_ += key.size() + value.size();
+    buffer_.put(key, value);
     if (buffer_.overflows()) {
         flush_buffer();
     }
 }
 
-void Collector::collect(Bytes key, Bytes value) {
-    collect(Entry{std::move(key), std::move(value)});
+void Collector::merge(Collector& other) {
+    if (&other == this || other.empty()) {
+        return;
+    }
+    if (other.work_path_managed_) {
+        throw etl_error("Cannot merge collector with managed work path");
+    }
+    other.flush_buffer();
+    for (auto& file_provider : other.file_providers_) {
+        file_provider->set_id(file_providers_.size());
+        file_providers_.push_back(std::move(file_provider));
+    }
+    size_ += other.size_;
+    bytes_size_ += other.bytes_size_;
+    other.file_providers_.clear();
+    other.size_ = 0;
+    other.bytes_size_ = 0;
 }
 
 void Collector::load(const LoadFunc& load_func) {
     using namespace std::chrono_literals;
     static const auto kLogInterval{5s};               // Updates processing key (for log purposes) every this time
     auto log_time{std::chrono::steady_clock::now()};  // To check if an update of key is needed
+    const auto start_time{log_time};
+    size_t loaded_bytes{0};
 
     set_loading_key({});
+    set_load_throughput(0, {});
 
     if (empty()) {
         return;
     }
 
+    const auto log_loaded{[&](size_t num_files, size_t files_size) {
+        const auto elapsed{std::chrono::steady_clock::now() - start_time};
+        set_load_throughput(loaded_bytes, elapsed);
+        log::Debug("ETL collector loaded",
+                   {"entries", std::to_string(size_),
+                    "size", human_size(loaded_bytes),
+                    "files", std::to_string(num_files),
+                    "files size", human_size(files_size),
+                    "in", StopWatch::format(elapsed),
+                    "rate", get_load_throughput()});
+    }};
+
     if (file_providers_.empty()) {
         buffer_.sort();
 
-        for (const auto& etl_entry : buffer_.entries()) {
+        Entry etl_entry;  // Reused for all entries to avoid allocations
+        for (size_t i{0}; i < buffer_.entries_count(); ++i) {
+            const auto [key, value]{buffer_.entry(i)};
+            etl_entry.key.assign(key.data(), key.size());
+            etl_entry.value.assign(value.data(), value.size());
             if (const auto now{std::chrono::steady_clock::now()}; log_time <= now) {
                 if (SignalHandler::signalled()) {
                     throw std::runtime_error("Operation cancelled");
                 }
                 set_loading_key(etl_entry.key);
+                set_load_throughput(loaded_bytes, now - start_time);
                 log_time = now + kLogInterval;
             }
             load_func(etl_entry);
+            loaded_bytes += etl_entry.size();
         }
 
+        log_loaded(0, 0);
         clear();
         return;
     }
 
     // Flush not overflown buffer data to file
     flush_buffer();
+    size_t files_size{0};
+    for (const auto& file_provider : file_providers_) {
+        files_size += file_provider->get_file_size();
+    }
 
     // Define a priority queue based on smallest available key
     auto key_comparer = [](const std::pair<Entry, size_t>& left, const std::pair<Entry, size_t>& right) {
@@ -115,10 +171,13 @@ void Collector::load(const LoadFunc& load_func) {
     std::priority_queue<std::pair<Entry, size_t>, std::vector<std::pair<Entry, size_t>>, decltype(key_comparer)> queue(
         key_comparer);
 
+    // Blocks are read ahead by a few threads shared among all files, whatever their number
+    ThreadPool read_ahead_pool{static_cast<unsigned>(std::min(file_providers_.size(), kMaxReadAheadThreads))};
+
     // Read one "record" from each data_provider and let the queue
     // sort them. On top of the queue the smallest key
     for (auto& file_provider : file_providers_) {
-        auto item{file_provider->read_entry()};
+        auto item{file_provider->read_entry(&read_ahead_pool)};
         if (item.has_value()) {
             queue.push(std::move(*item));
         }
@@ -135,14 +194,16 @@ void Collector::load(const LoadFunc& load_func) {
             }
             log_time = now + kLogInterval;
             set_loading_key(etl_entry.key);
+            set_load_throughput(loaded_bytes, now - start_time);
         }
 
         // Process linked pairs
         load_func(etl_entry);
+        loaded_bytes += etl_entry.size();
 
         // From the provider which has served the current key
         // read next "record"
-        auto next{file_provider->read_entry()};
+        auto next{file_provider->read_entry(&read_ahead_pool)};
 
         // At this point `current` has been processed.
         // We can remove it from the queue
@@ -156,9 +217,17 @@ void Collector::load(const LoadFunc& load_func) {
             file_provider.reset();
         }
     }
+    log_loaded(file_providers_.size(), files_size);
     clear();
 }
 
+void Collector::set_load_throughput(size_t loaded_bytes, std::chrono::steady_clock::duration elapsed) {
+    const auto elapsed_ms{std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()};
+    const uint64_t bytes_per_second{elapsed_ms > 0 ? loaded_bytes * 1000 / static_cast<uint64_t>(elapsed_ms) : 0};
+    std::unique_lock l{mutex_};
+    load_throughput_ = bytes_per_second ? human_size(bytes_per_second) + "/s" : "";
+}
+
 std::filesystem::path Collector::set_work_path(const std::optional<std::filesystem::path>& provided_work_path) {
     fs::path res;
 
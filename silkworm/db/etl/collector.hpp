@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <functional>
@@ -53,24 +54,33 @@ class Collector {
         const CollectorSettings& settings)
         : work_path_managed_{false},
           work_path_{settings.work_path},
-          buffer_{settings.buffer_size} {};
-    explicit Collector(const std::filesystem::path& work_path, size_t buffer_size = kOptimalBufferSize)
-        : work_path_managed_{false}, work_path_{set_work_path(work_path)}, buffer_{buffer_size} {}
+          buffer_{settings.buffer_size},
+          compress_files_{settings.compress_files} {};
+    explicit Collector(const std::filesystem::path& work_path, size_t buffer_size = kOptimalBufferSize,
+                       bool compress_files = false)
+        : work_path_managed_{false},
+          work_path_{set_work_path(work_path)},
+          buffer_{buffer_size},
+          compress_files_{compress_files} {}
     explicit Collector(size_t buffer_size = kOptimalBufferSize)
         : work_path_managed_{true}, work_path_{set_work_path(std::nullopt)}, buffer_{buffer_size} {}
 
     ~Collector();
 
     // Store key-value pair in memory or on disk
-    void collect(Entry entry);
+    void collect(const Entry& entry);
 
-    // Store key & value in memory or on disk
-    void collect(Bytes key, Bytes value);
+    // Store key & value in memory or on disk (copied, no need to build an Entry)
+    void collect(ByteView key, ByteView value);
 
     //! \brief Loads and optionally transforms collected entries into db
     //! \param [in] load_func : Pointer to function transforming collected entries
     void load(const LoadFunc& load_func);
 
+    //! \brief Takes over all the entries collected by other collector, which is left empty
+    //! \remarks Files flushed by other stay in its work path, hence other must not use a managed temporary work path
+    void merge(Collector& other);
+
     //! \brief Returns the number of actually collected items
     [[nodiscard]] size_t size() const { return size_; }
 
@@ -94,6 +104,12 @@ class Collector {
         return loading_key_;
     }
 
+    //! \brief Returns the human-readable rate of loaded data in current load (for progress tracking)
+    [[nodiscard]] std::string get_load_throughput() const {
+        std::unique_lock l{mutex_};
+        return load_throughput_;
+    }
+
   private:
     static std::filesystem::path set_work_path(const std::optional<std::filesystem::path>& provided_work_path);
 
@@ -104,9 +120,12 @@ class Collector {
         loading_key_ = to_hex(key, true);
     }
 
+    void set_load_throughput(size_t loaded_bytes, std::chrono::steady_clock::duration elapsed);
+
     bool work_path_managed_;
     std::filesystem::path work_path_;
     Buffer buffer_;
+    bool compress_files_{false};
 
     /*
      * TL;DR; In no way two instances of collector can have
@@ -126,6 +145,7 @@ class Collector {
     size_t bytes_size_{0};                                       // Count of total collected bytes
     mutable std::mutex mutex_{};                                 // To sync loading_key_
     std::string loading_key_{};                                  // Actual load key (for log purposes)
+    std::string load_throughput_{};                              // Actual load rate (for log purposes)
 };
 
 }  // namespace silkworm::db::etl
@@ -0,0 +1,46 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+
+#include "collector.hpp"
+
+namespace silkworm::db::etl {
+
+static void benchmark_collect_and_load(benchmark::State& state) {
+    const auto count{static_cast<uint64_t>(state.range(0))};
+    Bytes value(8, '\0');
+
+    for ([[maybe_unused]] auto _ : state) {
+        Collector collector{kOptimalBufferSize};
+        for (uint64_t i{0}; i < count; ++i) {
+            endian::store_big_u64(value.data(), i);
+            const ethash::hash256 key{keccak256(value)};
+            collector.collect(key.bytes, value);
+        }
+        size_t loaded{0};
+        collector.load([&loaded](const Entry& entry) { loaded += entry.size(); });
+        benchmark::DoNotOptimize(loaded);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(benchmark_collect_and_load)->Arg(100'000)->Arg(1'000'000);
+
+}  // namespace silkworm::db::etl
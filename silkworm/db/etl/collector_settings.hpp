@@ -23,6 +23,7 @@ namespace silkworm::db::etl {
 struct CollectorSettings {
     std::filesystem::path work_path;
     size_t buffer_size{};
+    bool compress_files{false};  // Whether to compress flushed files
 };
 
 }  // namespace silkworm::db::etl
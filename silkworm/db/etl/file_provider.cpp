@@ -16,6 +16,9 @@
 
 #include "file_provider.hpp"
 
+#include <snappy.h>
+
+#include <cstring>
 #include <filesystem>
 
 #include <silkworm/core/common/bytes_to_string.hpp>
@@ -26,7 +29,8 @@ namespace silkworm::db::etl {
 namespace fs = std::filesystem;
 
 // https://abseil.io/tips/117
-FileProvider::FileProvider(std::string file_name, size_t id) : id_{id}, file_name_{std::move(file_name)} {}
+FileProvider::FileProvider(std::string file_name, size_t id, bool compressed)
+    : id_{id}, compressed_{compressed}, file_name_{std::move(file_name)} {}
 
 FileProvider::~FileProvider() { reset(); }
 
@@ -34,7 +38,6 @@ void FileProvider::flush(Buffer& buffer) {
     head_t head{};
 
     // Check we have enough space to store all data
-    auto entries{buffer.entries()};
     file_size_ = buffer.size();
     fs::path workdir(fs::path(file_name_).parent_path());
     if (fs::space(workdir).available < file_size_) {
@@ -49,17 +52,24 @@ void FileProvider::flush(Buffer& buffer) {
         throw etl_error(safe_strerror(errno));
     }
 
-    for (const auto& entry : entries) {
-        head.lengths[0] = static_cast<uint32_t>(entry.key.size());
-        head.lengths[1] = static_cast<uint32_t>(entry.value.size());
-        if (!file_.write(byte_ptr_cast(head.bytes), 8) ||
-            !file_.write(byte_ptr_cast(entry.key.data()), static_cast<std::streamsize>(entry.key.size())) ||
-            !file_.write(byte_ptr_cast(entry.value.data()), static_cast<std::streamsize>(entry.value.size()))) {
-            auto err{errno};
-            reset();
-            throw etl_error(safe_strerror(err));
+    file_size_ = 0;
+    Bytes block;
+    block.reserve(kFileBlockSize + sizeof(head_t));
+    for (size_t i{0}; i < buffer.entries_count(); ++i) {
+        const auto [key, value]{buffer.entry(i)};
+        head.lengths[0] = static_cast<uint32_t>(key.size());
+        head.lengths[1] = static_cast<uint32_t>(value.size());
+        block.append(head.bytes, sizeof(head_t));
+        block.append(key.data(), key.size());
+        block.append(value.data(), value.size());
+        if (block.size() >= kFileBlockSize) {
+            write_block(block);
+            block.clear();
         }
     }
+    if (!block.empty()) {
+        write_block(block);
+    }
 
     // Close file in output mode and reopen for input mode
     // This is actually not strictly needed but amends an odd behavior on Windows
@@ -74,30 +84,105 @@ void FileProvider::flush(Buffer& buffer) {
     }
 }
 
-std::optional<std::pair<Entry, size_t>> FileProvider::read_entry() {
+void FileProvider::write_block(ByteView block) {
+    // Each block is preceded by its uncompressed and stored lengths
+    std::string compressed;
+    ByteView stored{block};
+    if (compressed_) {
+        snappy::Compress(byte_ptr_cast(block.data()), block.size(), &compressed);
+        stored = string_view_to_byte_view(compressed);
+    }
+
+    head_t head{};
+    head.lengths[0] = static_cast<uint32_t>(block.size());
+    head.lengths[1] = static_cast<uint32_t>(stored.size());
+    if (!file_.write(byte_ptr_cast(head.bytes), sizeof(head_t)) ||
+        !file_.write(byte_ptr_cast(stored.data()), static_cast<std::streamsize>(stored.size()))) {
+        auto err{errno};
+        reset();
+        throw etl_error(safe_strerror(err));
+    }
+    file_size_ += sizeof(head_t) + stored.size();
+}
+
+std::optional<Bytes> FileProvider::read_block() {
+    head_t head{};
+    if (!file_.read(byte_ptr_cast(head.bytes), sizeof(head_t))) {
+        return std::nullopt;
+    }
+
+    Bytes stored(head.lengths[1], '\0');
+    if (!file_.read(byte_ptr_cast(stored.data()), head.lengths[1])) {
+        throw etl_error(safe_strerror(errno));
+    }
+    if (!compressed_) {
+        return stored;
+    }
+
+    Bytes block(head.lengths[0], '\0');
+    if (!snappy::RawUncompress(byte_ptr_cast(stored.data()), stored.size(), byte_ptr_cast(block.data()))) {
+        throw etl_error("Invalid compressed block in " + file_name_);
+    }
+    return block;
+}
+
+std::optional<std::pair<Entry, size_t>> FileProvider::read_entry(ThreadPool* read_ahead_pool) {
     head_t head{};
 
     if (!file_.is_open() || !file_size_) {
         throw etl_error("Invalid file handle");
     }
 
-    if (!file_.read(byte_ptr_cast(head.bytes), 8)) {
-        reset();
-        return std::nullopt;
+    if (block_offset_ == block_.size()) {
+        std::optional<Bytes> block;
+        try {
+            block = next_block_.valid() ? next_block_.get() : read_block();
+        } catch (...) {
+            reset();
+            throw;
+        }
+        if (!block) {
+            reset();
+            return std::nullopt;
+        }
+        block_ = std::move(*block);
+        block_offset_ = 0;
+
+        // Read ahead next block while entries of the current one are consumed
+        if (read_ahead_pool) {
+            next_block_ = read_ahead_pool->submit([this]() { return read_block(); });
+        }
     }
 
-    Entry entry{Bytes(head.lengths[0], '\0'), Bytes(head.lengths[1], '\0')};
-    if (!file_.read(byte_ptr_cast(entry.key.data()), head.lengths[0]) ||
-        !file_.read(byte_ptr_cast(entry.value.data()), head.lengths[1])) {
-        auto err{errno};
+    if (block_.size() - block_offset_ < sizeof(head_t)) {
         reset();
-        throw etl_error(safe_strerror(err));
+        throw etl_error("Truncated entry in " + file_name_);
+    }
+    std::memcpy(head.bytes, &block_[block_offset_], sizeof(head_t));
+    block_offset_ += sizeof(head_t);
+    if (block_.size() - block_offset_ < size_t{head.lengths[0]} + head.lengths[1]) {
+        reset();
+        throw etl_error("Truncated entry in " + file_name_);
     }
 
-    return std::make_pair(entry, id_);
+    Entry entry{block_.substr(block_offset_, head.lengths[0]),
+                block_.substr(block_offset_ + head.lengths[0], head.lengths[1])};
+    block_offset_ += size_t{head.lengths[0]} + head.lengths[1];
+
+    return std::make_pair(std::move(entry), id_);
+}
+
+void FileProvider::wait_for_pending_read() noexcept {
+    if (next_block_.valid()) {
+        next_block_.wait();
+        next_block_ = {};
+    }
 }
 
 void FileProvider::reset() {
+    wait_for_pending_read();
+    block_.clear();
+    block_offset_ = 0;
     file_size_ = 0;
     if (file_.is_open()) {
         file_.close();
@@ -17,35 +17,59 @@
 #pragma once
 
 #include <fstream>
+#include <future>
 #include <memory>
 #include <optional>
 
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+
 #include "buffer.hpp"
 #include "util.hpp"
 
 namespace silkworm::db::etl {
 
+inline constexpr size_t kFileBlockSize = 128_Kibi;  // Size of uncompressed data blocks in flushed files
+
 /**
  * Provides an abstraction to flush data to disk
  * and re-read flushed data sequentially
+ *
+ * Data is stored in blocks, optionally compressed with Snappy. While the entries of one block are being
+ * read, the next block can be read (and decompressed) in background by a thread pool shared among providers
  */
 class FileProvider {
   public:
-    FileProvider(std::string file_name, size_t id);
+    FileProvider(std::string file_name, size_t id, bool compressed = false);
     ~FileProvider();
 
-    void flush(Buffer& buffer);                            // Write buffer's contents to disk
-    std::optional<std::pair<Entry, size_t>> read_entry();  // Read next data element from file starting from position 0
-    void reset();                                          // Remove the file when eof is met
+    // Not copyable nor movable
+    FileProvider(const FileProvider&) = delete;
+    FileProvider& operator=(const FileProvider&) = delete;
+
+    void flush(Buffer& buffer);  // Write buffer's contents to disk
+    // Read next data element from file starting from position 0, reading the next block ahead in the pool if any
+    std::optional<std::pair<Entry, size_t>> read_entry(ThreadPool* read_ahead_pool = nullptr);
+    void reset();  // Remove the file when eof is met
 
     std::string get_file_name() const;
     size_t get_file_size() const;
+    void set_id(size_t id) { id_ = id; }  // Change the index returned along with read entries
 
   private:
+    void write_block(ByteView block);   // Write one (optionally compressed) block to file
+    std::optional<Bytes> read_block();  // Read next block from file, std::nullopt on eof
+    void wait_for_pending_read() noexcept;
+
     size_t id_;
+    bool compressed_;
     std::fstream file_;      // Actual file stream
     std::string file_name_;  // Actual name of file
     size_t file_size_{0};    // Actual size of written data
+
+    Bytes block_;                                   // Current block being read
+    size_t block_offset_{0};                        // Position of next entry in current block
+    std::future<std::optional<Bytes>> next_block_;  // Block being read ahead, owns file_ until ready
 };
 
 }  // namespace silkworm::db::etl
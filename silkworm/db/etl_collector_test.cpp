@@ -59,7 +59,7 @@ static std::vector<Entry> generate_entry_set(size_t size) {
     return pairs;
 }
 
-void run_collector_test(const etl_mdbx::LoadFunc& load_func, bool do_copy = true) {
+void run_collector_test(const etl_mdbx::LoadFunc& load_func, bool do_copy = true, bool compress_files = false) {
     db::test_util::TempChainData context;
 
     // Generate Test Entries
@@ -70,7 +70,7 @@ void run_collector_test(const etl_mdbx::LoadFunc& load_func, bool do_copy = true
     }
 
     // expect 10 files
-    etl_mdbx::Collector collector{context.dir().etl().path(), generated_size / 10};
+    etl_mdbx::Collector collector{context.dir().etl().path(), generated_size / 10, compress_files};
 
     // Collection
     for (auto&& entry : set) {
@@ -119,4 +119,47 @@ TEST_CASE("collect_and_load") {
     });
 }
 
+TEST_CASE("collect_and_load_compressed") {
+    SetLogVerbosityGuard log_guard{log::Level::kNone};
+    Bytes previous_key;
+    size_t loaded_count{0};
+    run_collector_test(
+        [&](const Entry& entry, auto& table, MDBX_put_flags_t) {
+            CHECK(previous_key < entry.key);
+            previous_key = entry.key;
+            ++loaded_count;
+            table.upsert(db::to_slice(entry.key), db::to_slice(entry.value));
+        },
+        /*do_copy=*/true, /*compress_files=*/true);
+    CHECK(loaded_count == 1000);
+}
+
+TEST_CASE("collect_merge_and_load") {
+    SetLogVerbosityGuard log_guard{log::Level::kNone};
+    db::test_util::TempChainData context;
+
+    auto set{generate_entry_set(1000)};
+    etl_mdbx::Collector collector{context.dir().etl().path(), 1_Kibi};
+    etl_mdbx::Collector other{context.dir().etl().path(), 1_Kibi};
+    for (size_t i{0}; i < set.size(); ++i) {
+        (i % 2 ? collector : other).collect(set[i]);
+    }
+
+    collector.merge(other);
+    CHECK(other.empty());
+    CHECK(collector.size() == set.size());
+
+    Bytes previous_key;
+    size_t loaded_count{0};
+    db::PooledCursor to{context.rw_txn(), db::table::kHeaderNumbers};
+    collector.load(to, [&](const Entry& entry, auto& table, MDBX_put_flags_t) {
+        CHECK(previous_key < entry.key);
+        previous_key = entry.key;
+        ++loaded_count;
+        table.upsert(db::to_slice(entry.key), db::to_slice(entry.value));
+    });
+    CHECK(loaded_count == set.size());
+    CHECK(std::distance(fs::directory_iterator{context.dir().etl().path()}, fs::directory_iterator{}) == 0);
+}
+
 }  // namespace silkworm::db::etl
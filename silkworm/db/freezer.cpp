@@ -16,9 +16,12 @@
 
 #include "freezer.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <filesystem>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include <vector>
 
 #include <silkworm/core/common/base.hpp>
@@ -27,16 +30,63 @@
 #include "bodies/body_snapshot_freezer.hpp"
 #include "headers/header_snapshot_freezer.hpp"
 #include "prune_mode.hpp"
+#include "receipts/receipt_snapshot_freezer.hpp"
 #include "snapshot_freezer.hpp"
 #include "snapshots/path.hpp"
 #include "snapshots/snapshot_bundle.hpp"
 #include "snapshots/snapshot_writer.hpp"
+#include "stages.hpp"
 #include "transactions/txn_snapshot_freezer.hpp"
 
 namespace silkworm::db {
 
 using namespace silkworm::snapshots;
 
+struct Freezer::StreamingState {
+    SnapshotBundle bundle;
+    std::vector<SnapshotFileWriter> file_writers;
+    BlockNum next_block;
+    uint64_t next_base_txn_id;
+
+    StreamingState(SnapshotBundle bundle1, const std::filesystem::path& tmp_dir_path, uint64_t base_txn_id)
+        : bundle(std::move(bundle1)),
+          next_block(bundle.block_from()),
+          next_base_txn_id(base_txn_id) {
+        for (auto& snapshot_ref : bundle.snapshots()) {
+            file_writers.emplace_back(snapshot_ref.get().path(), tmp_dir_path);
+        }
+    }
+};
+
+Freezer::Freezer(
+    db::RWAccess db_access,
+    snapshots::SnapshotRepository& snapshots,
+    std::filesystem::path tmp_dir_path,
+    bool streaming)
+    : db_access_(std::move(db_access)),
+      snapshots_(snapshots),
+      tmp_dir_path_(std::move(tmp_dir_path)),
+      streaming_(streaming) {
+    // Only streaming leaves partial segment files behind, tmp_dir_path may be shared with other components
+    if (streaming_) {
+        remove_partial_segment_files();
+    }
+}
+
+Freezer::~Freezer() = default;
+
+void Freezer::remove_partial_segment_files() {
+    // The chunk being streamed is not persisted: drop its raw words and intermediate files, it will be streamed again
+    std::error_code ec;
+    if (!std::filesystem::is_directory(tmp_dir_path_, ec)) return;
+    for (const auto& entry : std::filesystem::directory_iterator{tmp_dir_path_}) {
+        const std::string filename = entry.path().filename().string();
+        if (filename.ends_with(".seg.idt") || filename.ends_with(".seg.tmp.tmp")) {
+            std::filesystem::remove(entry.path());
+        }
+    }
+}
+
 struct FreezerResult : public DataMigrationResult {
     SnapshotBundle bundle;
 
@@ -61,16 +111,36 @@ static std::optional<uint64_t> get_next_base_txn_id(BlockNum number) {
     return body->base_txn_id + body->txn_count;
 }
 
+//! The end of the blocks which can be frozen: final blocks whose receipts and logs have been fully processed
+static BlockNum get_freezable_end(ROTxn& txn) {
+    const BlockNum tip = get_tip_num(txn);
+    const BlockNum final_end = (tip > kFullImmutabilityThreshold) ? tip - kFullImmutabilityThreshold : 0;
+    // Cleanup prunes the receipts and logs, so they must have been written by Execution and indexed by LogIndex
+    const BlockNum processed = std::min(stages::read_stage_progress(txn, stages::kExecutionKey),
+                                        stages::read_stage_progress(txn, stages::kLogIndexKey));
+    return std::min(final_end, processed + 1);
+}
+
 std::unique_ptr<DataMigrationCommand> Freezer::next_command() {
+    const BlockNum freezable_end = [this] {
+        auto db_tx = db_access_.start_ro_tx();
+        return get_freezable_end(db_tx);
+    }();
+
+    // Continue the chunk being streamed, if any
+    if (streaming_state_) {
+        const BlockNum start = streaming_state_->next_block;
+        const BlockNum end = std::min<BlockNum>({streaming_state_->bundle.block_to(), freezable_end, start + kStreamBatchSize});
+        if (start < end) {
+            return std::make_unique<FreezerCommand>(FreezerCommand{{start, end}, streaming_state_->next_base_txn_id});
+        }
+        return {};
+    }
+
     BlockNum last_frozen = snapshots_.max_block_available();
     BlockNum start = (last_frozen > 0) ? last_frozen + 1 : 0;
     BlockNum end = start + kChunkSize;
 
-    BlockNum tip = [this] {
-        auto db_tx = db_access_.start_ro_tx();
-        return get_tip_num(db_tx);
-    }();
-
     uint64_t base_txn_id = [last_frozen]() -> uint64_t {
         if (last_frozen == 0) return 0;
         auto id = get_next_base_txn_id(last_frozen);
@@ -78,24 +148,40 @@ std::unique_ptr<DataMigrationCommand> Freezer::next_command() {
         return *id;
     }();
 
-    if (end + kFullImmutabilityThreshold <= tip) {
+    if (streaming_) {
+        // Stream the final blocks of a new chunk
+        end = std::min<BlockNum>({end, freezable_end, start + kStreamBatchSize});
+        if (start < end) {
+            return std::make_unique<FreezerCommand>(FreezerCommand{{start, end}, base_txn_id});
+        }
+        return {};
+    }
+
+    if (end <= freezable_end) {
         return std::make_unique<FreezerCommand>(FreezerCommand{{start, end}, base_txn_id});
     }
     return {};
 }
 
+static const BodySnapshotFreezer& get_body_snapshot_freezer() {
+    static BodySnapshotFreezer body_snapshot_freezer;
+    return body_snapshot_freezer;
+}
+
 static const SnapshotFreezer& get_snapshot_freezer(SnapshotType type) {
     static HeaderSnapshotFreezer header_snapshot_freezer;
-    static BodySnapshotFreezer body_snapshot_freezer;
     static TransactionSnapshotFreezer txn_snapshot_freezer;
+    static ReceiptSnapshotFreezer receipt_snapshot_freezer;
 
     switch (type) {
         case SnapshotType::headers:
             return header_snapshot_freezer;
         case SnapshotType::bodies:
-            return body_snapshot_freezer;
+            return get_body_snapshot_freezer();
         case SnapshotType::transactions:
             return txn_snapshot_freezer;
+        case SnapshotType::receipts:
+            return receipt_snapshot_freezer;
         default:
             assert(false);
             throw std::runtime_error("invalid type");
@@ -104,6 +190,9 @@ static const SnapshotFreezer& get_snapshot_freezer(SnapshotType type) {
 
 std::shared_ptr<DataMigrationResult> Freezer::migrate(std::unique_ptr<DataMigrationCommand> command) {
     auto& freezer_command = dynamic_cast<FreezerCommand&>(*command);
+    if (streaming_) {
+        return migrate_streaming(freezer_command);
+    }
     auto range = freezer_command.range;
 
     auto bundle = snapshots_.bundle_factory().make(tmp_dir_path_, range);
@@ -121,6 +210,40 @@ std::shared_ptr<DataMigrationResult> Freezer::migrate(std::unique_ptr<DataMigrat
     return std::make_shared<FreezerResult>(std::move(bundle));
 }
 
+std::shared_ptr<DataMigrationResult> Freezer::migrate_streaming(const FreezerCommand& command) {
+    if (!streaming_state_) {
+        BlockNumRange chunk{command.range.first, command.range.first + kChunkSize};
+        auto bundle = snapshots_.bundle_factory().make(tmp_dir_path_, chunk);
+        streaming_state_ = std::make_unique<StreamingState>(std::move(bundle), tmp_dir_path_, command.base_txn_id);
+    }
+    auto& state = *streaming_state_;
+
+    // Append the new final blocks to the raw words of each segment under a short read transaction
+    {
+        auto db_tx = db_access_.start_ro_tx();
+        for (auto& file_writer : state.file_writers) {
+            const SnapshotType type = file_writer.path().type();
+            if (type == SnapshotType::bodies) {
+                state.next_base_txn_id = get_body_snapshot_freezer().copy_bodies(db_tx, command, file_writer);
+            } else {
+                get_snapshot_freezer(type).copy(db_tx, command, file_writer);
+            }
+        }
+    }
+    state.next_block = command.range.second;
+    if (state.next_block < state.bundle.block_to()) {
+        return {};
+    }
+
+    // The chunk is complete: seal its segments
+    for (auto& file_writer : state.file_writers) {
+        SnapshotFileWriter::flush(std::move(file_writer));
+    }
+    auto result = std::make_shared<FreezerResult>(std::move(state.bundle));
+    streaming_state_.reset();
+    return result;
+}
+
 void Freezer::index(std::shared_ptr<DataMigrationResult> result) {
     auto& freezer_result = dynamic_cast<FreezerResult&>(*result);
     auto& bundle = freezer_result.bundle;
@@ -166,16 +289,30 @@ BlockNumRange Freezer::cleanup_range() {
     return BlockNumRange{start, end};
 }
 
+void Freezer::cleanup_receipts(RWTxn& db_tx, BlockNumRange range) {
+    // Receipts and logs stay in the database for the blocks frozen without them (e.g. downloaded snapshots)
+    for (const SnapshotBundle& bundle : snapshots_.view_bundles()) {
+        if (!bundle.has_receipts()) continue;
+        BlockNumRange frozen_range{std::max(range.first, bundle.block_from()), std::min(range.second, bundle.block_to())};
+        if (frozen_range.first < frozen_range.second) {
+            get_snapshot_freezer(SnapshotType::receipts).cleanup(db_tx, frozen_range);
+        }
+    }
+}
+
 void Freezer::cleanup() {
     BlockNumRange range = cleanup_range();
-    if (range.first >= range.second) return;
-
-    // TODO
-    RWTxnManaged db_tx;
 
-    get_snapshot_freezer(SnapshotType::transactions).cleanup(db_tx, range);
-    get_snapshot_freezer(SnapshotType::bodies).cleanup(db_tx, range);
-    get_snapshot_freezer(SnapshotType::headers).cleanup(db_tx, range);
+    // Prune in small write transactions to avoid long writer locks and large commits
+    for (BlockNum start = range.first; start < range.second; start += kCleanupBatchSize) {
+        BlockNumRange batch{start, std::min<BlockNum>(start + kCleanupBatchSize, range.second)};
+        auto db_tx = db_access_.start_rw_tx();
+        cleanup_receipts(db_tx, batch);
+        get_snapshot_freezer(SnapshotType::transactions).cleanup(db_tx, batch);
+        get_snapshot_freezer(SnapshotType::bodies).cleanup(db_tx, batch);
+        get_snapshot_freezer(SnapshotType::headers).cleanup(db_tx, batch);
+        db_tx.commit_and_stop();
+    }
 }
 
 }  // namespace silkworm::db
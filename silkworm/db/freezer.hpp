@@ -16,35 +16,58 @@
 
 #pragma once
 
+#include <filesystem>
+#include <memory>
+
 #include "data_migration.hpp"
 #include "mdbx/mdbx.hpp"
 #include "snapshots/repository.hpp"
 
 namespace silkworm::db {
 
+struct FreezerCommand;
+
+//! Moves the final blocks from the database into snapshots, one chunk of blocks at a time, and prunes them
+//! \details In streaming mode the blocks are appended to the segments of the current chunk as soon as they are final,
+//! a few at a time, and the segments are compressed and indexed when the chunk is complete. Otherwise, each chunk is
+//! copied all at once when all its blocks are final. Blocks are final only once processed by Execution and LogIndex,
+//! because their receipts and logs get frozen and pruned along with them.
 class Freezer : public DataMigration {
   public:
     Freezer(
-        db::ROAccess db_access,
+        db::RWAccess db_access,
         snapshots::SnapshotRepository& snapshots,
-        std::filesystem::path tmp_dir_path)
-        : db_access_(std::move(db_access)),
-          snapshots_(snapshots),
-          tmp_dir_path_(std::move(tmp_dir_path)) {}
+        std::filesystem::path tmp_dir_path,
+        bool streaming = false);
+    ~Freezer() override;
 
   private:
     static constexpr size_t kChunkSize = 1000;
+    //! Max number of blocks copied under one read transaction in streaming mode
+    static constexpr size_t kStreamBatchSize = 100;
+    //! Max number of blocks pruned by one write transaction
+    static constexpr size_t kCleanupBatchSize = 100;
+
+    //! The chunk being frozen in streaming mode
+    struct StreamingState;
+
+    //! Removes the files left by a chunk that was being streamed when the node stopped
+    void remove_partial_segment_files();
 
     std::unique_ptr<DataMigrationCommand> next_command() override;
     std::shared_ptr<DataMigrationResult> migrate(std::unique_ptr<DataMigrationCommand> command) override;
+    std::shared_ptr<DataMigrationResult> migrate_streaming(const FreezerCommand& command);
     void index(std::shared_ptr<DataMigrationResult> result) override;
     void commit(std::shared_ptr<DataMigrationResult> result) override;
     void cleanup() override;
+    void cleanup_receipts(RWTxn& db_tx, BlockNumRange range);
     BlockNumRange cleanup_range();
 
-    db::ROAccess db_access_;
+    db::RWAccess db_access_;
     snapshots::SnapshotRepository& snapshots_;
     std::filesystem::path tmp_dir_path_;
+    bool streaming_;
+    std::unique_ptr<StreamingState> streaming_state_;
 };
 
 }  // namespace silkworm::db
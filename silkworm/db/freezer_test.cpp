@@ -0,0 +1,191 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "freezer.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/prune_mode.hpp>
+#include <silkworm/db/snapshot_bundle_factory_impl.hpp>
+#include <silkworm/db/snapshots/path.hpp>
+#include <silkworm/db/stages.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/db/util.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+
+namespace silkworm::db {
+
+using namespace snapshots;
+using namespace silkworm::test_util;
+
+//! Number of blocks frozen together, see Freezer::kChunkSize
+static constexpr BlockNum kTestChunkSize{1000};
+
+static void set_processed_block(RWTxn& txn, BlockNum number) {
+    stages::write_stage_progress(txn, stages::kExecutionKey, number);
+    stages::write_stage_progress(txn, stages::kLogIndexKey, number);
+}
+
+static void populate_blocks(RWTxn& txn, BlockNum count) {
+    evmc::bytes32 parent_hash;
+    for (BlockNum number = 0; number < count; ++number) {
+        BlockHeader header;
+        header.number = number;
+        header.parent_hash = parent_hash;
+        const auto hash = header.hash();
+        write_header(txn, header, /*with_header_numbers=*/true);
+        write_canonical_hash(txn, number, hash);
+        write_body(txn, BlockBody{}, hash, number);
+        txn.rw_cursor(table::kBlockReceipts)->upsert(to_slice(block_key(number)), to_slice(*from_hex("f6")));
+        parent_hash = hash;
+    }
+    // Make the whole first chunk final and processed
+    write_canonical_hash(txn, kTestChunkSize + kFullImmutabilityThreshold, evmc::bytes32{1});
+    set_processed_block(txn, count - 1);
+}
+
+static bool has_partial_segment_files(const std::filesystem::path& dir_path) {
+    for (const auto& entry : std::filesystem::directory_iterator{dir_path}) {
+        const std::string filename = entry.path().filename().string();
+        if (filename.ends_with(".seg.idt") || filename.ends_with(".seg.tmp.tmp")) return true;
+    }
+    return false;
+}
+
+struct FreezerTest {
+    FreezerTest() {
+        populate_blocks(context.rw_txn(), kTestChunkSize);
+        context.commit_txn();
+    }
+
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    db::test_util::TempChainData context;
+    TemporaryDirectory repository_dir;
+    TemporaryDirectory tmp_dir;
+    SnapshotRepository repository{
+        SnapshotSettings{
+            .repository_dir = repository_dir.path(),
+            .no_downloader = true,
+            .bittorrent_settings = bittorrent::BitTorrentSettings{
+                .repository_path = repository_dir.path() / bittorrent::BitTorrentSettings::kDefaultTorrentRepoPath,
+            },
+        },
+        std::make_unique<db::SnapshotBundleFactoryImpl>()};
+};
+
+static void check_chunk_frozen_and_pruned(FreezerTest& test) {
+    CHECK(test.repository.max_block_available() == kTestChunkSize - 1);
+    CHECK(SnapshotPath::from(test.repository_dir.path(), kSnapshotV1, 0, kTestChunkSize, SnapshotType::bodies).exists());
+
+    auto txn = ROTxnManaged{test.context.env()};
+    // Genesis is kept in the database, the other frozen blocks are pruned across several cleanup batches
+    CHECK(read_canonical_body_for_storage(txn, 0));
+    for (BlockNum number : {BlockNum{1}, BlockNum{150}, BlockNum{500}, kTestChunkSize - 1}) {
+        CHECK_FALSE(read_canonical_body_for_storage(txn, number));
+        const auto hash = read_canonical_hash(txn, number);
+        REQUIRE(hash);
+        CHECK_FALSE(read_header(txn, number, *hash));
+        CHECK_FALSE(txn.ro_cursor(table::kBlockReceipts)->find(to_slice(block_key(number)), /*throw_notfound=*/false));
+    }
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer: chunk copied at once", "[db][freezer]") {
+    Freezer freezer{RWAccess{context.env()}, repository, tmp_dir.path()};
+
+    freezer.run();
+    check_chunk_frozen_and_pruned(*this);
+    CHECK_FALSE(has_partial_segment_files(tmp_dir.path()));
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer: chunk streamed in batches", "[db][freezer]") {
+    Freezer freezer{RWAccess{context.env()}, repository, tmp_dir.path(), /*streaming=*/true};
+
+    // Each run appends one batch of final blocks to the segments of the chunk
+    for (size_t i = 0; i < 9; ++i) {
+        freezer.run();
+        CHECK(repository.max_block_available() == 0);
+        CHECK(has_partial_segment_files(tmp_dir.path()));
+    }
+    {
+        auto txn = ROTxnManaged{context.env()};
+        CHECK(read_canonical_body_for_storage(txn, 500));
+    }
+
+    // The last batch completes the chunk, which gets sealed, indexed, committed and pruned
+    freezer.run();
+    check_chunk_frozen_and_pruned(*this);
+    CHECK_FALSE(has_partial_segment_files(tmp_dir.path()));
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer: chunk waits for Execution and LogIndex", "[db][freezer]") {
+    {
+        RWTxnManaged txn{context.env()};
+        set_processed_block(txn, kTestChunkSize / 2);
+        stages::write_stage_progress(txn, stages::kExecutionKey, kTestChunkSize - 1);
+        txn.commit_and_stop();
+    }
+    Freezer freezer{RWAccess{context.env()}, repository, tmp_dir.path()};
+
+    // Receipts and logs of the chunk are not fully processed by LogIndex yet
+    freezer.run();
+    CHECK(repository.max_block_available() == 0);
+    {
+        auto txn = ROTxnManaged{context.env()};
+        CHECK(txn.ro_cursor(table::kBlockReceipts)->find(to_slice(block_key(1)), /*throw_notfound=*/false));
+    }
+
+    {
+        RWTxnManaged txn{context.env()};
+        set_processed_block(txn, kTestChunkSize - 1);
+        txn.commit_and_stop();
+    }
+    freezer.run();
+    check_chunk_frozen_and_pruned(*this);
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer: partial segment files removed at startup only when streaming", "[db][freezer]") {
+    const auto raw_words_path = tmp_dir.path() / "v1-000000-000010-headers.seg.idt";
+    const auto intermediate_path = tmp_dir.path() / "v1-000000-000010-headers.seg.tmp.tmp";
+    const auto other_path = tmp_dir.path() / "other.tmp";
+    for (const auto& path : {raw_words_path, intermediate_path, other_path}) {
+        std::ofstream{path} << "partial";
+    }
+
+    SECTION("streaming") {
+        Freezer freezer{RWAccess{context.env()}, repository, tmp_dir.path(), /*streaming=*/true};
+        CHECK_FALSE(std::filesystem::exists(raw_words_path));
+        CHECK_FALSE(std::filesystem::exists(intermediate_path));
+        CHECK(std::filesystem::exists(other_path));
+    }
+
+    SECTION("not streaming") {
+        Freezer freezer{RWAccess{context.env()}, repository, tmp_dir.path(), /*streaming=*/false};
+        CHECK(std::filesystem::exists(raw_words_path));
+        CHECK(std::filesystem::exists(intermediate_path));
+        CHECK(std::filesystem::exists(other_path));
+    }
+}
+
+}  // namespace silkworm::db
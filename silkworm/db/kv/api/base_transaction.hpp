@@ -18,6 +18,7 @@
 
 #include <functional>
 
+#include "historical_state_cache.hpp"
 #include "state_cache.hpp"
 #include "transaction.hpp"
 
@@ -25,10 +26,19 @@ namespace silkworm::db::kv::api {
 
 class BaseTransaction : public Transaction {
   public:
-    explicit BaseTransaction(StateCache* state_cache) : state_cache_{state_cache} {}
+    explicit BaseTransaction(StateCache* state_cache, HistoricalStateCache* historical_state_cache = nullptr)
+        : state_cache_{state_cache},
+          historical_state_cache_{historical_state_cache},
+          historical_state_generation_{historical_state_cache ? historical_state_cache->generation() : 0} {}
 
     void set_state_cache_enabled(bool cache_enabled) override;
 
+    //! The cache of historical state values shared among transactions, if any
+    HistoricalStateCache* historical_state_cache() const { return historical_state_cache_; }
+
+    //! The generation of the historical state cache when this transaction started, i.e. before its data snapshot
+    uint64_t historical_state_generation() const { return historical_state_generation_; }
+
     Task<KeyValue> get(const std::string& table, ByteView key) override;
 
     Task<Bytes> get_one(const std::string& table, ByteView key) override;
@@ -44,6 +54,8 @@ class BaseTransaction : public Transaction {
     GetOneImpl get_one_impl_with_cache_{&BaseTransaction::get_one_impl_with_cache};
     GetOneImpl get_one_impl_{get_one_impl_no_cache_};
     StateCache* state_cache_;
+    HistoricalStateCache* historical_state_cache_;
+    uint64_t historical_state_generation_;
 };
 
 }  // namespace silkworm::db::kv::api
@@ -0,0 +1,99 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/container/node_hash_map.h>
+
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/common/bytes_to_string.hpp>
+
+namespace silkworm::db::kv::api {
+
+//! Key-value map bounded in size, evicting entries with the CLOCK (second chance) policy
+//! \remarks find can run concurrently under a shared lock because a hit just sets the entry reference bit (if not
+//! already set), all the other operations need an exclusive lock
+template <typename Value>
+class ClockCacheMap {
+  public:
+    explicit ClockCacheMap(std::size_t capacity) : capacity_{capacity > 0 ? capacity : 1} {}
+
+    //! Find the value for the given key marking the entry as recently used
+    const Value* find(ByteView key) const {
+        const auto it = entries_.find(byte_view_to_string_view(key));
+        if (it == entries_.end()) {
+            return nullptr;
+        }
+        // Avoid writing to the entry cache line when not needed
+        if (!it->second.referenced.load(std::memory_order_relaxed)) {
+            it->second.referenced.store(true, std::memory_order_relaxed);
+        }
+        return &it->second.value;
+    }
+
+    //! Get the value for the given key inserting a default one if missing, evicting another entry if full
+    //! \return the value and the evicted key, if any
+    std::pair<Value&, std::optional<std::string>> get_or_insert(ByteView key) {
+        auto [it, inserted] = entries_.try_emplace(std::string{byte_view_to_string_view(key)});
+        if (!inserted) {
+            return {it->second.value, std::nullopt};
+        }
+        if (slots_.size() < capacity_) {
+            slots_.push_back(&*it);
+            return {it->second.value, std::nullopt};
+        }
+        // Sweep the clock hand giving a second chance to the entries referenced since the last sweep
+        while (slots_[hand_]->second.referenced.load(std::memory_order_relaxed)) {
+            slots_[hand_]->second.referenced.store(false, std::memory_order_relaxed);
+            hand_ = (hand_ + 1) % capacity_;
+        }
+        std::string evicted_key = slots_[hand_]->first;
+        entries_.erase(evicted_key);
+        slots_[hand_] = &*it;
+        hand_ = (hand_ + 1) % capacity_;
+        return {it->second.value, std::move(evicted_key)};
+    }
+
+    void clear() {
+        entries_.clear();
+        slots_.clear();
+        hand_ = 0;
+    }
+
+    std::size_t size() const { return entries_.size(); }
+
+  private:
+    struct Entry {
+        Value value;
+        mutable std::atomic<bool> referenced{false};
+    };
+    using Entries = absl::node_hash_map<std::string, Entry>;
+
+    std::size_t capacity_;
+    Entries entries_;
+    //! Clock ring of entries, node-based entries keep their address stable
+    std::vector<typename Entries::value_type*> slots_;
+    std::size_t hand_{0};
+};
+
+}  // namespace silkworm::db::kv::api
@@ -0,0 +1,66 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "clock_cache_map.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::db::kv::api {
+
+TEST_CASE("ClockCacheMap", "[rpc][ethdb][kv][state_cache]") {
+    ClockCacheMap<int> map{2};
+    const Bytes key1{*from_hex("01")}, key2{*from_hex("02")}, key3{*from_hex("03")};
+
+    SECTION("find missing key") {
+        CHECK(map.find(key1) == nullptr);
+    }
+
+    SECTION("insert within capacity") {
+        map.get_or_insert(key1).first = 1;
+        auto [value, evicted] = map.get_or_insert(key2);
+        value = 2;
+        CHECK(!evicted.has_value());
+        CHECK(map.size() == 2);
+        REQUIRE(map.find(key1) != nullptr);
+        CHECK(*map.find(key1) == 1);
+    }
+
+    SECTION("evict not referenced entry first") {
+        map.get_or_insert(key1).first = 1;
+        map.get_or_insert(key2).first = 2;
+        CHECK(map.find(key1) != nullptr);  // key1 gets a second chance
+        auto [value, evicted] = map.get_or_insert(key3);
+        value = 3;
+        REQUIRE(evicted.has_value());
+        CHECK(string_to_bytes(*evicted) == key2);
+        CHECK(map.size() == 2);
+        CHECK(map.find(key1) != nullptr);
+        CHECK(map.find(key2) == nullptr);
+        CHECK(map.find(key3) != nullptr);
+    }
+
+    SECTION("clear") {
+        map.get_or_insert(key1);
+        map.clear();
+        CHECK(map.size() == 0);
+        CHECK(map.find(key1) == nullptr);
+    }
+}
+
+}  // namespace silkworm::db::kv::api
@@ -0,0 +1,148 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "historical_state_cache.hpp"
+
+#include <algorithm>
+
+#include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::db::kv::api {
+
+HistoricalStateCache::HistoricalStateCache(HistoricalCacheConfig config) : config_{config} {
+    if (config_.max_entries == 0) {
+        config_.max_entries = 1;
+    }
+}
+
+std::optional<Bytes> HistoricalStateCache::get(ByteView key, BlockNum block_number) {
+    std::scoped_lock lock{mutex_};
+    const auto key_it = entries_.find(byte_view_to_string_view(key));
+    if (key_it != entries_.end()) {
+        // The first interval ending at or after the block number is the only one which may contain it
+        const auto entry_it = key_it->second.lower_bound(block_number);
+        if (entry_it != key_it->second.end() && entry_it->second.from <= block_number) {
+            Entry& entry = entry_it->second;
+            lru_.splice(lru_.begin(), lru_, entry.lru_position);
+            ++hit_count_;
+            return entry.value;
+        }
+    }
+    ++miss_count_;
+    return std::nullopt;
+}
+
+void HistoricalStateCache::insert(ByteView key, BlockInterval interval, Bytes value, uint64_t generation) {
+    if (interval.from > interval.to) {
+        return;
+    }
+    std::scoped_lock lock{mutex_};
+    if (generation != generation_) {
+        SILK_DEBUG << "HistoricalStateCache::insert generation=" << generation << " outdated by " << generation_;
+        return;
+    }
+    const auto key_it = entries_.try_emplace(std::string{byte_view_to_string_view(key)}).first;
+    auto [entry_it, inserted] = key_it->second.try_emplace(interval.to);
+    Entry& entry = entry_it->second;
+    if (!inserted) {
+        // Same change block resolved again from another block number: just widen the known interval
+        entry.from = std::min(entry.from, interval.from);
+        lru_.splice(lru_.begin(), lru_, entry.lru_position);
+        return;
+    }
+    entry.from = interval.from;
+    entry.value = std::move(value);
+    lru_.emplace_front(&key_it->first, interval.to);
+    entry.lru_position = lru_.begin();
+    ++size_;
+    if (size_ > config_.max_entries) {
+        evict();
+    }
+}
+
+void HistoricalStateCache::unwind(BlockNum block_number) {
+    std::scoped_lock lock{mutex_};
+    ++generation_;
+    std::size_t removed_count{0};
+    for (auto key_it = entries_.begin(); key_it != entries_.end();) {
+        auto& intervals = key_it->second;
+        for (auto entry_it = intervals.lower_bound(block_number); entry_it != intervals.end();) {
+            lru_.erase(entry_it->second.lru_position);
+            entry_it = intervals.erase(entry_it);
+            ++removed_count;
+        }
+        if (intervals.empty()) {
+            entries_.erase(key_it++);
+        } else {
+            ++key_it;
+        }
+    }
+    size_ -= removed_count;
+    SILK_DEBUG << "HistoricalStateCache::unwind block_number=" << block_number << " removed=" << removed_count;
+}
+
+void HistoricalStateCache::on_new_block(const StateChangeSet& state_changes_set) {
+    // Unwinding to the lowest block is enough to drop whatever any higher unwind would drop
+    std::optional<BlockNum> unwind_block_number;
+    for (const auto& state_change : state_changes_set.state_changes) {
+        if (state_change.direction == Direction::kUnwind) {
+            unwind_block_number = std::min(unwind_block_number.value_or(state_change.block_height), state_change.block_height);
+        }
+    }
+    if (unwind_block_number) {
+        unwind(*unwind_block_number);
+    }
+}
+
+uint64_t HistoricalStateCache::generation() const {
+    std::scoped_lock lock{mutex_};
+    return generation_;
+}
+
+std::size_t HistoricalStateCache::size() const {
+    std::scoped_lock lock{mutex_};
+    return size_;
+}
+
+uint64_t HistoricalStateCache::hit_count() const {
+    std::scoped_lock lock{mutex_};
+    return hit_count_;
+}
+
+uint64_t HistoricalStateCache::miss_count() const {
+    std::scoped_lock lock{mutex_};
+    return miss_count_;
+}
+
+uint64_t HistoricalStateCache::eviction_count() const {
+    std::scoped_lock lock{mutex_};
+    return eviction_count_;
+}
+
+void HistoricalStateCache::evict() {
+    const auto [key, to] = lru_.back();
+    const auto key_it = entries_.find(*key);
+    lru_.pop_back();
+    key_it->second.erase(to);
+    if (key_it->second.empty()) {
+        entries_.erase(key_it);
+    }
+    --size_;
+    ++eviction_count_;
+}
+
+}  // namespace silkworm::db::kv::api
@@ -0,0 +1,108 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <absl/container/node_hash_map.h>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+
+#include "endpoint/state_change.hpp"
+
+namespace silkworm::db::kv::api {
+
+//! Closed interval of block numbers [from, to] in which a historical state value is valid
+struct BlockInterval {
+    BlockNum from{0};
+    BlockNum to{0};
+
+    [[nodiscard]] bool contains(BlockNum block_number) const { return from <= block_number && block_number <= to; }
+};
+
+struct HistoricalCacheConfig {
+    std::size_t max_entries{1'000'000};
+};
+
+//! Cache bounded in size of the historical state values resolved through history indices and change sets, which
+//! can be shared among any number of read transactions because each value is tagged with its block validity interval
+//! \details The value of a state key at block B is the one recorded in the change set of the first change block C >= B,
+//! so it stays the same for all the blocks after the previous change block P < B up to C. New blocks always come after
+//! C so they never split any cached interval, whilst unwinds can remove C and must invalidate the affected intervals.
+//! Entries are evicted in least-recently-used order.
+class HistoricalStateCache {
+  public:
+    explicit HistoricalStateCache(HistoricalCacheConfig config = {});
+
+    HistoricalStateCache(const HistoricalStateCache&) = delete;
+    HistoricalStateCache& operator=(const HistoricalStateCache&) = delete;
+
+    //! Get the value of the state key at the given block number, if cached
+    std::optional<Bytes> get(ByteView key, BlockNum block_number);
+
+    //! Insert the value of the state key which is valid in the given block interval, evicting the LRU entry if full
+    //! \param generation the cache generation when the reading transaction started: the value is dropped if any unwind
+    //! happened since then, because it could have been resolved from unwound change sets
+    void insert(ByteView key, BlockInterval interval, Bytes value, uint64_t generation);
+
+    //! Invalidate all the values whose validity interval reaches the given unwound block number
+    void unwind(BlockNum block_number);
+
+    //! Apply the unwinds of the given state changes
+    void on_new_block(const StateChangeSet& state_changes_set);
+
+    //! Number of unwinds applied so far
+    [[nodiscard]] uint64_t generation() const;
+
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] uint64_t hit_count() const;
+    [[nodiscard]] uint64_t miss_count() const;
+    [[nodiscard]] uint64_t eviction_count() const;
+
+  private:
+    struct Entry;
+    using IntervalMap = std::map<BlockNum, Entry>;  // Validity intervals of one key ordered by their upper bound
+    using LruList = std::list<std::pair<const std::string*, BlockNum>>;
+
+    struct Entry {
+        BlockNum from{0};
+        Bytes value;
+        LruList::iterator lru_position;
+    };
+
+    void evict();
+
+    HistoricalCacheConfig config_;
+    absl::node_hash_map<std::string, IntervalMap> entries_;
+    LruList lru_;  // Most recently used entries at the front
+    std::size_t size_{0};
+    uint64_t generation_{0};
+    uint64_t hit_count_{0};
+    uint64_t miss_count_{0};
+    uint64_t eviction_count_{0};
+    mutable std::mutex mutex_;
+};
+
+}  // namespace silkworm::db::kv::api
@@ -0,0 +1,137 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "historical_state_cache.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::db::kv::api {
+
+using namespace evmc::literals;  // NOLINT(build/namespaces_literals)
+
+static const evmc::address kHistoricalAddress1{0x68d7b1bcbb0b38ab4b6ee2b2e3e8f60c2d3d5e5f_address};
+static const evmc::address kHistoricalAddress2{0x0a6bb546b9208cfab9e8fa2b9b2c042b18df7030_address};
+
+TEST_CASE("HistoricalStateCache::get", "[db][kv][api][historical_state_cache]") {
+    HistoricalStateCache cache;
+    cache.insert(kHistoricalAddress1.bytes, {.from = 10, .to = 20}, *from_hex("0x0a"), cache.generation());
+    cache.insert(kHistoricalAddress1.bytes, {.from = 21, .to = 30}, *from_hex("0x0b"), cache.generation());
+
+    SECTION("hit inside validity interval") {
+        CHECK(cache.get(kHistoricalAddress1.bytes, 10) == *from_hex("0x0a"));
+        CHECK(cache.get(kHistoricalAddress1.bytes, 20) == *from_hex("0x0a"));
+        CHECK(cache.get(kHistoricalAddress1.bytes, 21) == *from_hex("0x0b"));
+        CHECK(cache.get(kHistoricalAddress1.bytes, 30) == *from_hex("0x0b"));
+        CHECK(cache.hit_count() == 4);
+        CHECK(cache.miss_count() == 0);
+    }
+
+    SECTION("miss outside validity intervals") {
+        CHECK(!cache.get(kHistoricalAddress1.bytes, 9));
+        CHECK(!cache.get(kHistoricalAddress1.bytes, 31));
+        CHECK(cache.hit_count() == 0);
+        CHECK(cache.miss_count() == 2);
+    }
+
+    SECTION("miss for unknown key") {
+        CHECK(!cache.get(kHistoricalAddress2.bytes, 15));
+        CHECK(cache.miss_count() == 1);
+    }
+
+    SECTION("interval widened for same change block") {
+        cache.insert(kHistoricalAddress1.bytes, {.from = 5, .to = 20}, *from_hex("0x0a"), cache.generation());
+        CHECK(cache.size() == 2);
+        CHECK(cache.get(kHistoricalAddress1.bytes, 5) == *from_hex("0x0a"));
+    }
+}
+
+TEST_CASE("HistoricalStateCache::insert", "[db][kv][api][historical_state_cache]") {
+    SECTION("invalid interval is ignored") {
+        HistoricalStateCache cache;
+        cache.insert(kHistoricalAddress1.bytes, {.from = 20, .to = 10}, *from_hex("0x0a"), cache.generation());
+        CHECK(cache.size() == 0);
+    }
+
+    SECTION("least recently used entry evicted when full") {
+        HistoricalStateCache cache{HistoricalCacheConfig{.max_entries = 2}};
+        cache.insert(kHistoricalAddress1.bytes, {.from = 10, .to = 20}, *from_hex("0x0a"), cache.generation());
+        cache.insert(kHistoricalAddress2.bytes, {.from = 10, .to = 20}, *from_hex("0x0b"), cache.generation());
+        CHECK(cache.get(kHistoricalAddress1.bytes, 15));
+        cache.insert(kHistoricalAddress1.bytes, {.from = 21, .to = 30}, *from_hex("0x0c"), cache.generation());
+        CHECK(cache.size() == 2);
+        CHECK(cache.eviction_count() == 1);
+        CHECK(cache.get(kHistoricalAddress1.bytes, 15) == *from_hex("0x0a"));
+        CHECK(cache.get(kHistoricalAddress1.bytes, 25) == *from_hex("0x0c"));
+        CHECK(!cache.get(kHistoricalAddress2.bytes, 15));
+    }
+}
+
+TEST_CASE("HistoricalStateCache::generation", "[db][kv][api][historical_state_cache]") {
+    HistoricalStateCache cache;
+    CHECK(cache.generation() == 0);
+
+    SECTION("value resolved before unwind is dropped") {
+        const auto generation{cache.generation()};
+        cache.unwind(30);
+        CHECK(cache.generation() == generation + 1);
+        cache.insert(kHistoricalAddress1.bytes, {.from = 21, .to = 30}, *from_hex("0x0b"), generation);
+        CHECK(cache.size() == 0);
+        CHECK(!cache.get(kHistoricalAddress1.bytes, 25));
+    }
+
+    SECTION("value resolved after unwind is inserted") {
+        cache.unwind(30);
+        cache.insert(kHistoricalAddress1.bytes, {.from = 21, .to = 30}, *from_hex("0x0b"), cache.generation());
+        CHECK(cache.size() == 1);
+        CHECK(cache.get(kHistoricalAddress1.bytes, 25) == *from_hex("0x0b"));
+    }
+}
+
+TEST_CASE("HistoricalStateCache::on_new_block", "[db][kv][api][historical_state_cache]") {
+    HistoricalStateCache cache;
+    cache.insert(kHistoricalAddress1.bytes, {.from = 10, .to = 20}, *from_hex("0x0a"), cache.generation());
+    cache.insert(kHistoricalAddress1.bytes, {.from = 21, .to = 30}, *from_hex("0x0b"), cache.generation());
+    cache.insert(kHistoricalAddress2.bytes, {.from = 25, .to = 40}, *from_hex("0x0c"), cache.generation());
+
+    SECTION("forward changes keep all values") {
+        cache.on_new_block(StateChangeSet{.state_changes = {{.direction = Direction::kForward, .block_height = 41}}});
+        CHECK(cache.size() == 3);
+    }
+
+    SECTION("unwind drops values valid up to unwound blocks") {
+        cache.on_new_block(StateChangeSet{.state_changes = {{.direction = Direction::kUnwind, .block_height = 30}}});
+        CHECK(cache.size() == 1);
+        CHECK(cache.get(kHistoricalAddress1.bytes, 15) == *from_hex("0x0a"));
+        CHECK(!cache.get(kHistoricalAddress1.bytes, 25));
+        CHECK(!cache.get(kHistoricalAddress2.bytes, 25));
+    }
+
+    SECTION("multiple unwinds are applied once from the lowest block") {
+        const uint64_t generation{cache.generation()};
+        cache.on_new_block(StateChangeSet{.state_changes = {
+                                              {.direction = Direction::kUnwind, .block_height = 30},
+                                              {.direction = Direction::kUnwind, .block_height = 20},
+                                              {.direction = Direction::kForward, .block_height = 21},
+                                          }});
+        CHECK(cache.generation() == generation + 1);
+        CHECK(cache.size() == 0);
+    }
+}
+
+}  // namespace silkworm::db::kv::api
@@ -0,0 +1,347 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "sharded_state_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+
+#include <magic_enum.hpp>
+
+#include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/types/address.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/util.hpp>
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::db::kv::api {
+
+ShardedStateView::ShardedStateView(Transaction& tx, ShardedStateCache* cache) : tx_(tx), cache_(cache) {}
+
+Task<std::optional<Bytes>> ShardedStateView::get(ByteView key) {
+    co_return co_await cache_->get(key, tx_);
+}
+
+Task<std::optional<Bytes>> ShardedStateView::get_code(ByteView key) {
+    co_return co_await cache_->get_code(key, tx_);
+}
+
+template <typename Shards, typename Counter>
+static uint64_t sum_counters(const Shards& shards, Counter counter) {
+    uint64_t total{0};
+    for (const auto& shard : shards) {
+        total += counter(*shard).load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+template <typename Shards>
+static std::size_t sum_sizes(const Shards& shards) {
+    std::size_t total{0};
+    for (const auto& shard : shards) {
+        std::shared_lock read_lock{shard->mutex};
+        total += shard->map.size();
+    }
+    return total;
+}
+
+ShardedStateCache::ShardedStateCache(CoherentCacheConfig config, std::size_t num_shards) : config_(config) {
+    if (config.max_views == 0) {
+        throw std::invalid_argument{"unexpected zero max_views"};
+    }
+    if (num_shards == 0) {
+        throw std::invalid_argument{"unexpected zero num_shards"};
+    }
+    const std::size_t max_state_keys_per_shard = (config.max_state_keys + num_shards - 1) / num_shards;
+    const std::size_t max_code_keys_per_shard = (config.max_code_keys + num_shards - 1) / num_shards;
+    state_shards_.reserve(num_shards);
+    code_shards_.reserve(num_shards);
+    for (std::size_t i{0}; i < num_shards; ++i) {
+        state_shards_.push_back(std::make_unique<StateShard>(max_state_keys_per_shard));
+        code_shards_.push_back(std::make_unique<CodeShard>(max_code_keys_per_shard));
+    }
+}
+
+std::unique_ptr<StateView> ShardedStateCache::get_view(Transaction& tx) {
+    std::shared_lock read_lock{window_mutex_};
+    return window_.contains(tx.view_id()) ? std::make_unique<ShardedStateView>(tx, this) : nullptr;
+}
+
+std::size_t ShardedStateCache::latest_data_size() {
+    return sum_sizes(state_shards_);
+}
+
+std::size_t ShardedStateCache::latest_code_size() {
+    return sum_sizes(code_shards_);
+}
+
+uint64_t ShardedStateCache::state_hit_count() const {
+    return sum_counters(state_shards_, [](const StateShard& shard) -> const auto& { return shard.hit_count; });
+}
+
+uint64_t ShardedStateCache::state_miss_count() const {
+    return sum_counters(state_shards_, [](const StateShard& shard) -> const auto& { return shard.miss_count; });
+}
+
+uint64_t ShardedStateCache::state_key_count() const {
+    return sum_sizes(state_shards_);
+}
+
+uint64_t ShardedStateCache::state_eviction_count() const {
+    return sum_counters(state_shards_, [](const StateShard& shard) -> const auto& { return shard.eviction_count; });
+}
+
+uint64_t ShardedStateCache::code_hit_count() const {
+    return sum_counters(code_shards_, [](const CodeShard& shard) -> const auto& { return shard.hit_count; });
+}
+
+uint64_t ShardedStateCache::code_miss_count() const {
+    return sum_counters(code_shards_, [](const CodeShard& shard) -> const auto& { return shard.miss_count; });
+}
+
+uint64_t ShardedStateCache::code_key_count() const {
+    return sum_sizes(code_shards_);
+}
+
+uint64_t ShardedStateCache::code_eviction_count() const {
+    return sum_counters(code_shards_, [](const CodeShard& shard) -> const auto& { return shard.eviction_count; });
+}
+
+void ShardedStateCache::on_new_block(const api::StateChangeSet& state_changes_set) {
+    if (state_changes_set.state_changes.empty()) {
+        SILK_WARN << "Unexpected empty batch received and skipped";
+        return;
+    }
+
+    std::vector<KeyValues> state_changes_by_shard(state_shards_.size());
+    std::vector<KeyValues> code_changes_by_shard(code_shards_.size());
+    collect_changes(state_changes_set, state_changes_by_shard, code_changes_by_shard);
+
+    std::scoped_lock update_lock{update_mutex_};
+
+    // Keep the previous views only if the new one follows the latest, otherwise (e.g. view ID wrapping) start over
+    const auto view_id = state_changes_set.state_version_id;
+    const bool continuous = window_.ready && view_id > window_.latest && view_id - window_.latest == 1;
+    StateViewWindow window{.oldest = view_id, .latest = view_id, .ready = true};
+    if (continuous) {
+        const StateViewId first_kept_view_id = view_id >= config_.max_views ? view_id - config_.max_views + 1 : 0;
+        window.oldest = std::max(window_.oldest, first_kept_view_id);
+    }
+
+    for (std::size_t i{0}; i < state_shards_.size(); ++i) {
+        update_state_shard(*state_shards_[i], window, continuous, state_changes_by_shard[i]);
+    }
+    for (std::size_t i{0}; i < code_shards_.size(); ++i) {
+        update_code_shard(*code_shards_[i], code_changes_by_shard[i]);
+    }
+
+    std::unique_lock write_lock{window_mutex_};
+    window_ = window;
+}
+
+void ShardedStateCache::collect_changes(const api::StateChangeSet& state_changes_set,
+                                        std::vector<KeyValues>& state_changes_by_shard,
+                                        std::vector<KeyValues>& code_changes_by_shard) const {
+    const auto add_state = [&](Bytes key, Bytes value) {
+        const auto index = shard_index(key);
+        state_changes_by_shard[index].emplace_back(std::move(key), std::move(value));
+    };
+    const auto add_code = [&](const Bytes& code) {
+        const ethash::hash256 code_hash{keccak256(code)};
+        Bytes code_hash_key{code_hash.bytes, kHashLength};
+        const auto index = shard_index(code_hash_key);
+        code_changes_by_shard[index].emplace_back(std::move(code_hash_key), code);
+    };
+
+    for (const auto& state_change : state_changes_set.state_changes) {
+        for (const auto& change : state_change.account_changes) {
+            const Bytes address_key{change.address.bytes, kAddressLength};
+            switch (change.change_type) {
+                case Action::kUpsert: {
+                    add_state(address_key, change.data);
+                    break;
+                }
+                case Action::kUpsertCode: {
+                    add_state(address_key, change.data);
+                    add_code(change.code);
+                    break;
+                }
+                case Action::kRemove: {
+                    add_state(address_key, {});
+                    break;
+                }
+                case Action::kStorage: {
+                    if (config_.with_storage) {
+                        for (const auto& storage_change : change.storage_changes) {
+                            auto storage_key = composite_storage_key(change.address, change.incarnation, storage_change.location.bytes);
+                            add_state(std::move(storage_key), storage_change.data);
+                        }
+                    }
+                    break;
+                }
+                case Action::kCode: {
+                    add_code(change.code);
+                    break;
+                }
+                default: {
+                    SILK_ERROR << "Unexpected action: " << magic_enum::enum_name(change.change_type) << " skipped";
+                }
+            }
+        }
+    }
+}
+
+void ShardedStateCache::prune_versions(StateVersions& versions, StateViewId oldest_view_id) {
+    const auto first_newer = std::find_if(versions.begin(), versions.end(), [&](const auto& version) {
+        return version.view_id > oldest_view_id;
+    });
+    if (first_newer - versions.begin() > 1) {
+        versions.erase(versions.begin(), first_newer - 1);
+    }
+}
+
+void ShardedStateCache::update_state_shard(StateShard& shard, const StateViewWindow& window, bool continuous, KeyValues& changes) {
+    std::unique_lock write_lock{shard.mutex};
+    if (!continuous) {
+        shard.map.clear();
+    }
+    shard.window = window;
+    for (auto& [key, value] : changes) {
+        auto [versions, evicted] = shard.map.get_or_insert(key);
+        if (evicted) {
+            shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (!versions.empty() && versions.back().view_id == window.latest) {
+            versions.back().value = std::move(value);
+        } else {
+            versions.push_back({window.latest, std::move(value)});
+        }
+        prune_versions(versions, window.oldest);
+    }
+}
+
+void ShardedStateCache::update_code_shard(CodeShard& shard, KeyValues& changes) {
+    if (changes.empty()) {
+        return;
+    }
+    std::unique_lock write_lock{shard.mutex};
+    for (auto& [key, value] : changes) {
+        auto [code, evicted] = shard.map.get_or_insert(key);
+        if (evicted) {
+            shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        code = std::move(value);
+    }
+}
+
+Task<std::optional<Bytes>> ShardedStateCache::get(ByteView key, Transaction& tx) {
+    const auto view_id = tx.view_id();
+    auto& shard = *state_shards_[shard_index(key)];
+
+    std::optional<Bytes> cached_value;
+    {
+        std::shared_lock read_lock{shard.mutex};
+        if (shard.window.contains(view_id)) {
+            if (const auto* versions = shard.map.find(key)) {
+                // The latest version not newer than the view is its value
+                const auto version_it = std::find_if(versions->rbegin(), versions->rend(), [&](const auto& version) {
+                    return version.view_id <= view_id;
+                });
+                if (version_it != versions->rend()) {
+                    cached_value = version_it->value;
+                }
+            }
+        }
+    }
+    if (cached_value) {
+        shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+        SILK_DEBUG << "Hit in state cache key=" << key << " value=" << *cached_value;
+        co_return cached_value;
+    }
+
+    shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+
+    auto value = co_await tx.get_one(db::table::kPlainStateName, key);
+    SILK_DEBUG << "Miss in state cache: lookup in PlainState key=" << key << " value=" << value;
+    if (value.empty()) {
+        co_return std::nullopt;
+    }
+
+    // Storage values are not kept up-to-date without storage changes
+    if (!config_.with_storage && key.size() != kAddressLength) {
+        co_return value;
+    }
+
+    std::unique_lock write_lock{shard.mutex};
+    if (shard.window.ready && shard.window.latest == view_id) {
+        auto [versions, evicted] = shard.map.get_or_insert(key);
+        if (evicted) {
+            shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (versions.empty() || versions.back().view_id < view_id) {
+            versions.push_back({view_id, value});
+            prune_versions(versions, shard.window.oldest);
+        }
+    }
+    write_lock.unlock();
+
+    co_return value;
+}
+
+Task<std::optional<Bytes>> ShardedStateCache::get_code(ByteView key, Transaction& tx) {
+    auto& shard = *code_shards_[shard_index(key)];
+
+    std::optional<Bytes> cached_code;
+    {
+        std::shared_lock read_lock{shard.mutex};
+        if (const auto* code = shard.map.find(key)) {
+            cached_code = *code;
+        }
+    }
+    if (cached_code) {
+        shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+        SILK_DEBUG << "Hit in code cache key=" << key << " value=" << *cached_code;
+        co_return cached_code;
+    }
+
+    shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+
+    auto value = co_await tx.get_one(db::table::kCodeName, key);
+    SILK_DEBUG << "Miss in code cache: lookup in Code key=" << key << " value=" << value;
+    if (value.empty()) {
+        co_return std::nullopt;
+    }
+
+    // Code is immutable by hash, so it can be cached whatever the view
+    std::unique_lock write_lock{shard.mutex};
+    auto [code, evicted] = shard.map.get_or_insert(key);
+    if (evicted) {
+        shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    code = value;
+    write_lock.unlock();
+
+    co_return value;
+}
+
+std::size_t ShardedStateCache::shard_index(ByteView key) const {
+    return std::hash<std::string_view>{}(byte_view_to_string_view(key)) % state_shards_.size();
+}
+
+}  // namespace silkworm::db::kv::api
@@ -0,0 +1,145 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+
+#include "clock_cache_map.hpp"
+#include "endpoint/state_change.hpp"
+#include "state_cache.hpp"
+#include "transaction.hpp"
+
+namespace silkworm::db::kv::api {
+
+constexpr auto kDefaultStateCacheShards{64u};
+
+//! Range of the state views kept in the cache
+struct StateViewWindow {
+    StateViewId oldest{0};
+    StateViewId latest{0};
+    bool ready{false};
+
+    bool contains(StateViewId view_id) const { return ready && oldest <= view_id && view_id <= latest; }
+};
+
+class ShardedStateCache;
+
+class ShardedStateView : public StateView {
+  public:
+    explicit ShardedStateView(Transaction& tx, ShardedStateCache* cache);
+
+    ShardedStateView(const ShardedStateView&) = delete;
+    ShardedStateView& operator=(const ShardedStateView&) = delete;
+
+    Task<std::optional<Bytes>> get(ByteView key) override;
+
+    Task<std::optional<Bytes>> get_code(ByteView key) override;
+
+  private:
+    Transaction& tx_;
+    ShardedStateCache* cache_;
+};
+
+//! Coherent state cache split in shards by key, each one with its own lock and CLOCK eviction
+//! \details Each state key keeps its values for the views in the window of the latest max_views ones, so new blocks
+//! do not copy the cache. Lookups take just the shared lock of one shard and never move entries on hit. Values read
+//! from the database are cached only if read at the latest view, because a previous view cannot tell whether the next
+//! ones changed them
+class ShardedStateCache : public StateCache {
+  public:
+    explicit ShardedStateCache(CoherentCacheConfig config = {}, std::size_t num_shards = kDefaultStateCacheShards);
+
+    ShardedStateCache(const ShardedStateCache&) = delete;
+    ShardedStateCache& operator=(const ShardedStateCache&) = delete;
+
+    std::unique_ptr<StateView> get_view(Transaction& tx) override;
+
+    void on_new_block(const api::StateChangeSet& state_changes) override;
+
+    std::size_t latest_data_size() override;
+    std::size_t latest_code_size() override;
+
+    uint64_t state_hit_count() const override;
+    uint64_t state_miss_count() const override;
+    uint64_t state_key_count() const override;
+    uint64_t state_eviction_count() const override;
+    uint64_t code_hit_count() const override;
+    uint64_t code_miss_count() const override;
+    uint64_t code_key_count() const override;
+    uint64_t code_eviction_count() const override;
+
+  private:
+    friend class ShardedStateView;
+
+    struct StateVersion {
+        StateViewId view_id{0};
+        Bytes value;
+    };
+    //! Values of one state key ordered by view
+    using StateVersions = std::vector<StateVersion>;
+
+    template <typename Value>
+    struct alignas(64) Shard {
+        explicit Shard(std::size_t capacity) : map{capacity} {}
+
+        mutable std::shared_mutex mutex;
+        ClockCacheMap<Value> map;
+        StateViewWindow window;  // Unused by code shards, code is immutable
+        std::atomic<uint64_t> hit_count{0};
+        std::atomic<uint64_t> miss_count{0};
+        std::atomic<uint64_t> eviction_count{0};
+    };
+    using StateShard = Shard<StateVersions>;
+    using CodeShard = Shard<Bytes>;
+
+    using KeyValues = std::vector<KeyValue>;
+
+    Task<std::optional<Bytes>> get(ByteView key, Transaction& tx);
+    Task<std::optional<Bytes>> get_code(ByteView key, Transaction& tx);
+    void collect_changes(const api::StateChangeSet& state_changes, std::vector<KeyValues>& state_changes_by_shard,
+                         std::vector<KeyValues>& code_changes_by_shard) const;
+    void update_state_shard(StateShard& shard, const StateViewWindow& window, bool continuous, KeyValues& changes);
+    static void update_code_shard(CodeShard& shard, KeyValues& changes);
+    //! Drop the versions no more visible from any view, i.e. older than the latest one visible from the oldest view
+    static void prune_versions(StateVersions& versions, StateViewId oldest_view_id);
+    std::size_t shard_index(ByteView key) const;
+
+    CoherentCacheConfig config_;
+    std::vector<std::unique_ptr<StateShard>> state_shards_;
+    std::vector<std::unique_ptr<CodeShard>> code_shards_;
+
+    //! Serializes the state change batches
+    std::mutex update_mutex_;
+    //! Window of the views fully applied to all the shards, the one of each shard is updated first
+    StateViewWindow window_;
+    mutable std::shared_mutex window_mutex_;
+};
+
+}  // namespace silkworm::db::kv::api
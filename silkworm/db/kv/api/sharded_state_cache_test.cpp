@@ -0,0 +1,209 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "sharded_state_cache.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <evmc/evmc.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/mock_transaction.hpp>
+#include <silkworm/infra/test_util/context_test_base.hpp>
+
+namespace silkworm::db::kv::api {
+
+using namespace evmc::literals;  // NOLINT(build/namespaces_literals)
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+
+static constexpr uint64_t kShardedTestViewId0{3'000'000};
+static constexpr uint64_t kShardedTestViewId1{3'000'001};
+
+static constexpr auto kShardedTestAddress1{0x0f572e5295c57f15886f9b263e2f6d2d6c7b5ec6_address};
+static constexpr auto kShardedTestAddress2{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address};
+static constexpr auto kShardedTestAddress3{0x326c977e6efc84e512bb9c30f76e30c160ed06fb_address};
+
+static const Bytes kShardedTestAccountData1{*from_hex("600035600055")};
+static const Bytes kShardedTestAccountData2{*from_hex("6000356000550055")};
+
+static const Bytes kShardedTestCode{*from_hex("602a6000556101c960015560068060166000396000f3600035600055")};
+
+static Bytes address_key(const evmc::address& address) {
+    return Bytes{address.bytes, kAddressLength};
+}
+
+static StateChangeSet make_batch(uint64_t view_id, AccountChangeSequence account_changes) {
+    StateChangeSet state_change_set;
+    state_change_set.state_version_id = view_id;
+    state_change_set.state_changes.emplace_back(StateChange{.account_changes = std::move(account_changes)});
+    return state_change_set;
+}
+
+static StateChangeSet make_upsert_batch(uint64_t view_id, const evmc::address& address, const Bytes& data) {
+    return make_batch(view_id, {AccountChange{.address = address, .change_type = Action::kUpsert, .data = data}});
+}
+
+struct ShardedStateCacheTest : public silkworm::test_util::ContextTestBase {
+    std::optional<Bytes> get(ShardedStateCache& cache, Transaction& txn, ByteView key) {
+        std::unique_ptr<StateView> view = cache.get_view(txn);
+        REQUIRE(view != nullptr);
+        return spawn_and_wait(view->get(key));
+    }
+};
+
+TEST_CASE_METHOD(ShardedStateCacheTest, "ShardedStateCache::ShardedStateCache", "[rpc][ethdb][kv][state_cache]") {
+    SECTION("default config") {
+        ShardedStateCache cache;
+        CHECK(cache.latest_data_size() == 0);
+        CHECK(cache.latest_code_size() == 0);
+        CHECK(cache.state_hit_count() == 0);
+        CHECK(cache.state_miss_count() == 0);
+        CHECK(cache.state_eviction_count() == 0);
+    }
+
+    SECTION("wrong config") {
+        CHECK_THROWS_AS(ShardedStateCache(CoherentCacheConfig{0, true, kDefaultMaxStateKeys, kDefaultMaxCodeKeys}), std::invalid_argument);
+        CHECK_THROWS_AS(ShardedStateCache(CoherentCacheConfig{}, 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE_METHOD(ShardedStateCacheTest, "ShardedStateCache::get_view", "[rpc][ethdb][kv][state_cache]") {
+    ShardedStateCache cache;
+    test_util::MockTransaction txn;
+    EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kShardedTestViewId0));
+
+    SECTION("no batch => no view") {
+        CHECK(cache.get_view(txn) == nullptr);
+    }
+
+    SECTION("view of newer batch") {
+        cache.on_new_block(make_upsert_batch(kShardedTestViewId1, kShardedTestAddress1, kShardedTestAccountData1));
+        CHECK(cache.get_view(txn) == nullptr);
+    }
+}
+
+TEST_CASE_METHOD(ShardedStateCacheTest, "ShardedStateCache::get coherent views", "[rpc][ethdb][kv][state_cache]") {
+    ShardedStateCache cache;
+    cache.on_new_block(make_upsert_batch(kShardedTestViewId0, kShardedTestAddress1, kShardedTestAccountData1));
+    cache.on_new_block(make_upsert_batch(kShardedTestViewId1, kShardedTestAddress1, kShardedTestAccountData2));
+    CHECK(cache.latest_data_size() == 1);
+
+    SECTION("each view sees its own value") {
+        test_util::MockTransaction txn0;
+        EXPECT_CALL(txn0, view_id()).WillRepeatedly(Return(kShardedTestViewId0));
+        CHECK(get(cache, txn0, address_key(kShardedTestAddress1)) == kShardedTestAccountData1);
+
+        test_util::MockTransaction txn1;
+        EXPECT_CALL(txn1, view_id()).WillRepeatedly(Return(kShardedTestViewId1));
+        CHECK(get(cache, txn1, address_key(kShardedTestAddress1)) == kShardedTestAccountData2);
+
+        CHECK(cache.state_hit_count() == 2);
+        CHECK(cache.state_miss_count() == 0);
+    }
+
+    SECTION("miss at latest view is cached") {
+        test_util::MockTransaction txn;
+        EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kShardedTestViewId1));
+        EXPECT_CALL(txn, get_one(table::kPlainStateName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<Bytes> {
+            co_return kShardedTestAccountData1;
+        }));
+        CHECK(get(cache, txn, address_key(kShardedTestAddress2)) == kShardedTestAccountData1);
+        CHECK(get(cache, txn, address_key(kShardedTestAddress2)) == kShardedTestAccountData1);
+        CHECK(cache.state_hit_count() == 1);
+        CHECK(cache.state_miss_count() == 1);
+        CHECK(cache.state_key_count() == 2);
+    }
+
+    SECTION("miss at previous view is not cached") {
+        test_util::MockTransaction txn;
+        EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kShardedTestViewId0));
+        EXPECT_CALL(txn, get_one(table::kPlainStateName, _)).Times(2).WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> {
+            co_return kShardedTestAccountData1;
+        }));
+        CHECK(get(cache, txn, address_key(kShardedTestAddress2)) == kShardedTestAccountData1);
+        CHECK(get(cache, txn, address_key(kShardedTestAddress2)) == kShardedTestAccountData1);
+        CHECK(cache.state_miss_count() == 2);
+        CHECK(cache.state_key_count() == 1);
+    }
+
+    SECTION("value changed after view is not visible") {
+        test_util::MockTransaction txn;
+        EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kShardedTestViewId0));
+        cache.on_new_block(make_upsert_batch(kShardedTestViewId1 + 1, kShardedTestAddress3, kShardedTestAccountData1));
+        EXPECT_CALL(txn, get_one(table::kPlainStateName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<Bytes> {
+            co_return Bytes{};
+        }));
+        CHECK(get(cache, txn, address_key(kShardedTestAddress3)) == std::nullopt);
+    }
+}
+
+TEST_CASE_METHOD(ShardedStateCacheTest, "ShardedStateCache::on_new_block", "[rpc][ethdb][kv][state_cache]") {
+    SECTION("exceed max views") {
+        ShardedStateCache cache{CoherentCacheConfig{.max_views = 2}};
+        for (uint64_t i{0}; i < 3; ++i) {
+            cache.on_new_block(make_upsert_batch(kShardedTestViewId0 + i, kShardedTestAddress1, kShardedTestAccountData1));
+        }
+        test_util::MockTransaction txn;
+        EXPECT_CALL(txn, view_id()).WillOnce(Return(kShardedTestViewId0)).WillOnce(Return(kShardedTestViewId0 + 1));
+        CHECK(cache.get_view(txn) == nullptr);
+        CHECK(cache.get_view(txn) != nullptr);
+    }
+
+    SECTION("exceed max keys") {
+        ShardedStateCache cache{CoherentCacheConfig{.max_state_keys = 2, .max_code_keys = 2}, /*num_shards=*/1};
+        cache.on_new_block(make_batch(kShardedTestViewId0, {
+                                                               AccountChange{.address = kShardedTestAddress1, .change_type = Action::kUpsert},
+                                                               AccountChange{.address = kShardedTestAddress2, .change_type = Action::kUpsert},
+                                                               AccountChange{.address = kShardedTestAddress3, .change_type = Action::kUpsert},
+                                                           }));
+        CHECK(cache.state_key_count() == 2);
+        CHECK(cache.state_eviction_count() == 1);
+    }
+
+    SECTION("code change") {
+        ShardedStateCache cache;
+        cache.on_new_block(make_batch(kShardedTestViewId0, {AccountChange{.address = kShardedTestAddress1, .change_type = Action::kCode, .code = kShardedTestCode}}));
+        CHECK(cache.latest_code_size() == 1);
+
+        test_util::MockTransaction txn;
+        EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kShardedTestViewId0));
+        std::unique_ptr<StateView> view = cache.get_view(txn);
+        REQUIRE(view != nullptr);
+        const ethash::hash256 code_hash{keccak256(kShardedTestCode)};
+        CHECK(spawn_and_wait(view->get_code(Bytes{code_hash.bytes, kHashLength})) == kShardedTestCode);
+        CHECK(cache.code_hit_count() == 1);
+    }
+
+    SECTION("view not following the latest one clears the cache") {
+        ShardedStateCache cache;
+        cache.on_new_block(make_upsert_batch(kShardedTestViewId1, kShardedTestAddress1, kShardedTestAccountData1));
+        cache.on_new_block(make_upsert_batch(0, kShardedTestAddress2, kShardedTestAccountData1));
+        CHECK(cache.state_key_count() == 1);
+
+        test_util::MockTransaction txn;
+        EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kShardedTestViewId1));
+        CHECK(cache.get_view(txn) == nullptr);
+    }
+}
+
+}  // namespace silkworm::db::kv::api
@@ -17,6 +17,8 @@
 #include "state_cache.hpp"
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include <magic_enum.hpp>
 
@@ -40,7 +42,8 @@ Task<std::optional<Bytes>> CoherentStateView::get_code(ByteView key) {
     co_return co_await cache_->get_code(key, tx_);
 }
 
-CoherentStateCache::CoherentStateCache(CoherentCacheConfig config) : config_(config) {
+CoherentStateCache::CoherentStateCache(CoherentCacheConfig config)
+    : config_(config), state_evictions_{config.max_state_keys}, code_evictions_{config.max_code_keys} {
     if (config.max_views == 0) {
         throw std::invalid_argument{"unexpected zero max_views"};
     }
@@ -157,9 +160,7 @@ void CoherentStateCache::process_storage_change(CoherentStateRoot* root, StateVi
 bool CoherentStateCache::add(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id) {
     auto [it, inserted] = root->cache.insert(kv);
     SILK_DEBUG << "Data cache kv.key=" << to_hex(kv.key) << " inserted=" << inserted << " view=" << view_id;
-    std::optional<KeyValue> replaced;
     if (!inserted) {
-        replaced = *it;
         root->cache.erase(it);
         std::tie(it, inserted) = root->cache.insert(kv);
         SILKWORM_ASSERT(inserted);
@@ -167,29 +168,14 @@ bool CoherentStateCache::add(KeyValue&& kv, CoherentStateRoot* root, StateViewId
     if (latest_state_view_id_ != view_id) {
         return inserted;
     }
-    if (replaced) {
-        state_evictions_.remove(*replaced);
-        SILK_DEBUG << "Data evictions removed replaced.key=" << to_hex(replaced->key);
-    }
-    state_evictions_.push_front(std::move(kv));
-
-    // Remove the longest unused key-value pair when size exceeded
-    if (state_evictions_.size() > config_.max_state_keys) {
-        const auto oldest = state_evictions_.back();
-        SILK_DEBUG << "Data cache resize oldest.key=" << to_hex(oldest.key);
-        state_evictions_.pop_back();
-        const auto num_erased = root->cache.erase(oldest);
-        SILKWORM_ASSERT(num_erased == 1);
-    }
+    track(state_evictions_, kv.key, root->cache);
     return inserted;
 }
 
 bool CoherentStateCache::add_code(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id) {
     auto [it, inserted] = root->code_cache.insert(kv);
     SILK_DEBUG << "Code cache kv.key=" << to_hex(kv.key) << " inserted=" << inserted << " view=" << view_id;
-    std::optional<KeyValue> replaced;
     if (!inserted) {
-        replaced = *it;
         root->code_cache.erase(it);
         std::tie(it, inserted) = root->code_cache.insert(kv);
         SILKWORM_ASSERT(inserted);
@@ -197,20 +183,7 @@ bool CoherentStateCache::add_code(KeyValue&& kv, CoherentStateRoot* root, StateV
     if (latest_state_view_id_ != view_id) {
         return inserted;
     }
-    if (replaced) {
-        code_evictions_.remove(*replaced);
-        SILK_DEBUG << "Code evictions removed replaced.key=" << to_hex(replaced->key);
-    }
-    code_evictions_.push_front(std::move(kv));
-
-    // Remove the longest unused key-value pair when size exceeded
-    if (code_evictions_.size() > config_.max_code_keys) {
-        const auto oldest = code_evictions_.back();
-        SILK_DEBUG << "Code cache resize oldest.key=" << to_hex(oldest.key);
-        code_evictions_.pop_back();
-        const auto num_erased = root->code_cache.erase(oldest);
-        SILKWORM_ASSERT(num_erased == 1);
-    }
+    track(code_evictions_, kv.key, root->code_cache);
     return inserted;
 }
 
@@ -232,8 +205,8 @@ Task<std::optional<Bytes>> CoherentStateCache::get(ByteView key, Transaction& tx
         SILK_DEBUG << "Hit in state cache key=" << key << " value=" << kv_it->value;
 
         if (view_id == latest_state_view_id_) {
-            state_evictions_.remove(kv);
-            state_evictions_.push_front(kv);
+            // Just set the reference bit, which is allowed under the shared lock
+            state_evictions_.find(key);
         }
 
         co_return kv_it->value;
@@ -274,8 +247,7 @@ Task<std::optional<Bytes>> CoherentStateCache::get_code(ByteView key, Transactio
         SILK_DEBUG << "Hit in code cache key=" << key << " value=" << kv_it->value;
 
         if (view_id == latest_state_view_id_) {
-            code_evictions_.remove(kv);
-            code_evictions_.push_front(kv);
+            code_evictions_.find(key);
         }
 
         co_return kv_it->value;
@@ -298,6 +270,32 @@ Task<std::optional<Bytes>> CoherentStateCache::get_code(ByteView key, Transactio
     co_return value;
 }
 
+void CoherentStateCache::track(Evictions& evictions, ByteView key, absl::btree_set<KeyValue>& cache) {
+    if (evictions.find(key)) {
+        return;
+    }
+    auto [_, evicted_key] = evictions.get_or_insert(key);
+    if (evicted_key) {
+        SILK_DEBUG << "Cache resize evicted.key=" << to_hex(string_view_to_byte_view(*evicted_key));
+        const auto num_erased = cache.erase(KeyValue{string_to_bytes(*evicted_key)});
+        SILKWORM_ASSERT(num_erased == 1);
+    }
+}
+
+void CoherentStateCache::reset(Evictions& evictions, absl::btree_set<KeyValue>& cache) {
+    evictions.clear();
+    std::vector<std::string> evicted_keys;
+    for (const auto& kv : cache) {
+        auto [_, evicted_key] = evictions.get_or_insert(kv.key);
+        if (evicted_key) {
+            evicted_keys.push_back(std::move(*evicted_key));
+        }
+    }
+    for (const auto& evicted_key : evicted_keys) {
+        cache.erase(KeyValue{string_to_bytes(evicted_key)});
+    }
+}
+
 CoherentStateRoot* CoherentStateCache::get_root(StateViewId view_id) {
     const auto root_it = state_view_roots_.find(view_id);
     if (root_it != state_view_roots_.end()) {
@@ -319,14 +317,8 @@ CoherentStateRoot* CoherentStateCache::advance_root(StateViewId view_id) {
         root->code_cache = previous_root_it->second->code_cache;
     } else {
         SILK_DEBUG << "CoherentStateCache::advance_root canonical view_id-1=" << (view_id - 1) << " not found";
-        state_evictions_.clear();
-        for (const auto& kv : root->cache) {
-            state_evictions_.push_front(kv);
-        }
-        code_evictions_.clear();
-        for (const auto& kv : root->code_cache) {
-            code_evictions_.push_front(kv);
-        }
+        reset(state_evictions_, root->cache);
+        reset(code_evictions_, root->code_cache);
     }
     root->canonical = true;
 
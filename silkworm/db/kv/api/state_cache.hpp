@@ -16,12 +16,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
-#include <list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <shared_mutex>
+#include <variant>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
@@ -30,6 +31,7 @@
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
 
+#include "clock_cache_map.hpp"
 #include "endpoint/key_value.hpp"
 #include "endpoint/state_change.hpp"
 #include "transaction.hpp"
@@ -104,6 +106,9 @@ class CoherentStateView : public StateView {
     CoherentStateCache* cache_;
 };
 
+//! State cache keeping a copy of the state for each one of the latest views
+//! \details The keys of the latest view are evicted with the CLOCK (second chance) policy, so lookups just set the
+//! reference bit of the key under the shared lock
 class CoherentStateCache : public StateCache {
   public:
     explicit CoherentStateCache(CoherentCacheConfig config = {});
@@ -136,6 +141,11 @@ class CoherentStateCache : public StateCache {
     void process_storage_change(CoherentStateRoot* root, StateViewId view_id, const api::AccountChange& change);
     bool add(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id);
     bool add_code(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id);
+    //! Keys of the latest view in eviction order
+    using Evictions = ClockCacheMap<std::monostate>;
+    //! Track the key as recently used in the latest view, evicting the least recently used one if full
+    static void track(Evictions& evictions, ByteView key, absl::btree_set<KeyValue>& cache);
+    static void reset(Evictions& evictions, absl::btree_set<KeyValue>& cache);
     Task<std::optional<Bytes>> get(ByteView key, Transaction& tx);
     Task<std::optional<Bytes>> get_code(ByteView key, Transaction& tx);
     CoherentStateRoot* get_root(StateViewId view_id);
@@ -147,16 +157,16 @@ class CoherentStateCache : public StateCache {
     std::map<StateViewId, std::unique_ptr<CoherentStateRoot>> state_view_roots_;
     StateViewId latest_state_view_id_{0};
     CoherentStateRoot* latest_state_view_{nullptr};
-    std::list<KeyValue> state_evictions_;
-    std::list<KeyValue> code_evictions_;
+    Evictions state_evictions_;
+    Evictions code_evictions_;
     std::shared_mutex rw_mutex_;
 
-    uint64_t state_hit_count_{0};
-    uint64_t state_miss_count_{0};
+    std::atomic<uint64_t> state_hit_count_{0};
+    std::atomic<uint64_t> state_miss_count_{0};
     uint64_t state_key_count_{0};
     uint64_t state_eviction_count_{0};
-    uint64_t code_hit_count_{0};
-    uint64_t code_miss_count_{0};
+    std::atomic<uint64_t> code_hit_count_{0};
+    std::atomic<uint64_t> code_miss_count_{0};
     uint64_t code_key_count_{0};
     uint64_t code_eviction_count_{0};
 };
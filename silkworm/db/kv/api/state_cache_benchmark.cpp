@@ -0,0 +1,118 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/infra/test_util/context_test_base.hpp>
+
+#include "base_transaction.hpp"
+#include "sharded_state_cache.hpp"
+#include "state_cache.hpp"
+
+namespace silkworm::db::kv::api {
+
+static constexpr StateViewId kBenchViewId{1};
+static constexpr std::size_t kBenchNumKeys{10'000};
+static constexpr std::size_t kBenchGetsPerIteration{1'000};
+
+//! Transaction just providing the view, lookups are all expected to hit the cache
+class BenchTransaction : public BaseTransaction {
+  public:
+    BenchTransaction() : BaseTransaction(nullptr) {}
+
+    uint64_t tx_id() const override { return 0; }
+    uint64_t view_id() const override { return kBenchViewId; }
+
+    Task<void> open() override { co_return; }
+    Task<std::shared_ptr<Cursor>> cursor(const std::string&) override { throw std::logic_error{"unexpected cursor"}; }
+    Task<std::shared_ptr<CursorDupSort>> cursor_dup_sort(const std::string&) override {
+        throw std::logic_error{"unexpected cursor"};
+    }
+    std::shared_ptr<State> create_state(boost::asio::any_io_executor&, const chain::ChainStorage&, BlockNum) override {
+        return nullptr;
+    }
+    std::shared_ptr<chain::ChainStorage> create_storage() override { return nullptr; }
+    Task<void> close() override { co_return; }
+    Task<DomainPointResult> domain_get(DomainPointQuery&&) override { throw std::logic_error{"unexpected query"}; }
+    Task<HistoryPointResult> history_seek(HistoryPointQuery&&) override { throw std::logic_error{"unexpected query"}; }
+    Task<PaginatedTimestamps> index_range(IndexRangeQuery&&) override { throw std::logic_error{"unexpected query"}; }
+    Task<PaginatedKeysValues> history_range(HistoryRangeQuery&&) override { throw std::logic_error{"unexpected query"}; }
+    Task<PaginatedKeysValues> domain_range(DomainRangeQuery&&) override { throw std::logic_error{"unexpected query"}; }
+};
+
+static StateChangeSet make_bench_batch(std::vector<Bytes>& keys) {
+    StateChangeSet state_change_set{.state_version_id = kBenchViewId};
+    auto& state_change = state_change_set.state_changes.emplace_back();
+    for (std::size_t i{0}; i < kBenchNumKeys; ++i) {
+        evmc::address address;
+        endian::store_big_u64(address.bytes, i);
+        keys.emplace_back(address.bytes, kAddressLength);
+        state_change.account_changes.emplace_back(AccountChange{
+            .address = address,
+            .change_type = Action::kUpsert,
+            .data = Bytes(32, static_cast<uint8_t>(i)),
+        });
+    }
+    return state_change_set;
+}
+
+static Task<std::size_t> get_cached_keys(StateView& view, const std::vector<Bytes>& keys, std::size_t offset) {
+    std::size_t found{0};
+    for (std::size_t i{0}; i < kBenchGetsPerIteration; ++i) {
+        const auto value = co_await view.get(keys[(offset + i) % keys.size()]);
+        if (value) ++found;
+    }
+    co_return found;
+}
+
+//! Concurrent lookups hitting the cache, which is shared by all benchmark threads
+template <typename TStateCache>
+static void benchmark_state_cache_hits(benchmark::State& state) {
+    static std::unique_ptr<StateCache> cache;
+    static std::vector<Bytes> keys;
+    if (state.thread_index() == 0) {
+        cache = std::make_unique<TStateCache>();
+        keys.clear();
+        cache->on_new_block(make_bench_batch(keys));
+    }
+
+    silkworm::test_util::ContextTestBase context;
+    BenchTransaction tx;
+    // Each thread starts from a different key to spread over the shards
+    std::size_t offset = static_cast<std::size_t>(state.thread_index()) * kBenchNumKeys / 64;
+    for ([[maybe_unused]] auto _ : state) {
+        auto view = cache->get_view(tx);
+        const auto found = context.spawn_and_wait(get_cached_keys(*view, keys, offset));
+        benchmark::DoNotOptimize(found);
+        offset += kBenchGetsPerIteration;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kBenchGetsPerIteration));
+
+    if (state.thread_index() == 0) {
+        cache.reset();
+    }
+}
+
+BENCHMARK(benchmark_state_cache_hits<CoherentStateCache>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(benchmark_state_cache_hits<ShardedStateCache>)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace silkworm::db::kv::api
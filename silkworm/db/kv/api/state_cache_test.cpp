@@ -574,6 +574,39 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block exceed max ke
     CHECK(cache.code_eviction_count() == kMaxKeys);
 }
 
+TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block exceed max keys keeps recently used", "[rpc][ethdb][kv][state_cache]") {
+    constexpr auto kMaxKeys{2u};
+    const CoherentCacheConfig config{kDefaultMaxViews, /*with_storage=*/true, kMaxKeys, kMaxKeys};
+    CoherentStateCache cache{config};
+
+    cache.on_new_block(new_batch_with_upsert_code(kTestViewId0, kTestBlockNumber, kTestBlockHash, kTestZeroTxs,
+                                                  /*unwind=*/false, /*num_changes=*/kMaxKeys));
+
+    // Looking up the oldest key in the latest view gives it a second chance
+    test_util::MockTransaction txn0;
+    EXPECT_CALL(txn0, view_id()).WillRepeatedly(Return(kTestViewId0));
+    get_and_check_upsert(cache, txn0, kTestAddress1, kTestAccountData);
+
+    // Next incoming batch with one *new key* evicts the key not used since then
+    cache.on_new_block(new_batch_with_upsert_code(kTestViewId1, kTestBlockNumber + 1, kTestBlockHash, kTestZeroTxs,
+                                                  /*unwind=*/false, /*num_changes=*/3, /*offset=*/2));
+    CHECK(cache.latest_data_size() == kMaxKeys);
+
+    test_util::MockTransaction txn1;
+    EXPECT_CALL(txn1, view_id()).WillRepeatedly(Return(kTestViewId1));
+    get_and_check_upsert(cache, txn1, kTestAddress1, kTestAccountData);
+    CHECK(cache.state_hit_count() == 2);
+
+    EXPECT_CALL(txn1, get_one(_, _)).WillOnce(InvokeWithoutArgs([]() -> Task<Bytes> {
+        co_return Bytes{};
+    }));
+    std::unique_ptr<StateView> view = cache.get_view(txn1);
+    REQUIRE(view != nullptr);
+    const Bytes address_key2{kTestAddress2.bytes, kAddressLength};
+    CHECK(!spawn_and_wait(view->get(address_key2)));
+    CHECK(cache.state_miss_count() == 1);
+}
+
 TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block clear the cache on view ID wrapping", "[rpc][ethdb][kv][state_cache]") {
     const CoherentCacheConfig config;
     const auto kMaxViews{config.max_views};
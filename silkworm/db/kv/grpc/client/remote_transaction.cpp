@@ -34,8 +34,9 @@ RemoteTransaction::RemoteTransaction(
     agrpc::GrpcContext& grpc_context,
     api::StateCache* state_cache,
     chain::BlockProvider block_provider,
-    chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider)
-    : BaseTransaction(state_cache),
+    chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider,
+    api::HistoricalStateCache* historical_state_cache)
+    : BaseTransaction(state_cache, historical_state_cache),
       block_provider_{std::move(block_provider)},
       block_number_from_txn_hash_provider_{std::move(block_number_from_txn_hash_provider)},
       stub_{stub},
@@ -86,7 +87,8 @@ Task<std::shared_ptr<api::CursorDupSort>> RemoteTransaction::get_cursor(const st
 }
 
 std::shared_ptr<silkworm::State> RemoteTransaction::create_state(boost::asio::any_io_executor& executor, const chain::ChainStorage& storage, BlockNum block_number) {
-    return std::make_shared<db::state::RemoteState>(executor, *this, storage, block_number);
+    return std::make_shared<db::state::RemoteState>(executor, *this, storage, block_number, historical_state_cache(),
+                                                    historical_state_generation());
 }
 
 std::shared_ptr<chain::ChainStorage> RemoteTransaction::create_storage() {
@@ -41,7 +41,8 @@ class RemoteTransaction : public api::BaseTransaction {
                       agrpc::GrpcContext& grpc_context,
                       api::StateCache* state_cache,
                       chain::BlockProvider block_provider,
-                      chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider);
+                      chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider,
+                      api::HistoricalStateCache* historical_state_cache = nullptr);
     ~RemoteTransaction() override = default;
 
     uint64_t tx_id() const override { return tx_id_; }
@@ -29,7 +29,8 @@ namespace silkworm::db::kv {
 StateChangesStream::StateChangesStream(rpc::ClientContext& context, api::Client& client)
     : scheduler_(*context.io_context()),
       client_(client),
-      cache_(must_use_shared_service<api::StateCache>(scheduler_)) {}
+      cache_(must_use_shared_service<api::StateCache>(scheduler_)),
+      historical_cache_(use_shared_service<api::HistoricalStateCache>(scheduler_)) {}
 
 std::future<void> StateChangesStream::open() {
     return concurrency::co_spawn(scheduler_, run(), boost::asio::use_future);
@@ -55,6 +56,9 @@ Task<void> StateChangesStream::run() {
             co_return;
         }
         cache_->on_new_block(*change_set);
+        if (historical_cache_) {
+            historical_cache_->on_new_block(*change_set);
+        }
     };
     co_await kv_service->state_changes(options, state_change_set_consumer);
 
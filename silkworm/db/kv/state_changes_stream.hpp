@@ -35,6 +35,7 @@
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 
 #include "api/client.hpp"
+#include "api/historical_state_cache.hpp"
 #include "api/state_cache.hpp"
 #include "grpc/client/rpc.hpp"
 
@@ -64,6 +65,9 @@ class StateChangesStream {
     //! The local state cache where the received state changes will be applied
     api::StateCache* cache_;
 
+    //! The shared historical state cache to be invalidated on unwinds, if any
+    api::HistoricalStateCache* historical_cache_;
+
     //! The thread-safe cancellation token for StateChanges KV API
     CancellationToken cancellation_token_;
 };
@@ -0,0 +1,137 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "log_summary.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/infra/common/ensure.hpp>
+
+namespace silkworm {
+
+uint32_t log_summary_fragment(ByteView address_or_topic) {
+    ensure(address_or_topic.size() >= sizeof(uint32_t), "log_summary_fragment: input too short");
+    return endian::load_big_u32(address_or_topic.data());
+}
+
+std::size_t append_log_summary(ByteView logs_cbor, uint32_t tx_index, uint32_t first_log_index, Bytes& summary) {
+    LogSummaryBuilder builder{summary};
+    builder.reset(tx_index, first_log_index);
+    cbor_decode(logs_cbor, builder);
+    return builder.num_entries();
+}
+
+void LogSummaryBuilder::reset(uint32_t tx_index, uint32_t first_log_index) {
+    current_entry_ = LogSummaryEntry{.tx_index = tx_index, .log_index = first_log_index};
+    current_topic_ = 0;
+    num_entries_ = 0;
+}
+
+void LogSummaryBuilder::on_num_logs(std::size_t num_logs) {
+    summary_.reserve(summary_.size() + num_logs * kLogSummaryEntrySize);
+}
+
+void LogSummaryBuilder::on_address(std::span<const uint8_t, kAddressLength> address_bytes) {
+    current_entry_.address_fragment = log_summary_fragment({address_bytes.data(), address_bytes.size()});
+    current_entry_.topic0_fragment = 0;
+    current_topic_ = 0;
+}
+
+void LogSummaryBuilder::on_topic(HashAsSpan topic_bytes) {
+    if (current_topic_++ == 0) {
+        current_entry_.topic0_fragment = log_summary_fragment({topic_bytes.data(), topic_bytes.size()});
+    }
+}
+
+void LogSummaryBuilder::on_data(std::span<const uint8_t> /*data_bytes*/) {
+    encode_log_summary_entry(current_entry_, summary_);
+    ++current_entry_.log_index;
+    ++num_entries_;
+}
+
+void encode_log_summary_entry(const LogSummaryEntry& entry, Bytes& summary) {
+    const auto offset{summary.size()};
+    summary.resize(offset + kLogSummaryEntrySize);
+    uint8_t* data{&summary[offset]};
+    endian::store_big_u32(data, entry.tx_index);
+    endian::store_big_u32(data + sizeof(uint32_t), entry.log_index);
+    endian::store_big_u32(data + 2 * sizeof(uint32_t), entry.address_fragment);
+    endian::store_big_u32(data + 3 * sizeof(uint32_t), entry.topic0_fragment);
+}
+
+std::vector<LogSummaryEntry> decode_log_summary(ByteView summary) {
+    ensure(summary.size() % kLogSummaryEntrySize == 0, [&]() {
+        return "decode_log_summary: invalid summary size " + std::to_string(summary.size());
+    });
+    std::vector<LogSummaryEntry> entries;
+    entries.reserve(summary.size() / kLogSummaryEntrySize);
+    for (const uint8_t* data{summary.data()}; data < summary.data() + summary.size(); data += kLogSummaryEntrySize) {
+        entries.push_back({
+            .tx_index = endian::load_big_u32(data),
+            .log_index = endian::load_big_u32(data + sizeof(uint32_t)),
+            .address_fragment = endian::load_big_u32(data + 2 * sizeof(uint32_t)),
+            .topic0_fragment = endian::load_big_u32(data + 3 * sizeof(uint32_t)),
+        });
+    }
+    return entries;
+}
+
+LogSummaryFilter::LogSummaryFilter(const std::vector<ByteView>& addresses, const std::vector<ByteView>& topics0) {
+    address_fragments_.reserve(addresses.size());
+    for (const auto address : addresses) {
+        address_fragments_.push_back(log_summary_fragment(address));
+    }
+    topic0_fragments_.reserve(topics0.size());
+    for (const auto topic : topics0) {
+        topic0_fragments_.push_back(log_summary_fragment(topic));
+    }
+    std::sort(address_fragments_.begin(), address_fragments_.end());
+    std::sort(topic0_fragments_.begin(), topic0_fragments_.end());
+}
+
+bool LogSummaryFilter::matches(const LogSummaryEntry& entry) const {
+    if (!address_fragments_.empty() &&
+        !std::binary_search(address_fragments_.begin(), address_fragments_.end(), entry.address_fragment)) {
+        return false;
+    }
+    if (!topic0_fragments_.empty() &&
+        !std::binary_search(topic0_fragments_.begin(), topic0_fragments_.end(), entry.topic0_fragment)) {
+        return false;
+    }
+    return true;
+}
+
+std::vector<LogSummaryCandidate> LogSummaryFilter::find_candidates(ByteView summary) const {
+    std::vector<LogSummaryCandidate> candidates;
+    std::optional<LogSummaryCandidate> current_tx;
+    bool current_tx_added{false};
+    for (const auto& entry : decode_log_summary(summary)) {
+        if (!current_tx || current_tx->tx_index != entry.tx_index) {
+            current_tx = LogSummaryCandidate{.tx_index = entry.tx_index, .first_log_index = entry.log_index};
+            current_tx_added = false;
+        }
+        if (!current_tx_added && matches(entry)) {
+            candidates.push_back(*current_tx);
+            current_tx_added = true;
+        }
+    }
+    return candidates;
+}
+
+}  // namespace silkworm
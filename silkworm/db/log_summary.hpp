@@ -0,0 +1,102 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/db/log_cbor.hpp>
+
+namespace silkworm {
+
+// Compact per-block summary of the logs stored in TransactionLog, used to locate the logs matching a filter
+// without decoding the CBOR representation of every log in the block.
+
+//! LogSummaryEntry is the compact descriptor of one log in the block log summary
+struct LogSummaryEntry {
+    uint32_t tx_index{0};          // Index of the transaction within the block
+    uint32_t log_index{0};         // Index of the log within the block
+    uint32_t address_fragment{0};  // Leading bytes of the log address
+    uint32_t topic0_fragment{0};   // Leading bytes of the first log topic (zero if log has no topics)
+
+    friend bool operator==(const LogSummaryEntry&, const LogSummaryEntry&) = default;
+};
+
+inline constexpr std::size_t kLogSummaryEntrySize{4 * sizeof(uint32_t)};
+
+//! \brief Fragment of an address or topic as stored in the summary (i.e. its leading 4 bytes as BE 32bit integer)
+uint32_t log_summary_fragment(ByteView address_or_topic);
+
+//! \brief Append to summary the entries for the CBOR-encoded logs of one transaction
+//! \return the number of appended entries (i.e. the number of logs in the transaction)
+std::size_t append_log_summary(ByteView logs_cbor, uint32_t tx_index, uint32_t first_log_index, Bytes& summary);
+
+void encode_log_summary_entry(const LogSummaryEntry& entry, Bytes& summary);
+std::vector<LogSummaryEntry> decode_log_summary(ByteView summary);
+
+//! LogSummaryBuilder is a CBOR consumer which appends to a block summary the entries of a sequence of Logs
+class LogSummaryBuilder : public LogCborConsumer {
+  public:
+    explicit LogSummaryBuilder(Bytes& summary) : summary_{summary} {}
+
+    //! \brief Prepare for the logs of a new transaction
+    void reset(uint32_t tx_index, uint32_t first_log_index);
+
+    //! \brief The number of entries appended since last reset
+    [[nodiscard]] std::size_t num_entries() const { return num_entries_; }
+
+    void on_num_logs(std::size_t num_logs) override;
+    void on_address(std::span<const uint8_t, kAddressLength> address_bytes) override;
+    void on_num_topics(std::size_t /*num_topics*/) override {}
+    void on_topic(HashAsSpan topic_bytes) override;
+    void on_data(std::span<const uint8_t> data_bytes) override;
+
+  private:
+    Bytes& summary_;
+    LogSummaryEntry current_entry_;
+    std::size_t current_topic_{0};
+    std::size_t num_entries_{0};
+};
+
+//! LogSummaryCandidate identifies one transaction holding at least one log which may match the filter
+struct LogSummaryCandidate {
+    uint32_t tx_index{0};         // Index of the transaction within the block
+    uint32_t first_log_index{0};  // Index within the block of the first log in the transaction
+
+    friend bool operator==(const LogSummaryCandidate&, const LogSummaryCandidate&) = default;
+};
+
+//! LogSummaryFilter selects the summary entries matching a set of addresses and first topics
+//! \remarks Fragments may collide, so candidates must be checked again against the full logs: the filter
+//! guarantees no false negatives, not the absence of false positives. Empty sets act as wildcards.
+class LogSummaryFilter {
+  public:
+    LogSummaryFilter(const std::vector<ByteView>& addresses, const std::vector<ByteView>& topics0);
+
+    [[nodiscard]] bool matches(const LogSummaryEntry& entry) const;
+
+    //! \brief Collect in order the transactions holding at least one log matching the filter
+    [[nodiscard]] std::vector<LogSummaryCandidate> find_candidates(ByteView summary) const;
+
+  private:
+    std::vector<uint32_t> address_fragments_;
+    std::vector<uint32_t> topic0_fragments_;
+};
+
+}  // namespace silkworm
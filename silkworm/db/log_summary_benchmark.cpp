@@ -0,0 +1,107 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/log_summary.hpp>
+
+namespace silkworm {
+
+using namespace evmc::literals;
+
+static const auto kSwapTopic{0xd78ad95fa46c994b6551d0da85fc275fe613ce37657fb8d5e3d130840159d822_bytes32};
+static const auto kSyncTopic{0x1c411e9a96e071241c2f21f7726b17ae89e3cab4c78be50e062b03a9fffbbad1_bytes32};
+static const auto kTransferTopic{0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32};
+
+static evmc::address make_address(uint32_t seed) {
+    evmc::address address;
+    endian::store_big_u32(address.bytes, seed * 2654435761u);
+    endian::store_big_u32(address.bytes + 16, seed);
+    return address;
+}
+
+//! Block logs shaped like the ones of a busy DEX router: each swap transaction emits two token transfers,
+//! the pair reserves sync and the swap itself, the pairs being spread over a limited set of pools
+struct BusyBlockLogs {
+    std::vector<Bytes> tx_logs;
+    Bytes summary;
+    evmc::address hot_pair;
+};
+
+static BusyBlockLogs make_busy_block_logs(uint32_t num_transactions, uint32_t num_pairs) {
+    BusyBlockLogs block;
+    block.hot_pair = make_address(0);
+    uint32_t log_index{0};
+    for (uint32_t tx_index{0}; tx_index < num_transactions; ++tx_index) {
+        const auto pair{make_address(tx_index % num_pairs)};
+        const Bytes amounts(128, static_cast<uint8_t>(tx_index));
+        const std::vector<Log> logs{
+            Log{make_address(1000 + tx_index % 7), {kTransferTopic, kTransferTopic, kTransferTopic}, Bytes(32, 1)},
+            Log{make_address(1000 + tx_index % 11), {kTransferTopic, kTransferTopic, kTransferTopic}, Bytes(32, 2)},
+            Log{pair, {kSyncTopic}, Bytes(64, 3)},
+            Log{pair, {kSwapTopic, kTransferTopic, kTransferTopic}, amounts},
+        };
+        block.tx_logs.push_back(cbor_encode(logs));
+        log_index += static_cast<uint32_t>(append_log_summary(block.tx_logs.back(), tx_index, log_index, block.summary));
+    }
+    return block;
+}
+
+static bool matches(const Log& log, const evmc::address& address, const evmc::bytes32& topic0) {
+    return log.address == address && !log.topics.empty() && log.topics[0] == topic0;
+}
+
+static void benchmark_logs_full_decoding(benchmark::State& state) {
+    const auto block{make_busy_block_logs(static_cast<uint32_t>(state.range(0)), /*num_pairs=*/50)};
+    std::vector<Log> logs;
+    for ([[maybe_unused]] auto _ : state) {
+        size_t matching_logs{0};
+        for (const auto& tx_logs : block.tx_logs) {
+            logs.clear();
+            cbor_decode(tx_logs, logs);
+            matching_logs += static_cast<size_t>(std::count_if(logs.cbegin(), logs.cend(), [&](const Log& log) {
+                return matches(log, block.hot_pair, kSwapTopic);
+            }));
+        }
+        benchmark::DoNotOptimize(matching_logs);
+    }
+}
+BENCHMARK(benchmark_logs_full_decoding)->Arg(100)->Arg(500);
+
+static void benchmark_logs_summary_decoding(benchmark::State& state) {
+    const auto block{make_busy_block_logs(static_cast<uint32_t>(state.range(0)), /*num_pairs=*/50)};
+    const LogSummaryFilter filter{{ByteView{block.hot_pair.bytes, kAddressLength}}, {ByteView{kSwapTopic.bytes, kHashLength}}};
+    std::vector<Log> logs;
+    for ([[maybe_unused]] auto _ : state) {
+        size_t matching_logs{0};
+        for (const auto& candidate : filter.find_candidates(block.summary)) {
+            logs.clear();
+            cbor_decode(block.tx_logs[candidate.tx_index], logs);
+            matching_logs += static_cast<size_t>(std::count_if(logs.cbegin(), logs.cend(), [&](const Log& log) {
+                return matches(log, block.hot_pair, kSwapTopic);
+            }));
+        }
+        benchmark::DoNotOptimize(matching_logs);
+    }
+}
+BENCHMARK(benchmark_logs_summary_decoding)->Arg(100)->Arg(500);
+
+}  // namespace silkworm
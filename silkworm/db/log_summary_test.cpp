@@ -0,0 +1,89 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "log_summary.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/log_cbor.hpp>
+
+namespace silkworm {
+
+using namespace evmc::literals;
+
+static const auto kRouter{0x7a250d5630b4cf539739df2c5dacb4c659f2488d_address};
+static const auto kToken{0xc02aaa39b223fe8d0a0e5c4f27ead9083c756cc2_address};
+static const auto kSwapTopic{0xd78ad95fa46c994b6551d0da85fc275fe613ce37657fb8d5e3d130840159d822_bytes32};
+static const auto kTransferTopic{0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32};
+
+TEST_CASE("LogSummary: fragments") {
+    CHECK(log_summary_fragment(ByteView{kRouter.bytes, kAddressLength}) == 0x7a250d56);
+    CHECK(log_summary_fragment(ByteView{kSwapTopic.bytes, kHashLength}) == 0xd78ad95f);
+    CHECK_THROWS(log_summary_fragment(*from_hex("0x0102")));
+}
+
+TEST_CASE("LogSummary: encode and decode") {
+    const std::vector<Log> logs{
+        Log{kToken, {kTransferTopic}, *from_hex("0x01")},
+        Log{kRouter, {kSwapTopic, kTransferTopic}, *from_hex("0x02")},
+        Log{kRouter, {}, {}},
+    };
+    Bytes summary;
+    CHECK(append_log_summary(cbor_encode(logs), /*tx_index=*/3, /*first_log_index=*/5, summary) == 3);
+    CHECK(summary.size() == 3 * kLogSummaryEntrySize);
+
+    const auto entries{decode_log_summary(summary)};
+    REQUIRE(entries.size() == 3);
+    CHECK(entries[0] == LogSummaryEntry{.tx_index = 3, .log_index = 5, .address_fragment = 0xc02aaa39, .topic0_fragment = 0xddf252ad});
+    CHECK(entries[1] == LogSummaryEntry{.tx_index = 3, .log_index = 6, .address_fragment = 0x7a250d56, .topic0_fragment = 0xd78ad95f});
+    CHECK(entries[2] == LogSummaryEntry{.tx_index = 3, .log_index = 7, .address_fragment = 0x7a250d56, .topic0_fragment = 0});
+
+    CHECK(append_log_summary(cbor_encode({}), /*tx_index=*/4, /*first_log_index=*/8, summary) == 0);
+    CHECK(summary.size() == 3 * kLogSummaryEntrySize);
+
+    CHECK_THROWS(decode_log_summary(ByteView{summary.data(), summary.size() - 1}));
+}
+
+TEST_CASE("LogSummaryFilter: find candidate transactions") {
+    Bytes summary;
+    CHECK(append_log_summary(cbor_encode({Log{kToken, {kTransferTopic}, {}}}), 0, 0, summary) == 1);
+    CHECK(append_log_summary(cbor_encode({Log{kToken, {kTransferTopic}, {}}, Log{kRouter, {kSwapTopic}, {}}}), 1, 1, summary) == 2);
+    CHECK(append_log_summary(cbor_encode({Log{kRouter, {kTransferTopic}, {}}}), 4, 3, summary) == 1);
+
+    SECTION("wildcard") {
+        const LogSummaryFilter filter{{}, {}};
+        CHECK(filter.find_candidates(summary) == std::vector<LogSummaryCandidate>{{0, 0}, {1, 1}, {4, 3}});
+    }
+    SECTION("address") {
+        const LogSummaryFilter filter{{ByteView{kRouter.bytes, kAddressLength}}, {}};
+        CHECK(filter.find_candidates(summary) == std::vector<LogSummaryCandidate>{{1, 1}, {4, 3}});
+    }
+    SECTION("first topic") {
+        const LogSummaryFilter filter{{}, {ByteView{kSwapTopic.bytes, kHashLength}}};
+        CHECK(filter.find_candidates(summary) == std::vector<LogSummaryCandidate>{{1, 1}});
+    }
+    SECTION("address and first topic") {
+        const LogSummaryFilter filter{{ByteView{kRouter.bytes, kAddressLength}}, {ByteView{kTransferTopic.bytes, kHashLength}}};
+        CHECK(filter.find_candidates(summary) == std::vector<LogSummaryCandidate>{{4, 3}});
+    }
+    SECTION("no match") {
+        const LogSummaryFilter filter{{ByteView{kToken.bytes, kAddressLength}}, {ByteView{kSwapTopic.bytes, kHashLength}}};
+        CHECK(filter.find_candidates(summary).empty());
+    }
+}
+
+}  // namespace silkworm
@@ -0,0 +1,29 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_index.hpp"
+
+#include <silkworm/db/snapshots/seg/common/varint.hpp>
+
+namespace silkworm::snapshots {
+
+Bytes ReceiptIndex::KeyFactory::make(ByteView /*key_data*/, uint64_t i) {
+    Bytes uint64_buffer;
+    seg::varint::encode(uint64_buffer, i);
+    return uint64_buffer;
+}
+
+}  // namespace silkworm::snapshots
@@ -0,0 +1,48 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_snapshot.hpp"
+
+#include <silkworm/core/rlp/decode_vector.hpp>
+#include <silkworm/core/rlp/encode_vector.hpp>
+#include <silkworm/infra/common/decoding_exception.hpp>
+
+namespace silkworm::snapshots {
+
+// The word is the RLP list of the block receipts followed by the logs of each transaction
+
+void encode_word_from_receipts(Bytes& word, const BlockReceiptsForStorage& receipts) {
+    std::vector<ByteView> items;
+    items.reserve(1 + receipts.transaction_logs.size());
+    items.emplace_back(receipts.receipts);
+    for (const auto& logs : receipts.transaction_logs) {
+        items.emplace_back(logs);
+    }
+    rlp::encode(word, items);
+}
+
+void decode_word_into_receipts(ByteView word, BlockReceiptsForStorage& receipts) {
+    std::vector<Bytes> items;
+    const auto result = rlp::decode(word, items);
+    success_or_throw(result, "decode_word_into_receipts: rlp::decode error");
+    if (items.empty()) {
+        throw DecodingException{DecodingError::kUnexpectedListElements, "decode_word_into_receipts: missing block receipts"};
+    }
+    receipts.receipts = std::move(items.front());
+    receipts.transaction_logs.assign(std::make_move_iterator(items.begin() + 1), std::make_move_iterator(items.end()));
+}
+
+}  // namespace silkworm::snapshots
@@ -0,0 +1,71 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/db/snapshots/snapshot_reader.hpp>
+#include <silkworm/db/snapshots/snapshot_word_serializer.hpp>
+#include <silkworm/db/snapshots/snapshot_writer.hpp>
+
+namespace silkworm::snapshots {
+
+//! The receipts of one block as stored in the receipts segment, both parts keeping their database (CBOR) encoding
+struct BlockReceiptsForStorage {
+    //! The block receipts without logs (i.e. BlockReceipts table value), empty if block has no receipts
+    Bytes receipts;
+    //! The logs of each transaction in block (i.e. TransactionLog table value), empty if transaction has no logs
+    std::vector<Bytes> transaction_logs;
+
+    friend bool operator==(const BlockReceiptsForStorage&, const BlockReceiptsForStorage&) = default;
+};
+
+void encode_word_from_receipts(Bytes& word, const BlockReceiptsForStorage& receipts);
+void decode_word_into_receipts(ByteView word, BlockReceiptsForStorage& receipts);
+
+struct ReceiptSnapshotWordSerializer : public SnapshotWordSerializer {
+    BlockReceiptsForStorage value;
+    Bytes word;
+
+    ~ReceiptSnapshotWordSerializer() override = default;
+
+    ByteView encode_word() override {
+        word.clear();
+        encode_word_from_receipts(word, value);
+        return word;
+    }
+};
+
+static_assert(SnapshotWordSerializerConcept<ReceiptSnapshotWordSerializer>);
+
+struct ReceiptSnapshotWordDeserializer : public SnapshotWordDeserializer {
+    BlockReceiptsForStorage value;
+
+    ~ReceiptSnapshotWordDeserializer() override = default;
+
+    void decode_word(ByteView word) override {
+        decode_word_into_receipts(word, value);
+    }
+};
+
+static_assert(SnapshotWordDeserializerConcept<ReceiptSnapshotWordDeserializer>);
+
+using ReceiptSnapshotReader = SnapshotReader<ReceiptSnapshotWordDeserializer>;
+using ReceiptSnapshotWriter = SnapshotWriter<ReceiptSnapshotWordSerializer>;
+
+}  // namespace silkworm::snapshots
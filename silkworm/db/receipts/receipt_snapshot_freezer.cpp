@@ -0,0 +1,65 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_snapshot_freezer.hpp"
+
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/util.hpp>
+
+#include "receipt_snapshot.hpp"
+
+namespace silkworm::db {
+
+void ReceiptSnapshotFreezer::copy(ROTxn& txn, const FreezerCommand& command, snapshots::SnapshotFileWriter& file_writer) const {
+    BlockNumRange range = command.range;
+
+    auto receipts_cursor = txn.ro_cursor(table::kBlockReceipts);
+    auto logs_cursor = txn.ro_cursor(table::kLogs);
+
+    snapshots::ReceiptSnapshotWriter writer{file_writer};
+    auto out = writer.out();
+    for (BlockNum i = range.first; i < range.second; i++) {
+        const Bytes key = block_key(i);
+
+        // Blocks executed before receipts persistence was enabled have neither receipts nor logs: keep an empty word
+        snapshots::BlockReceiptsForStorage value;
+        if (auto data = receipts_cursor->find(to_slice(key), /*throw_notfound=*/false); data) {
+            value.receipts = Bytes{from_slice(data.value)};
+        }
+        cursor_for_prefix(*logs_cursor, key, [&](ByteView k, ByteView v) {
+            const auto [_, tx_index] = split_log_key(to_slice(k));
+            if (value.transaction_logs.size() <= tx_index) {
+                value.transaction_logs.resize(tx_index + 1);
+            }
+            value.transaction_logs[tx_index] = Bytes{v};
+        });
+        *out++ = value;
+    }
+}
+
+void ReceiptSnapshotFreezer::cleanup(RWTxn& txn, BlockNumRange range) const {
+    auto receipts_cursor = txn.rw_cursor(table::kBlockReceipts);
+    auto logs_cursor = txn.rw_cursor(table::kLogs);
+    auto log_summary_cursor = txn.rw_cursor(table::kLogSummary);
+    for (BlockNum i = range.first; i < range.second; i++) {
+        const Bytes key = block_key(i);
+        cursor_erase_prefix(*receipts_cursor, key);
+        cursor_erase_prefix(*logs_cursor, key);
+        cursor_erase_prefix(*log_summary_cursor, key);
+    }
+}
+
+}  // namespace silkworm::db
@@ -0,0 +1,113 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_snapshot_freezer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/snapshot_freezer.hpp>
+#include <silkworm/db/snapshots/index.hpp>
+#include <silkworm/db/snapshots/path.hpp>
+#include <silkworm/db/snapshots/snapshot_reader.hpp>
+#include <silkworm/db/snapshots/snapshot_writer.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/db/util.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+
+#include "receipt_index.hpp"
+#include "receipt_queries.hpp"
+
+namespace silkworm::db {
+
+using namespace evmc::literals;
+using namespace snapshots;
+using silkworm::test_util::SetLogVerbosityGuard;
+
+static const Bytes kReceipts{*from_hex("828400f6011a00016e5b8400f6011a0002dc76")};
+
+static Bytes sample_logs() {
+    return cbor_encode({Log{0x7a250d5630b4cf539739df2c5dacb4c659f2488d_address, {}, *from_hex("0x01")}});
+}
+
+static void write_receipts_and_logs(RWTxn& txn, BlockNum block_number) {
+    txn.rw_cursor(table::kBlockReceipts)->upsert(to_slice(block_key(block_number)), to_slice(kReceipts));
+    const Bytes logs{sample_logs()};
+    txn.rw_cursor(table::kLogs)->upsert(to_slice(log_key(block_number, 1)), to_slice(logs));
+    txn.rw_cursor(table::kLogSummary)->upsert(to_slice(block_key(block_number)), to_slice(*from_hex("0x01")));
+}
+
+static bool has_block_rows(ROTxn& txn, const MapConfig& table, BlockNum block_number) {
+    bool found{false};
+    auto cursor = txn.ro_cursor(table);
+    cursor_for_prefix(*cursor, block_key(block_number), [&](ByteView, ByteView) { found = true; });
+    return found;
+}
+
+TEST_CASE("ReceiptSnapshotFreezer", "[db][snapshot][receipts]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    test_util::TempChainData context;
+    RWTxn& txn{context.rw_txn()};
+    TemporaryDirectory tmp_dir;
+
+    // Block 2 was executed before receipts persistence was enabled, block 1000 is out of range
+    const BlockNumRange range{0, 1000};
+    for (BlockNum block_number : {BlockNum{1}, BlockNum{3}, BlockNum{1000}}) {
+        write_receipts_and_logs(txn, block_number);
+    }
+    const ReceiptSnapshotFreezer freezer;
+
+    SECTION("copy and lookup by block number") {
+        const auto path = SnapshotPath::from(tmp_dir.path(), kSnapshotV1, range.first, range.second, SnapshotType::receipts);
+        SnapshotFileWriter file_writer{path, tmp_dir.path()};
+        freezer.copy(txn, FreezerCommand{range, /*base_txn_id=*/0}, file_writer);
+        SnapshotFileWriter::flush(std::move(file_writer));
+
+        auto receipt_index = ReceiptIndex::make(path);
+        REQUIRE_NOTHROW(receipt_index.build());
+
+        Snapshot receipt_snapshot{path};
+        receipt_snapshot.reopen_segment();
+        Index idx_receipt_number{path.index_file()};
+        idx_receipt_number.reopen_index();
+        ReceiptsFindByBlockNumQuery receipts_by_number{{receipt_snapshot, idx_receipt_number}};
+
+        const auto block1_receipts = receipts_by_number.exec(1);
+        REQUIRE(block1_receipts);
+        CHECK(*block1_receipts == BlockReceiptsForStorage{.receipts = kReceipts, .transaction_logs = {Bytes{}, sample_logs()}});
+        const auto block2_receipts = receipts_by_number.exec(2);
+        REQUIRE(block2_receipts);
+        CHECK(block2_receipts->receipts.empty());
+        CHECK(block2_receipts->transaction_logs.empty());
+        CHECK(receipts_by_number.exec(3));
+        CHECK(receipts_by_number.exec(range.second - 1));
+    }
+
+    SECTION("cleanup") {
+        freezer.cleanup(txn, range);
+        for (const auto& table : {table::kBlockReceipts, table::kLogs, table::kLogSummary}) {
+            CHECK_FALSE(has_block_rows(txn, table, 1));
+            CHECK_FALSE(has_block_rows(txn, table, 3));
+            CHECK(has_block_rows(txn, table, range.second));
+        }
+    }
+}
+
+}  // namespace silkworm::db
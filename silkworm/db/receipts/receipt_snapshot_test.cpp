@@ -0,0 +1,57 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_snapshot.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/common/decoding_exception.hpp>
+
+namespace silkworm::snapshots {
+
+TEST_CASE("ReceiptSnapshotWord") {
+    SECTION("round trip") {
+        const BlockReceiptsForStorage receipts{
+            .receipts = *from_hex("828400f6011a00016e5b8400f6011a0002dc76"),
+            .transaction_logs = {Bytes{}, *from_hex("81835400000000000000000000000000000000000000018040")},
+        };
+        Bytes word;
+        encode_word_from_receipts(word, receipts);
+
+        BlockReceiptsForStorage decoded;
+        decode_word_into_receipts(word, decoded);
+        CHECK(decoded == receipts);
+    }
+
+    SECTION("block without receipts") {
+        const BlockReceiptsForStorage receipts;
+        Bytes word;
+        encode_word_from_receipts(word, receipts);
+
+        BlockReceiptsForStorage decoded{.receipts = Bytes{0x01}, .transaction_logs = {Bytes{0x02}}};
+        decode_word_into_receipts(word, decoded);
+        CHECK(decoded.receipts.empty());
+        CHECK(decoded.transaction_logs.empty());
+    }
+
+    SECTION("empty list") {
+        BlockReceiptsForStorage decoded;
+        CHECK_THROWS_AS(decode_word_into_receipts(*from_hex("c0"), decoded), DecodingException);
+    }
+}
+
+}  // namespace silkworm::snapshots
@@ -20,6 +20,7 @@
 
 #include <silkworm/db/bodies/body_index.hpp>
 #include <silkworm/db/headers/header_index.hpp>
+#include <silkworm/db/receipts/receipt_index.hpp>
 #include <silkworm/db/snapshots/path.hpp>
 #include <silkworm/db/transactions/txn_index.hpp>
 #include <silkworm/db/transactions/txn_to_block_index.hpp>
@@ -39,6 +40,9 @@ SnapshotBundle SnapshotBundleFactoryImpl::make(PathByTypeProvider snapshot_path,
         .txn_snapshot = Snapshot(snapshot_path(SnapshotType::transactions)),
         .idx_txn_hash = Index(index_path(SnapshotType::transactions)),
         .idx_txn_hash_2_block = Index(index_path(SnapshotType::transactions_to_block)),
+
+        .receipt_snapshot = Snapshot(snapshot_path(SnapshotType::receipts)),
+        .idx_receipt_number = Index(index_path(SnapshotType::receipts)),
     };
 }
 
@@ -66,6 +70,8 @@ std::vector<std::shared_ptr<IndexBuilder>> SnapshotBundleFactoryImpl::index_buil
                 std::make_shared<IndexBuilder>(TransactionToBlockIndex::make(bodies_segment_path, seg_file)),
             };
         }
+        case SnapshotType::receipts:
+            return {std::make_shared<IndexBuilder>(ReceiptIndex::make(seg_file))};
         default:
             assert(false);
             return {};
@@ -198,6 +198,50 @@ TEST_CASE("PositionTable::operator<<", "[silkworm][node][seg][decompressor]") {
     CHECK_NOTHROW(null_stream() << table);
 }
 
+TEST_CASE("PairTable::make", "[silkworm][node][seg][decompressor]") {
+    // position codes: 0 -> 0 (terminator), 01 -> 1, 11 -> 5 (bits are read from least significant)
+    std::vector<Position> positions{{1, 0}, {2, 1}, {2, 5}};
+    PositionTable position_table{2};
+    REQUIRE(position_table.build(positions) == 3);
+    // pattern codes: 0 -> "ab", 1 -> "cd"
+    const Bytes ab{*from_hex("6162")}, cd{*from_hex("6364")};
+    std::vector<Pattern> patterns{{1, ab}, {1, cd}};
+    PatternTable pattern_table{1};
+    REQUIRE(pattern_table.build_condensed(patterns) == 2);
+
+    SECTION("window large enough for any pair") {
+        const auto pair_table = PairTable::make(position_table, pattern_table);
+        CHECK(pair_table->bit_length() == 3);
+        CHECK(pair_table->coverage() == 1.0);
+
+        const auto& terminator = pair_table->entry(0b000);
+        CHECK(terminator.has_position);
+        CHECK(terminator.position == 0);
+        CHECK(terminator.position_bits == 1);
+        CHECK_FALSE(terminator.has_pair);
+
+        const auto& pair1 = pair_table->entry(0b101);
+        CHECK(pair1.has_pair);
+        CHECK(pair1.position == 1);
+        CHECK(pair1.position_bits == 2);
+        CHECK(pair1.pair_bits == 3);
+        CHECK(pair_table->pattern(pair1.pattern_index) == cd);
+
+        const auto& pair2 = pair_table->entry(0b011);
+        CHECK(pair2.has_pair);
+        CHECK(pair2.position == 5);
+        CHECK(pair_table->pattern(pair2.pattern_index) == ab);
+    }
+
+    SECTION("window too small for some codes") {
+        PairTable pair_table{position_table, pattern_table, 1};
+        CHECK(pair_table.coverage() == 0.5);
+        CHECK(pair_table.entry(0b0).has_position);
+        CHECK_FALSE(pair_table.entry(0b1).has_position);
+        CHECK_FALSE(pair_table.entry(0b1).has_pair);
+    }
+}
+
 static test::TemporarySnapshotFile create_snapshot_file(std::vector<test::SnapshotPattern>&& patterns,
                                                         std::vector<test::SnapshotPosition>&& positions) {
     const auto tmp_file_path{silkworm::TemporaryDirectory::get_unique_temporary_path()};
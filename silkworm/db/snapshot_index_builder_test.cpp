@@ -19,6 +19,7 @@
 
 #include <silkworm/db/bodies/body_index.hpp>
 #include <silkworm/db/headers/header_index.hpp>
+#include <silkworm/db/snapshots/index_build_scheduler.hpp>
 #include <silkworm/db/snapshots/index_builder.hpp>
 #include <silkworm/db/test_util/temp_snapshots.hpp>
 #include <silkworm/db/transactions/txn_index.hpp>
@@ -199,4 +200,54 @@ TEST_CASE("TransactionIndex::build OK", "[silkworm][snapshot][index]") {
     tx_index_hash_to_block.build();
 }
 
+TEST_CASE("IndexBuilder::limit_memory_usage", "[silkworm][snapshot][index]") {
+    TemporaryDirectory tmp_dir;
+    test::SampleBodySnapshotFile valid_body_snapshot{tmp_dir.path()};
+    test::SampleBodySnapshotPath body_snapshot_path{valid_body_snapshot.path()};
+    auto body_index = BodyIndex::make(body_snapshot_path);
+    const auto initial_memory_usage{body_index.memory_usage()};
+
+    body_index.limit_memory_usage(initial_memory_usage * 2);
+    CHECK(body_index.memory_usage() == initial_memory_usage);
+    body_index.limit_memory_usage(initial_memory_usage / 2);
+    CHECK(body_index.memory_usage() == initial_memory_usage / 2);
+    body_index.limit_memory_usage(0);
+    CHECK(body_index.memory_usage() > 0);
+}
+
+TEST_CASE("IndexBuildScheduler::build", "[silkworm][snapshot][index]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+    test::SampleHeaderSnapshotFile valid_header_snapshot{tmp_dir.path()};
+    test::SampleHeaderSnapshotPath header_snapshot_path{valid_header_snapshot.path()};
+    test::SampleBodySnapshotFile valid_bodies_snapshot{tmp_dir.path()};
+    test::SampleBodySnapshotPath bodies_snapshot_path{valid_bodies_snapshot.path()};
+    test::SampleTransactionSnapshotFile valid_txs_snapshot{tmp_dir.path()};
+    test::SampleTransactionSnapshotPath txs_snapshot_path{valid_txs_snapshot.path()};
+
+    std::vector<std::shared_ptr<IndexBuilder>> builders{
+        std::make_shared<IndexBuilder>(HeaderIndex::make(header_snapshot_path)),
+        std::make_shared<IndexBuilder>(BodyIndex::make(bodies_snapshot_path)),
+        std::make_shared<IndexBuilder>(TransactionIndex::make(bodies_snapshot_path, txs_snapshot_path)),
+        std::make_shared<IndexBuilder>(TransactionToBlockIndex::make(bodies_snapshot_path, txs_snapshot_path)),
+    };
+
+    SECTION("OK: all indexes built within budget") {
+        const IndexBuildScheduler scheduler{/*memory_budget=*/256_Mebi, /*num_workers=*/2};
+        CHECK_NOTHROW(scheduler.build(builders));
+        for (const auto& builder : builders) {
+            CHECK(std::filesystem::exists(builder->path().path()));
+            CHECK(builder->memory_usage() <= 128_Mebi);
+        }
+    }
+
+    SECTION("KO: build error is rethrown after other builds") {
+        test::TemporarySnapshotFile empty_header_snapshot{tmp_dir.path(), "v1-014500-015000-headers.seg"};
+        builders.push_back(std::make_shared<IndexBuilder>(HeaderIndex::make(*SnapshotPath::parse(empty_header_snapshot.path().string()))));
+        const IndexBuildScheduler scheduler{/*memory_budget=*/256_Mebi, /*num_workers=*/2};
+        CHECK_THROWS_AS(scheduler.build(builders), std::logic_error);
+        CHECK(std::filesystem::exists(builders[0]->path().path()));
+    }
+}
+
 }  // namespace silkworm::snapshots
@@ -21,6 +21,7 @@
 
 #include "bodies/body_snapshot.hpp"
 #include "headers/header_snapshot.hpp"
+#include "receipts/receipt_snapshot.hpp"
 #include "snapshots/path.hpp"
 #include "transactions/txn_snapshot.hpp"
 
@@ -55,6 +56,9 @@ void snapshot_file_recompress(const std::filesystem::path& path) {
         case SnapshotType::transactions:
             copy_reader_to_writer<TransactionSnapshotReader, TransactionSnapshotWriter>(file_reader, file_writer);
             break;
+        case SnapshotType::receipts:
+            copy_reader_to_writer<ReceiptSnapshotReader, ReceiptSnapshotWriter>(file_reader, file_writer);
+            break;
         default:
             throw std::runtime_error{"invalid snapshot type"};
     }
@@ -136,6 +136,49 @@ TEST_CASE("SnapshotRepository::view", "[silkworm][node][snapshot]") {
     }
 }
 
+TEST_CASE("SnapshotRepository::reopen_folder.incremental", "[silkworm][node][snapshot]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+    SnapshotSettings settings{tmp_dir.path()};
+    SnapshotRepository repository{settings, bundle_factory()};
+
+    test::SampleHeaderSnapshotFile tmp_snapshot_1{tmp_dir.path()};
+    test::SampleBodySnapshotFile tmp_snapshot_2{tmp_dir.path()};
+    test::SampleTransactionSnapshotFile tmp_snapshot_3{tmp_dir.path()};
+    for (auto& index_builder : repository.missing_indexes()) {
+        index_builder->build();
+    }
+
+    repository.reopen_folder();
+    REQUIRE(repository.bundles_count() == 1);
+    CHECK(repository.last_reopen_metrics().opened_bundles == 1);
+    CHECK(repository.last_reopen_metrics().deferred_verifications == 0);
+    const SnapshotBundle* bundle = &*repository.view_bundles().begin();
+
+    SECTION("reopen keeps open bundles") {
+        repository.reopen_folder();
+        CHECK(repository.bundles_count() == 1);
+        CHECK(repository.last_reopen_metrics().opened_bundles == 0);
+        CHECK(&*repository.view_bundles().begin() == bundle);
+    }
+
+    SECTION("bundles are consistent") {
+        CHECK_NOTHROW(bundle->verify(/*verify_content=*/true));
+    }
+
+    SECTION("readers keep bundles open across close") {
+        const auto view = repository.view_bundles();
+        const auto segment = repository.find_segment(SnapshotType::headers, 1'500'000);
+        REQUIRE(segment);
+
+        repository.close();
+        CHECK(repository.bundles_count() == 0);
+        CHECK(std::ranges::distance(repository.view_bundles()) == 0);
+        CHECK(std::ranges::distance(view) == 1);
+        CHECK_FALSE(segment->snapshot.empty());
+    }
+}
+
 TEST_CASE("SnapshotRepository::missing_block_ranges", "[silkworm][node][snapshot]") {
     SetLogVerbosityGuard guard{log::Level::kNone};
     TemporaryDirectory tmp_dir;
@@ -16,7 +16,6 @@
 
 #include "snapshot_sync.hpp"
 
-#include <atomic>
 #include <exception>
 #include <latch>
 
@@ -26,13 +25,13 @@
 #include <silkworm/db/headers/header_snapshot.hpp>
 #include <silkworm/db/mdbx/etl_mdbx_collector.hpp>
 #include <silkworm/db/snapshots/config.hpp>
+#include <silkworm/db/snapshots/index_build_scheduler.hpp>
 #include <silkworm/db/snapshots/index_builder.hpp>
 #include <silkworm/db/snapshots/path.hpp>
 #include <silkworm/db/stages.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/environment.hpp>
 #include <silkworm/infra/common/log.hpp>
-#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 namespace silkworm::db {
 
@@ -187,8 +186,6 @@ bool SnapshotSync::stop() {
 }
 
 void SnapshotSync::build_missing_indexes() {
-    ThreadPool workers;
-
     // Determine the missing indexes and build them in parallel
     const auto missing_indexes = repository_->missing_indexes();
     if (missing_indexes.empty()) {
@@ -196,32 +193,8 @@ void SnapshotSync::build_missing_indexes() {
     }
 
     SILK_INFO << "SnapshotSync: " << missing_indexes.size() << " missing indexes to build";
-    size_t total_tasks = missing_indexes.size();
-    std::atomic_size_t done_tasks;
-
-    for (const auto& index : missing_indexes) {
-        workers.push_task([index, total_tasks, &done_tasks]() {
-            try {
-                SILK_INFO << "SnapshotSync: building index " << index->path().filename() << " ...";
-                index->build();
-                done_tasks++;
-                SILK_INFO << "SnapshotSync: built index " << index->path().filename() << ";"
-                          << " progress: " << (done_tasks * 100 / total_tasks) << "% "
-                          << done_tasks << " of " << total_tasks << " indexes ready";
-            } catch (const std::exception& ex) {
-                SILK_CRIT << "SnapshotSync: build index: " << index->path().filename() << " failed [" << ex.what() << "]";
-                throw;
-            }
-        });
-    }
-
-    // Wait for all missing indexes to be built or stop request
-    while (workers.get_tasks_total() && !is_stopping()) {
-        std::this_thread::sleep_for(kCheckCompletionInterval);
-    }
-    // Wait for any already-started-but-unfinished work in case of stop request
-    workers.pause();
-    workers.wait_for_tasks();
+    const IndexBuildScheduler scheduler{settings_.index_build_memory_budget};
+    scheduler.build(missing_indexes, [this]() { return is_stopping(); });
 
     SILK_INFO << "SnapshotSync: built missing indexes";
 }
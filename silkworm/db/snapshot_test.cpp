@@ -162,6 +162,40 @@ TEST_CASE("HeaderSnapshot::header_by_number OK", "[silkworm][node][snapshot][ind
     CHECK(!header_by_number.exec(1'500'014));
 }
 
+TEST_CASE("HeaderSnapshot::header_by_number with word cache", "[silkworm][node][snapshot][index]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+    test::SampleHeaderSnapshotFile valid_header_snapshot{tmp_dir.path()};
+    test::SampleHeaderSnapshotPath header_snapshot_path{valid_header_snapshot.path()};
+    auto header_index = HeaderIndex::make(header_snapshot_path);
+    REQUIRE_NOTHROW(header_index.build());
+
+    auto word_cache = std::make_shared<WordCache>(1_Mebi);
+    Snapshot header_snapshot{header_snapshot_path};
+    header_snapshot.set_word_cache(word_cache);
+    header_snapshot.reopen_segment();
+
+    Index idx_header_hash{header_snapshot_path.index_file()};
+    idx_header_hash.reopen_index();
+    HeaderFindByBlockNumQuery header_by_number{{header_snapshot, idx_header_hash}};
+
+    const auto decoded_header = header_by_number.exec(1'500'013);
+    REQUIRE(decoded_header);
+    CHECK(word_cache->stats().misses == 1);
+    CHECK(word_cache->stats().entries == 1);
+
+    const auto cached_header = header_by_number.exec(1'500'013);
+    REQUIRE(cached_header);
+    CHECK(word_cache->stats().hits == 1);
+    CHECK(cached_header->hash() == decoded_header->hash());
+    CHECK(header_by_number.exec(1'500'012));
+
+    // Reopening the segment must not serve the words cached before
+    header_snapshot.reopen_segment();
+    CHECK(header_by_number.exec(1'500'013));
+    CHECK(word_cache->stats().hits == 1);
+}
+
 // https://etherscan.io/block/1500013
 TEST_CASE("BodySnapshot::body_by_number OK", "[silkworm][node][snapshot][index]") {
     SetLogVerbosityGuard guard{log::Level::kNone};
@@ -0,0 +1,79 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <iterator>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace silkworm {
+
+//! A view over the values of an immutable map of shared pointers, which keeps the map alive while in use.
+//! Iterating dereferences the shared pointers, so the view yields TMapValue elements.
+template <typename TMapKey, typename TMapValue>
+class SharedMapValuesView : public std::ranges::view_interface<SharedMapValuesView<TMapKey, TMapValue>> {
+  public:
+    using TMap = std::map<TMapKey, std::shared_ptr<TMapValue>>;
+
+    class Iterator {
+      public:
+        using value_type = TMapValue;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        Iterator(typename TMap::const_iterator it) : it_(it) {}
+        Iterator() = default;
+
+        reference operator*() const { return *it_->second; }
+        pointer operator->() const { return it_->second.get(); }
+
+        Iterator operator++(int) { return std::exchange(*this, ++Iterator{*this}); }
+        Iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        Iterator operator--(int) { return std::exchange(*this, --Iterator{*this}); }
+        Iterator& operator--() {
+            --it_;
+            return *this;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) = default;
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) = default;
+
+      private:
+        typename TMap::const_iterator it_;
+    };
+
+    static_assert(std::bidirectional_iterator<Iterator>);
+
+    explicit SharedMapValuesView(std::shared_ptr<const TMap> map) : map_(std::move(map)) {}
+    SharedMapValuesView() = default;
+
+    Iterator begin() const { return map_ ? Iterator{map_->cbegin()} : Iterator{}; }
+    Iterator end() const { return map_ ? Iterator{map_->cend()} : Iterator{}; }
+
+  private:
+    std::shared_ptr<const TMap> map_;
+};
+
+}  // namespace silkworm
@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
+#include <vector>
 
 #include <silkworm/core/types/hash.hpp>
 
@@ -39,6 +41,12 @@ class Index {
     std::optional<std::size_t> lookup_by_data_id(uint64_t id) const { return index_->lookup_by_data_id(id); };
     std::optional<std::size_t> lookup_by_hash(const Hash& hash) const { return index_->lookup_by_key(hash); };
 
+    //! Batched lookup_by_hash resolving all the hashes at once, offsets are returned in the same order
+    std::vector<std::optional<std::size_t>> lookup_by_hashes(std::span<const Hash> hashes) const {
+        std::vector<ByteView> keys{hashes.begin(), hashes.end()};
+        return index_->lookup_by_keys(keys);
+    }
+
     std::optional<std::size_t> lookup_ordinal_by_hash(const Hash& hash) const {
         auto [result, found] = index_->lookup(hash);
         return found ? std::optional{result} : std::nullopt;
@@ -47,6 +55,10 @@ class Index {
     void reopen_index();
     void close_index();
 
+    //! Set the paging policy of the index file, applied on next reopen_index
+    void set_access_policy(MemoryAccessPolicy policy) { access_policy_ = policy; }
+    MemoryAccessPolicy access_policy() const { return access_policy_; }
+
     bool is_open() const { return index_.get(); }
     const SnapshotPath& path() const { return path_; }
 
@@ -59,10 +71,17 @@ class Index {
         return index_->base_data_id();
     }
 
+    std::size_t key_count() const {
+        assert(index_);
+        return index_->key_count();
+    }
+
   private:
     SnapshotPath path_;
     //! External memory-mapped region of the index data
     std::optional<MemoryMappedRegion> region_;
+    //! Paging policy of the index data: lookups are random by default
+    MemoryAccessPolicy access_policy_{MemoryAccessPolicy::kRandom};
 
     std::unique_ptr<rec_split::RecSplitIndex> index_;
 };
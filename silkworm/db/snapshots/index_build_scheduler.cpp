@@ -0,0 +1,101 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "index_build_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+
+namespace silkworm::snapshots {
+
+static constexpr std::chrono::seconds kCheckCompletionInterval{1};
+
+IndexBuildScheduler::IndexBuildScheduler(std::size_t memory_budget, std::size_t num_workers)
+    : memory_budget_{memory_budget}, num_workers_{std::max<std::size_t>(num_workers, 1)} {}
+
+void IndexBuildScheduler::build(std::vector<std::shared_ptr<IndexBuilder>> builders,
+                                const StopRequested& stop_requested) const {
+    if (builders.empty()) {
+        return;
+    }
+
+    std::stable_sort(builders.begin(), builders.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->path().segment_size() > rhs->path().segment_size();
+    });
+
+    // Never run more builds than the budget can hold at their minimum memory usage, or it would be exceeded
+    const std::size_t max_concurrent_builds{std::max<std::size_t>(memory_budget_ / IndexBuilder::min_memory_usage(), 1)};
+    const std::size_t num_workers{std::min({num_workers_, builders.size(), max_concurrent_builds})};
+    const std::size_t memory_per_build{memory_budget_ / num_workers};
+    for (const auto& builder : builders) {
+        builder->limit_memory_usage(memory_per_build);
+    }
+    SILK_INFO << "IndexBuildScheduler: " << builders.size() << " indexes to build"
+              << " workers: " << num_workers << " memory per build: " << human_size(memory_per_build);
+
+    ThreadPool workers{static_cast<unsigned>(num_workers)};
+    const std::size_t total_tasks{builders.size()};
+    std::atomic_size_t done_tasks{0};
+
+    std::vector<std::future<void>> results;
+    results.reserve(builders.size());
+    for (const auto& builder : builders) {
+        results.push_back(workers.submit([builder, total_tasks, &done_tasks]() {
+            try {
+                SILK_INFO << "IndexBuildScheduler: building index " << builder->path().filename() << " ...";
+                builder->build();
+                ++done_tasks;
+                SILK_INFO << "IndexBuildScheduler: built index " << builder->path().filename() << ";"
+                          << " progress: " << (done_tasks * 100 / total_tasks) << "% "
+                          << done_tasks << " of " << total_tasks << " indexes ready";
+            } catch (const std::exception& ex) {
+                SILK_CRIT << "IndexBuildScheduler: build index: " << builder->path().filename() << " failed [" << ex.what() << "]";
+                throw;
+            }
+        }));
+    }
+
+    std::exception_ptr first_error;
+    for (auto& result : results) {
+        while (result.wait_for(kCheckCompletionInterval) != std::future_status::ready) {
+            if (stop_requested && stop_requested()) {
+                // Wait for any already-started-but-unfinished work, the queued builds will never start
+                workers.pause();
+                workers.wait_for_tasks();
+                return;
+            }
+        }
+        try {
+            result.get();
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+}  // namespace silkworm::snapshots
@@ -0,0 +1,53 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <silkworm/core/common/base.hpp>
+
+#include "index_builder.hpp"
+
+namespace silkworm::snapshots {
+
+//! \brief Builds many snapshot indexes concurrently within a global memory budget
+//! \details The budget is shared evenly among the concurrent builds, each one spilling to disk the keys collected
+//! beyond its share, and limits their number so that no share is below the minimum memory usage of a build.
+//! Builds for the largest segments are started first, so that they do not end up running alone
+class IndexBuildScheduler {
+  public:
+    static constexpr std::size_t kDefaultMemoryBudget{4_Gibi};
+
+    explicit IndexBuildScheduler(std::size_t memory_budget = kDefaultMemoryBudget,
+                                 std::size_t num_workers = std::thread::hardware_concurrency());
+
+    using StopRequested = std::function<bool()>;
+
+    //! \brief Builds all the given indexes, returning when done or as soon as the running builds end on stop request
+    //! \throws the first error raised by any build, after all the others are done
+    void build(std::vector<std::shared_ptr<IndexBuilder>> builders, const StopRequested& stop_requested = {}) const;
+
+  private:
+    std::size_t memory_budget_;
+    std::size_t num_workers_;
+};
+
+}  // namespace silkworm::snapshots
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <memory>
@@ -125,9 +126,27 @@ struct IndexBuilder {
 
     const SnapshotPath& path() const { return descriptor_.index_file; }
 
+    //! The memory used at most by the build to collect the keys, which are spilled to disk beyond it
+    std::size_t memory_usage() const { return kCollectorCount * descriptor_.etl_buffer_size; }
+
+    //! Reduce the memory used to collect the keys to the given maximum, if lower than the current one
+    void limit_memory_usage(std::size_t max_memory_usage) {
+        const auto max_etl_buffer_size{std::max(max_memory_usage / kCollectorCount, kMinEtlBufferSize)};
+        descriptor_.etl_buffer_size = std::min(descriptor_.etl_buffer_size, max_etl_buffer_size);
+    }
+
+    //! The memory used at least by any build, whatever limit is applied
+    static constexpr std::size_t min_memory_usage() { return kCollectorCount * kMinEtlBufferSize; }
+
   private:
     static constexpr std::size_t kBucketSize{2'000};
 
+    //! The number of ETL collectors used by the sequential building strategy (bucket keys and offsets)
+    static constexpr std::size_t kCollectorCount{2};
+
+    //! Below this size collecting keys would just keep the disk busy with tiny files
+    static constexpr std::size_t kMinEtlBufferSize{db::etl::kOptimalBufferSize / 16};
+
     IndexDescriptor descriptor_;
     std::unique_ptr<IndexInputDataQuery> query_;
 };
@@ -155,6 +155,15 @@ inline uint64_t remap128(uint64_t x, uint64_t n) {
 #endif  // __SIZEOF_INT128__
 }
 
+//! Hint the processor to bring into cache the line containing the given address, in view of a next read access
+inline void prefetch_read(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, /*rw=*/0, /*locality=*/3);
+#else
+    (void)address;
+#endif
+}
+
 /** Count the number of 1-bits in a word.
  * @param word binary word.
  *
@@ -368,6 +368,23 @@ class DoubleEliasFanoList16 {
         cum_keys_next = ((curr_word_cum_keys * 64 + static_cast<uint64_t>(rho(window_cum_keys)) - i - 1) << l_cum_keys | (lower & lower_bits_mask_cum_keys)) + cum_delta + cum_keys_min_delta_;
     }
 
+    //! Prefetch the lower bits and jump table words read by get2/get3 for the i-th element
+    void prefetch(const uint64_t i) const {
+        prefetch_read(&lower_bits[i * (l_cum_keys + l_position) / 64]);
+        const uint64_t jump_super_q = (i / kSuperQ) * kSuperQSize16 * 2;
+        prefetch_read(&jump[jump_super_q]);
+        prefetch_read(&jump[jump_super_q + 2 + (i % kSuperQ) / kQ / 2]);
+    }
+
+    //! Prefetch the upper bits words read by get2/get3 for the i-th element
+    //!
+    //! \remarks Reads the jump table, so it should be issued when the prefetch(i) lines are expected in cache
+    void prefetch_upper_bits(const uint64_t i) const {
+        const auto [jump_cum_keys, jump_position] = jumps(i);
+        prefetch_read(&upper_bits_cum_keys[jump_cum_keys / 64]);
+        prefetch_read(&upper_bits_position[jump_position / 64]);
+    }
+
   private:
     std::pair<uint64_t, uint64_t> derive_fields() {
         l_position = u_position / (num_buckets_ + 1) == 0 ? 0 : 63 ^ uint64_t(std::countl_zero(u_position / (num_buckets_ + 1)));
@@ -395,21 +412,13 @@ class DoubleEliasFanoList16 {
         return {words_cum_keys, words_position};
     }
 
-    void get(const uint64_t i, uint64_t& cum_keys, uint64_t& position, uint64_t& window_cum_keys, uint64_t& select_cum_keys,
-             uint64_t& curr_word_cum_keys, uint64_t& lower, uint64_t& cum_delta) const {
-        const uint64_t pos_lower = i * (l_cum_keys + l_position);
-        uint64_t idx64 = pos_lower / 64;
-        uint64_t shift = pos_lower % 64;
-        lower = lower_bits[idx64] >> shift;
-        if (shift > 0) {
-            lower |= lower_bits[idx64 + 1] << (64 - shift);
-        }
-
+    //! Return the bit positions in upper bits where the search for cumulative keys and position of the i-th element starts
+    std::pair<uint64_t, uint64_t> jumps(const uint64_t i) const {
         const uint64_t jump_super_q = (i / kSuperQ) * kSuperQSize16 * 2;
         const uint64_t jump_inside_super_q = (i % kSuperQ) / kQ;
         uint64_t idx16 = 4 * (jump_super_q + 2) + 2 * jump_inside_super_q;
-        idx64 = idx16 / 4;
-        shift = 16 * (idx16 % 4);
+        uint64_t idx64 = idx16 / 4;
+        uint64_t shift = 16 * (idx16 % 4);
         uint64_t mask = uint64_t(0xffff) << shift;
         const uint64_t jump_cum_keys = jump[jump_super_q] + ((jump[idx64] & mask) >> shift);
         idx16++;
@@ -417,6 +426,20 @@ class DoubleEliasFanoList16 {
         shift = 16 * (idx16 % 4);
         mask = uint64_t(0xffff) << shift;
         const uint64_t jump_position = jump[jump_super_q + 1] + ((jump[idx64] & mask) >> shift);
+        return {jump_cum_keys, jump_position};
+    }
+
+    void get(const uint64_t i, uint64_t& cum_keys, uint64_t& position, uint64_t& window_cum_keys, uint64_t& select_cum_keys,
+             uint64_t& curr_word_cum_keys, uint64_t& lower, uint64_t& cum_delta) const {
+        const uint64_t pos_lower = i * (l_cum_keys + l_position);
+        uint64_t idx64 = pos_lower / 64;
+        uint64_t shift = pos_lower % 64;
+        lower = lower_bits[idx64] >> shift;
+        if (shift > 0) {
+            lower |= lower_bits[idx64 + 1] << (64 - shift);
+        }
+
+        const auto [jump_cum_keys, jump_position] = jumps(i);
 
         curr_word_cum_keys = jump_cum_keys / 64;
         uint64_t curr_word_position = jump_position / 64;
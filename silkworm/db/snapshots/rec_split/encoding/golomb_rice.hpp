@@ -239,6 +239,12 @@ class GolombRiceVector {
 
     [[nodiscard]] Reader reader() const { return Reader{data}; }
 
+    //! Prefetch the words read first by a Reader reset at the given fixed and unary bit offsets
+    void prefetch(const std::size_t bit_pos, const std::size_t unary_offset) const {
+        prefetch_read(data.data() + bit_pos / 64);
+        prefetch_read(data.data() + (bit_pos + unary_offset) / 64);
+    }
+
   private:
     Uint64Sequence data;
 
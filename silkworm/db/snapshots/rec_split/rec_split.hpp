@@ -57,6 +57,7 @@
 #include <numbers>
 #include <optional>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -297,15 +298,23 @@ class RecSplit {
         hasher_ = std::make_unique<Murmur3>(salt_);
     }
 
-    explicit RecSplit(std::filesystem::path index_path, std::optional<MemoryMappedRegion> index_region = {})
+    explicit RecSplit(
+        std::filesystem::path index_path,
+        std::optional<MemoryMappedRegion> index_region = {},
+        MemoryAccessPolicy access_policy = MemoryAccessPolicy::kRandom)
         : index_path_{index_path},
           encoded_file_{std::make_optional<MemoryMappedFile>(std::move(index_path), index_region)} {
         SILK_TRACE << "RecSplit encoded file path: " << encoded_file_->path();
         check_minimum_length(kFirstMetadataHeaderLength);
 
-        const auto address = encoded_file_->region().data();
+        // Any copy must happen before parsing because the Elias-Fano offsets point into the mapped region
+        if (access_policy == MemoryAccessPolicy::kHugePageCopy) {
+            encoded_file_->apply_access_policy(access_policy);
+        } else {
+            encoded_file_->advise_sequential();
+        }
 
-        encoded_file_->advise_sequential();
+        const auto address = encoded_file_->region().data();
 
         // Read fixed metadata header fields from RecSplit-encoded file
         base_data_id_ = endian::load_big_u64(address);
@@ -399,7 +408,9 @@ class RecSplit {
 
         SILKWORM_ASSERT(offset == encoded_file_->size());
 
-        encoded_file_->advise_random();
+        if (access_policy != MemoryAccessPolicy::kHugePageCopy) {
+            encoded_file_->apply_access_policy(access_policy);
+        }
 
         // Prevent any new key addition
         built_ = true;
@@ -601,54 +612,7 @@ class RecSplit {
             return 0;
         }
 
-        const std::size_t bucket = hash128_to_bucket(hash);
-        uint64_t cum_keys{0}, cum_keys_next{0}, bit_pos{0};
-        double_ef_index_.get3(bucket, cum_keys, cum_keys_next, bit_pos);
-
-        // Number of keys in this bucket
-        std::size_t m = cum_keys_next - cum_keys;
-        auto reader = golomb_rice_codes_.reader();
-        reader.read_reset(bit_pos, skip_bits(m));
-        int level = 0;
-
-        while (m > kUpperAggregationBound) {  // fanout = 2
-            const auto d = reader.read_next(golomb_param(m, memo));
-            const std::size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
-
-            const std::size_t split = ((static_cast<uint16_t>((m + 1) / 2 + kUpperAggregationBound - 1) / kUpperAggregationBound)) * kUpperAggregationBound;
-            if (hmod < split) {
-                m = split;
-            } else {
-                reader.skip_subtree(skip_nodes(split), skip_bits(split));
-                m -= split;
-                cum_keys += split;
-            }
-            level++;
-        }
-        if (m > kLowerAggregationBound) {
-            const auto d = reader.read_next(golomb_param(m, memo));
-            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
-
-            const int part = uint16_t(hmod) / kLowerAggregationBound;
-            m = std::min(kLowerAggregationBound, m - part * kLowerAggregationBound);
-            cum_keys += kLowerAggregationBound * part;
-            if (part) reader.skip_subtree(skip_nodes(kLowerAggregationBound) * part, skip_bits(kLowerAggregationBound) * part);
-            level++;
-        }
-
-        if (m > LEAF_SIZE) {
-            const auto d = reader.read_next(golomb_param(m, memo));
-            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
-
-            const int part = uint16_t(hmod) / LEAF_SIZE;
-            m = std::min(LEAF_SIZE, m - part * LEAF_SIZE);
-            cum_keys += LEAF_SIZE * part;
-            if (part) reader.skip_subtree(part, skip_bits(LEAF_SIZE) * part);
-            level++;
-        }
-
-        const auto b = reader.read_next(golomb_param(m, memo));
-        return cum_keys + remap16(remix(hash.second + b + kStartSeed[level]), m);
+        return find_in_bucket(hash, locate_bucket(hash));
     }
 
     //! Return the value associated with the given key within the MPHF mapping
@@ -666,17 +630,54 @@ class RecSplit {
     //! Return the value associated with the given key within the index
     LookupResult lookup(ByteView key) const {
         const hash128_t& hashed_key{murmur_hash_3(key)};
-        const auto record = operator()(hashed_key);
-        const auto position = 1 + 8 + bytes_per_record_ * (record + 1);
+        return record_value(hashed_key, operator()(hashed_key));
+    }
+
+    //! Return the values associated with the given keys within the index, in the same order
+    //! \details Keys are resolved in groups going through all the lookup steps one group at a time: each step issues
+    //! the prefetch for the data needed by the next one, so that the cache misses of different keys overlap
+    void lookup(std::span<const ByteView> keys, std::span<LookupResult> results) const {
+        ensure(keys.size() == results.size(), "RecSplit: batch lookup with mismatching keys and results sizes");
+        if (keys.empty()) {
+            return;
+        }
+        ensure(built_, "RecSplit: perfect hash function not built yet");
+        ensure(key_count_ > 0, "RecSplit: invalid lookup with zero keys, use empty() to guard");
+
+        if (key_count_ == 1) {
+            for (std::size_t i{0}; i < keys.size(); ++i) {
+                results[i] = lookup(keys[i]);
+            }
+            return;
+        }
 
         const auto region = encoded_file_->region();
-        ensure(position + sizeof(uint64_t) < region.size(),
-               [&]() { return "position: " + std::to_string(position) + " plus 8 exceeds file length"; });
-        const auto value = endian::load_big_u64(region.data() + position) & record_mask_;
-        if (less_false_positives_ && value < existence_filter_.size()) {
-            return {value, existence_filter_.at(value) == static_cast<uint8_t>(hashed_key.first)};
+        std::array<hash128_t, kLookupGroupSize> hashes{};
+        std::array<uint64_t, kLookupGroupSize> buckets{};
+        std::array<BucketLocation, kLookupGroupSize> locations{};
+        std::array<std::size_t, kLookupGroupSize> records{};
+        for (std::size_t first{0}; first < keys.size(); first += kLookupGroupSize) {
+            const std::size_t count{std::min(kLookupGroupSize, keys.size() - first)};
+            for (std::size_t i{0}; i < count; ++i) {
+                hashes[i] = murmur_hash_3(keys[first + i]);
+                buckets[i] = hash128_to_bucket(hashes[i]);
+                double_ef_index_.prefetch(buckets[i]);
+            }
+            for (std::size_t i{0}; i < count; ++i) {
+                double_ef_index_.prefetch_upper_bits(buckets[i]);
+            }
+            for (std::size_t i{0}; i < count; ++i) {
+                locations[i] = locate_bucket(buckets[i]);
+                golomb_rice_codes_.prefetch(locations[i].bit_pos, skip_bits(locations[i].key_count()));
+            }
+            for (std::size_t i{0}; i < count; ++i) {
+                records[i] = find_in_bucket(hashes[i], locations[i]);
+                prefetch_read(region.data() + record_position(records[i]));
+            }
+            for (std::size_t i{0}; i < count; ++i) {
+                results[first + i] = record_value(hashes[i], records[i]);
+            }
         }
-        return {value, true};
     }
 
     //! Return the offset of the i-th element in the index. Perfect hash table lookup is not performed,
@@ -699,6 +700,19 @@ class RecSplit {
         return found ? std::optional{lookup_by_ordinal(i)} : std::nullopt;
     }
 
+    //! Return the offsets associated with the given keys within the index, in the same order
+    //! \see lookup(std::span<const ByteView>, std::span<LookupResult>)
+    [[nodiscard]] std::vector<std::optional<std::size_t>> lookup_by_keys(std::span<const ByteView> keys) const {
+        std::vector<LookupResult> results(keys.size());
+        lookup(keys, results);
+        std::vector<std::optional<std::size_t>> offsets;
+        offsets.reserve(results.size());
+        for (const auto& [i, found] : results) {
+            offsets.push_back(found ? std::optional{lookup_by_ordinal(i)} : std::nullopt);
+        }
+        return offsets;
+    }
+
     //! Return the number of keys used to build the RecSplit instance
     [[nodiscard]] std::size_t key_count() const { return key_count_; }
 
@@ -723,6 +737,92 @@ class RecSplit {
     [[nodiscard]] MemoryMappedRegion memory_file_region() const { return encoded_file_ ? encoded_file_->region() : MemoryMappedRegion{}; }
 
   private:
+    //! Number of keys going together through each step of batch lookup
+    static constexpr std::size_t kLookupGroupSize{16};
+
+    //! The position of one bucket within the Golomb-Rice codes
+    struct BucketLocation {
+        uint64_t cum_keys{0};       // Number of keys in all the previous buckets
+        uint64_t cum_keys_next{0};  // Number of keys in all the previous buckets plus this one
+        uint64_t bit_pos{0};        // Bit position of the bucket codes in Golomb-Rice vector
+
+        [[nodiscard]] std::size_t key_count() const { return cum_keys_next - cum_keys; }
+    };
+
+    [[nodiscard]] BucketLocation locate_bucket(const hash128_t& hash) const { return locate_bucket(hash128_to_bucket(hash)); }
+
+    [[nodiscard]] BucketLocation locate_bucket(uint64_t bucket) const {
+        BucketLocation location;
+        double_ef_index_.get3(bucket, location.cum_keys, location.cum_keys_next, location.bit_pos);
+        return location;
+    }
+
+    //! Return the value associated with the given 128-bit bucket hash walking the splitting tree of its bucket
+    [[nodiscard]] std::size_t find_in_bucket(const hash128_t& hash, const BucketLocation& location) const {
+        uint64_t cum_keys{location.cum_keys};
+
+        // Number of keys in this bucket
+        std::size_t m = location.key_count();
+        auto reader = golomb_rice_codes_.reader();
+        reader.read_reset(location.bit_pos, skip_bits(m));
+        int level = 0;
+
+        while (m > kUpperAggregationBound) {  // fanout = 2
+            const auto d = reader.read_next(golomb_param(m, memo));
+            const std::size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
+
+            const std::size_t split = ((static_cast<uint16_t>((m + 1) / 2 + kUpperAggregationBound - 1) / kUpperAggregationBound)) * kUpperAggregationBound;
+            if (hmod < split) {
+                m = split;
+            } else {
+                reader.skip_subtree(skip_nodes(split), skip_bits(split));
+                m -= split;
+                cum_keys += split;
+            }
+            level++;
+        }
+        if (m > kLowerAggregationBound) {
+            const auto d = reader.read_next(golomb_param(m, memo));
+            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
+
+            const int part = uint16_t(hmod) / kLowerAggregationBound;
+            m = std::min(kLowerAggregationBound, m - part * kLowerAggregationBound);
+            cum_keys += kLowerAggregationBound * part;
+            if (part) reader.skip_subtree(skip_nodes(kLowerAggregationBound) * part, skip_bits(kLowerAggregationBound) * part);
+            level++;
+        }
+
+        if (m > LEAF_SIZE) {
+            const auto d = reader.read_next(golomb_param(m, memo));
+            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
+
+            const int part = uint16_t(hmod) / LEAF_SIZE;
+            m = std::min(LEAF_SIZE, m - part * LEAF_SIZE);
+            cum_keys += LEAF_SIZE * part;
+            if (part) reader.skip_subtree(part, skip_bits(LEAF_SIZE) * part);
+            level++;
+        }
+
+        const auto b = reader.read_next(golomb_param(m, memo));
+        return cum_keys + remap16(remix(hash.second + b + kStartSeed[level]), m);
+    }
+
+    [[nodiscard]] std::size_t record_position(std::size_t record) const { return 1 + 8 + bytes_per_record_ * (record + 1); }
+
+    //! Return the value stored for the given record and whether it is consistent with the given hash
+    [[nodiscard]] LookupResult record_value(const hash128_t& hash, std::size_t record) const {
+        const auto position = record_position(record);
+
+        const auto region = encoded_file_->region();
+        ensure(position + sizeof(uint64_t) < region.size(),
+               [&]() { return "position: " + std::to_string(position) + " plus 8 exceeds file length"; });
+        const auto value = endian::load_big_u64(region.data() + position) & record_mask_;
+        if (less_false_positives_ && value < existence_filter_.size()) {
+            return {value, existence_filter_.at(value) == static_cast<uint8_t>(hash.first)};
+        }
+        return {value, true};
+    }
+
     static inline std::size_t skip_bits(std::size_t m) { return memo[m] & 0xFFFF; }
 
     static inline std::size_t skip_nodes(std::size_t m) { return (memo[m] >> 16) & 0x7FF; }
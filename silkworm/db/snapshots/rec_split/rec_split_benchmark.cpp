@@ -0,0 +1,97 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/infra/test_util/temporary_file.hpp>
+
+#include "rec_split_seq.hpp"
+
+namespace silkworm::snapshots::rec_split {
+
+using silkworm::test_util::SetLogVerbosityGuard;
+using silkworm::test_util::TemporaryFile;
+
+constexpr size_t kBenchmarkKeyCount{1'000'000};
+
+//! The index shared by all the benchmarks, built just once
+struct BenchmarkIndex {
+    BenchmarkIndex() {
+        SetLogVerbosityGuard guard{log::Level::kNone};
+        RecSplitSettings settings{
+            .keys_count = kBenchmarkKeyCount,
+            .bucket_size = 2'000,
+            .index_path = file.path(),
+            .base_data_id = 0,
+            .less_false_positives = true};
+        RecSplit8 rs{settings, seq_build_strategy()};
+        keys.reserve(kBenchmarkKeyCount);
+        for (size_t i{0}; i < kBenchmarkKeyCount; ++i) {
+            keys.push_back("key " + std::to_string(i));
+            rs.add_key(keys.back(), i * 17);
+        }
+        rs.build();
+    }
+
+    TemporaryFile file;
+    std::vector<std::string> keys;
+};
+
+static const BenchmarkIndex& benchmark_index() {
+    static const BenchmarkIndex index;
+    return index;
+}
+
+//! Keys spread over the whole index to defeat the caches, as lookups for unrelated hashes do
+static std::vector<ByteView> lookup_keys(size_t count) {
+    const auto& keys{benchmark_index().keys};
+    std::vector<ByteView> key_views;
+    key_views.reserve(count);
+    for (size_t i{0}; i < count; ++i) {
+        key_views.push_back(string_view_to_byte_view(keys[(i * 7'919) % keys.size()]));
+    }
+    return key_views;
+}
+
+static void lookup_single(benchmark::State& state) {
+    const auto keys{lookup_keys(static_cast<size_t>(state.range(0)))};
+    RecSplit8 rs{benchmark_index().file.path()};
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto key : keys) {
+            benchmark::DoNotOptimize(rs.lookup(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lookup_single)->Arg(64)->Arg(1'024)->Arg(16'384);
+
+static void lookup_batched(benchmark::State& state) {
+    const auto keys{lookup_keys(static_cast<size_t>(state.range(0)))};
+    RecSplit8 rs{benchmark_index().file.path()};
+    std::vector<RecSplit8::LookupResult> results(keys.size());
+    for ([[maybe_unused]] auto _ : state) {
+        rs.lookup(keys, results);
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lookup_batched)->Arg(64)->Arg(1'024)->Arg(16'384);
+
+}  // namespace silkworm::snapshots::rec_split
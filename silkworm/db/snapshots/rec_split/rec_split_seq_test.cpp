@@ -261,6 +261,68 @@ TEST_CASE("RecSplit8: double index lookup", "[silkworm][snapshots][recsplit][ign
     }
 }
 
+TEST_CASE("RecSplit8: batch index lookup", "[silkworm][snapshots][recsplit]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryFile index_file;
+    RecSplitSettings settings{
+        .keys_count = 1'000,
+        .bucket_size = 100,
+        .index_path = index_file.path(),
+        .base_data_id = 0,
+        .less_false_positives = true};
+    RecSplit8 rs1{settings, seq_build_strategy(), /*.salt=*/kTestSalt};
+
+    std::vector<std::string> keys;
+    for (size_t i{0}; i < settings.keys_count; ++i) {
+        keys.push_back("key " + std::to_string(i));
+        rs1.add_key(keys.back(), i * 17);
+    }
+    CHECK(rs1.build() == false /*collision_detected*/);
+    keys.emplace_back("missing key");
+
+    RecSplit8 rs2{settings.index_path};
+    std::vector<ByteView> key_views;
+    for (const auto& key : keys) {
+        key_views.push_back(string_view_to_byte_view(key));
+    }
+    std::vector<RecSplit8::LookupResult> results(key_views.size());
+    rs2.lookup(key_views, results);
+    for (size_t i{0}; i < keys.size(); ++i) {
+        CHECK(results[i] == rs2.lookup(keys[i]));
+    }
+
+    const auto offsets{rs2.lookup_by_keys(key_views)};
+    REQUIRE(offsets.size() == keys.size());
+    for (size_t i{0}; i < settings.keys_count; ++i) {
+        CHECK(offsets[i] == i * 17);
+    }
+    CHECK(offsets.back() == rs2.lookup_by_key(key_views.back()));
+}
+
+TEST_CASE("RecSplit8: index lookup with huge page copy", "[silkworm][snapshots][recsplit]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryFile index_file;
+    RecSplitSettings settings{
+        .keys_count = 1'000,
+        .bucket_size = 100,
+        .index_path = index_file.path(),
+        .base_data_id = 0,
+        .less_false_positives = true};
+    RecSplit8 rs1{settings, seq_build_strategy(), /*.salt=*/kTestSalt};
+
+    for (size_t i{0}; i < settings.keys_count; ++i) {
+        rs1.add_key("key " + std::to_string(i), i * 17);
+    }
+    CHECK(rs1.build() == false /*collision_detected*/);
+
+    RecSplit8 rs2{settings.index_path, {}, MemoryAccessPolicy::kHugePageCopy};
+    for (size_t i{0}; i < settings.keys_count; ++i) {
+        const auto [enumeration_index, found] = rs2.lookup("key " + std::to_string(i));
+        CHECK(found);
+        CHECK(rs2.lookup_by_ordinal(enumeration_index) == i * 17);
+    }
+}
+
 TEST_CASE("RecSplit8: unsupported feature", "[silkworm][snapshots][recsplit][ignore]") {
     SetLogVerbosityGuard guard{log::Level::kInfo};
 
@@ -17,11 +17,17 @@
 #include "repository.hpp"
 
 #include <algorithm>
+#include <exception>
+#include <future>
 #include <iterator>
+#include <thread>
 #include <utility>
 
+#include <silkworm/core/common/util.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 namespace silkworm::snapshots {
 
@@ -31,45 +37,144 @@ SnapshotRepository::SnapshotRepository(
     SnapshotSettings settings,
     std::unique_ptr<SnapshotBundleFactory> bundle_factory)
     : settings_(std::move(settings)),
-      bundle_factory_(std::move(bundle_factory)) {}
+      bundle_factory_(std::move(bundle_factory)),
+      bundles_(std::make_shared<Bundles>()) {
+    if (settings_.word_cache_size > 0) {
+        word_cache_ = std::make_shared<WordCache>(settings_.word_cache_size);
+    }
+}
 
 SnapshotRepository::~SnapshotRepository() {
     close();
 }
 
 void SnapshotRepository::add_snapshot_bundle(SnapshotBundle bundle) {
-    bundle.reopen();
+    auto new_bundle = open_bundle(std::move(bundle));
+    std::scoped_lock writers_lock(writers_mutex_);
+    publish_bundles({std::move(new_bundle)});
+}
+
+std::shared_ptr<SnapshotBundle> SnapshotRepository::open_bundle(SnapshotBundle bundle) const {
+    // The bundle gets closed as soon as neither the repository nor any reader is using it
+    std::shared_ptr<SnapshotBundle> new_bundle{
+        new SnapshotBundle{std::move(bundle)},
+        [](SnapshotBundle* b) {
+            b->close();
+            delete b;
+        }};
+    attach_word_cache(*new_bundle);
+    set_access_policies(*new_bundle);
+    new_bundle->reopen();
+    return new_bundle;
+}
+
+void SnapshotRepository::publish_bundles(std::vector<std::shared_ptr<SnapshotBundle>> new_bundles) {
+    auto bundles = std::make_shared<Bundles>(*this->bundles());
+    for (auto& new_bundle : new_bundles) {
+        const BlockNum block_from = new_bundle->block_from();
+        const BlockNum block_to = new_bundle->block_to();
+        // Drop the bundles overlapping the new one, e.g. the smaller ones merged into it
+        std::erase_if(*bundles, [&](const auto& entry) {
+            const SnapshotBundle& b = *entry.second;
+            return (b.block_from() == block_from) || ((b.block_from() < block_to) && (block_from < b.block_to()));
+        });
+        bundles->emplace(block_from, std::move(new_bundle));
+    }
+
+    std::shared_ptr<const Bundles> old_bundles;
+    {
+        std::scoped_lock lock(bundles_mutex_);
+        old_bundles = std::exchange(bundles_, std::move(bundles));
+    }
+    // Any bundle replaced and no longer in use is closed here, outside the lock
+}
+
+void SnapshotRepository::unpublish_bundle(const std::shared_ptr<SnapshotBundle>& bundle) {
+    std::scoped_lock writers_lock(writers_mutex_);
+    auto bundles = std::make_shared<Bundles>(*this->bundles());
+    if (std::erase_if(*bundles, [&](const auto& entry) { return entry.second == bundle; }) == 0) {
+        return;
+    }
+
+    std::shared_ptr<const Bundles> old_bundles;
+    {
+        std::scoped_lock lock(bundles_mutex_);
+        old_bundles = std::exchange(bundles_, std::move(bundles));
+    }
+    // The unpublished bundle, if no longer in use, is closed here outside the lock
+}
+
+std::shared_ptr<const SnapshotRepository::Bundles> SnapshotRepository::bundles() const {
     std::scoped_lock lock(bundles_mutex_);
-    bundles_.emplace(bundle.block_from(), std::move(bundle));
+    return bundles_;
 }
 
 std::size_t SnapshotRepository::bundles_count() const {
-    std::scoped_lock lock(bundles_mutex_);
-    return bundles_.size();
+    return bundles()->size();
 }
 
 void SnapshotRepository::close() {
     SILK_TRACE << "Close snapshot repository folder: " << settings_.repository_dir.string();
 
-    std::map<BlockNum, SnapshotBundle> bundles;
+    stop_background_verification();
+
+    std::shared_ptr<const Bundles> bundles;
     {
+        std::scoped_lock writers_lock(writers_mutex_);
         std::scoped_lock lock(bundles_mutex_);
-        bundles = std::exchange(bundles_, {});
+        bundles = std::exchange(bundles_, std::make_shared<Bundles>());
+    }
+    // Bundles still used by some reader get closed when released
+    bundles.reset();
+
+    if (const auto stats = word_cache_stats()) {
+        SILK_INFO << "Snapshot word cache hits: " << stats->hits << " misses: " << stats->misses
+                  << " hit ratio: " << stats->hit_ratio() << " memory: " << human_size(stats->memory_usage);
+        word_cache_->clear();
+    }
+}
+
+std::optional<WordCache::Stats> SnapshotRepository::word_cache_stats() const {
+    if (!word_cache_) {
+        return std::nullopt;
     }
+    return word_cache_->stats();
+}
 
-    for (auto& entry : bundles) {
-        auto& bundle = entry.second;
-        bundle.close();
+void SnapshotRepository::attach_word_cache(SnapshotBundle& bundle) const {
+    if (!word_cache_) {
+        return;
+    }
+    for (Snapshot& snapshot : bundle.snapshots()) {
+        snapshot.set_word_cache(word_cache_);
+    }
+}
+
+void SnapshotRepository::set_access_policies(SnapshotBundle& bundle) const {
+    // Segments need no policy here: they are read at random and switched to sequential while iterated
+    const auto index_types = bundle.index_types();
+    const auto indexes = bundle.indexes();
+    for (size_t i = 0; i < indexes.size(); ++i) {
+        Index& index = indexes[i];
+        // Header and body indexes are hit by almost any block query, transaction indexes are large and seldom used
+        const bool is_hot = (index_types[i] == SnapshotType::headers) || (index_types[i] == SnapshotType::bodies);
+        std::error_code ec;
+        const auto file_size = fs::file_size(index.path().path(), ec);
+        if (is_hot && !ec && file_size <= settings_.index_huge_page_max_size) {
+            index.set_access_policy(MemoryAccessPolicy::kHugePageCopy);
+        } else {
+            index.set_access_policy(MemoryAccessPolicy::kRandom);
+        }
     }
 }
 
 BlockNum SnapshotRepository::max_block_available() const {
-    std::scoped_lock lock(bundles_mutex_);
-    if (bundles_.empty())
+    const auto bundles = this->bundles();
+    if (bundles->empty())
         return 0;
 
     // a bundle with the max block range is last in the sorted bundles map
-    auto& bundle = bundles_.rbegin()->second;
+    const auto& bundle = *bundles->rbegin()->second;
     return (bundle.block_from() < bundle.block_to()) ? bundle.block_to() - 1 : bundle.block_from();
 }
 
@@ -91,8 +196,10 @@ std::vector<BlockNumRange> SnapshotRepository::missing_block_ranges() const {
 
 std::optional<SnapshotAndIndex> SnapshotRepository::find_segment(SnapshotType type, BlockNum number) const {
     auto bundle = find_bundle(number);
-    if (bundle) {
-        return bundle->snapshot_and_index(type);
+    if (bundle && (type != SnapshotType::receipts || bundle->has_receipts())) {
+        SnapshotAndIndex snapshot_and_index = bundle->snapshot_and_index(type);
+        snapshot_and_index.owner = std::move(bundle);
+        return snapshot_and_index;
     }
     return std::nullopt;
 }
@@ -115,6 +222,9 @@ std::vector<std::shared_ptr<IndexBuilder>> SnapshotRepository::missing_indexes()
 
 void SnapshotRepository::reopen_folder() {
     SILK_INFO << "Reopen snapshot repository folder: " << settings_.repository_dir.string();
+    ReopenMetrics metrics;
+    StopWatch sw{StopWatch::kStart};
+
     SnapshotPathList all_snapshot_paths = get_segment_files();
     SnapshotPathList all_index_paths = get_idx_files();
 
@@ -137,49 +247,192 @@ void SnapshotRepository::reopen_folder() {
         num = groups.begin()->first;
     }
 
-    std::unique_lock lock(bundles_mutex_);
+    std::unique_lock writers_lock(writers_mutex_);
 
+    // Keep the open bundles unless a segment with a different range (e.g. merged) replaces them
+    std::vector<SnapshotBundle> bundles_to_open;
+    const auto bundles = this->bundles();
+    // The optional receipts do not count for bundle completeness
+    auto mandatory_count = [](const std::map<SnapshotType, size_t>& group) {
+        return group.size() - (group.contains(SnapshotType::receipts) ? 1 : 0);
+    };
     while (groups.contains(num) &&
-           (groups[num][false].size() == SnapshotBundle::kSnapshotsCount) &&
-           (groups[num][true].size() == SnapshotBundle::kIndexesCount)) {
-        if (!bundles_.contains(num)) {
-            auto snapshot_path = [&](SnapshotType type) {
-                return all_snapshot_paths[groups[num][false][type]];
-            };
-            auto index_path = [&](SnapshotType type) {
-                return all_index_paths[groups[num][true][type]];
-            };
-            SnapshotBundle bundle = bundle_factory_->make(snapshot_path, index_path);
-            bundle.reopen();
-
-            bundles_.emplace(num, std::move(bundle));
-        }
+           (mandatory_count(groups[num][false]) == SnapshotBundle::kSnapshotsCount) &&
+           (mandatory_count(groups[num][true]) == SnapshotBundle::kIndexesCount)) {
+        auto& snapshot_group = groups[num][false];
+        auto& index_group = groups[num][true];
+        const BlockNum block_to = all_snapshot_paths[snapshot_group[SnapshotType::headers]].block_to();
+
+        // Paths of missing optional files are provided anyway, the bundle drops them on reopen
+        auto snapshot_path = [&](SnapshotType type) {
+            const auto it = snapshot_group.find(type);
+            if (it == snapshot_group.end()) {
+                return SnapshotPath::from(settings_.repository_dir, kSnapshotV1, num, block_to, type);
+            }
+            return all_snapshot_paths[it->second];
+        };
+        auto index_path = [&](SnapshotType type) {
+            const auto it = index_group.find(type);
+            if (it == index_group.end()) {
+                return SnapshotPath::from(settings_.repository_dir, kSnapshotV1, num, block_to, type, kIdxExtension);
+            }
+            return all_index_paths[it->second];
+        };
 
-        auto& bundle = bundles_.at(num);
+        const auto it = bundles->find(num);
+        if ((it == bundles->end()) || (it->second->block_to() != block_to)) {
+            bundles_to_open.push_back(bundle_factory_->make(snapshot_path, index_path));
+        }
 
-        if (num < bundle.block_to()) {
-            num = bundle.block_to();
+        if (num < block_to) {
+            num = block_to;
         } else {
             break;
         }
     }
+    metrics.scan = sw.lap().second;
+
+    // Open and verify in parallel, any failure is thrown before publishing anything
+    std::vector<std::shared_ptr<SnapshotBundle>> opened_bundles(bundles_to_open.size());
+    run_in_parallel(bundles_to_open.size(), [&](size_t i) {
+        opened_bundles[i] = open_bundle(std::move(bundles_to_open[i]));
+    });
+    metrics.open = sw.lap().second;
+
+    // In lazy mode just the newest bundle is verified before publishing, the older ones are verified in background
+    std::vector<std::shared_ptr<SnapshotBundle>> deferred_bundles;
+    if (settings_.lazy_verification && (opened_bundles.size() > 1)) {
+        deferred_bundles.assign(opened_bundles.begin(), opened_bundles.end() - 1);
+    }
+    const size_t eager_offset = deferred_bundles.size();
+    run_in_parallel(opened_bundles.size() - eager_offset, [&](size_t i) {
+        opened_bundles[eager_offset + i]->verify(settings_.verify_content);
+    });
+    metrics.verify = sw.lap().second;
 
-    lock.unlock();
+    metrics.opened_bundles = opened_bundles.size();
+    metrics.deferred_verifications = deferred_bundles.size();
+    publish_bundles(std::move(opened_bundles));
+    metrics.publish = sw.lap().second;
+
+    writers_lock.unlock();
+
+    if (!deferred_bundles.empty()) {
+        verify_in_background(std::move(deferred_bundles));
+    }
+    {
+        std::scoped_lock lock(bundles_mutex_);
+        reopen_metrics_ = metrics;
+    }
 
-    SILK_INFO << "Total reopened bundles: " << bundles_count()
+    SILK_INFO << "Total reopened bundles: " << bundles_count() << " (new: " << metrics.opened_bundles << ")"
               << " snapshots: " << total_snapshots_count()
               << " indexes: " << total_indexes_count();
+    SILK_INFO << "Reopen snapshot repository phases: scan " << StopWatch::format(metrics.scan)
+              << " open " << StopWatch::format(metrics.open)
+              << " verify " << StopWatch::format(metrics.verify)
+              << " publish " << StopWatch::format(metrics.publish)
+              << " verifications deferred: " << metrics.deferred_verifications;
+    if (const auto stats = word_cache_stats()) {
+        SILK_INFO << "Snapshot word cache entries: " << stats->entries << " hit ratio: " << stats->hit_ratio()
+                  << " memory: " << human_size(stats->memory_usage);
+    }
 }
 
-const SnapshotBundle* SnapshotRepository::find_bundle(BlockNum number) const {
+SnapshotRepository::ReopenMetrics SnapshotRepository::last_reopen_metrics() const {
     std::scoped_lock lock(bundles_mutex_);
+    return reopen_metrics_;
+}
+
+void SnapshotRepository::run_in_parallel(size_t count, const std::function<void(size_t)>& task) const {
+    if (count == 0) {
+        return;
+    }
+    const size_t num_workers{std::min<size_t>(count, std::max(std::thread::hardware_concurrency(), 1u))};
+    ThreadPool workers{static_cast<unsigned>(num_workers)};
+    std::vector<std::future<void>> results;
+    results.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        results.push_back(workers.submit([&task, i]() { task(i); }));
+    }
+
+    std::exception_ptr first_error;
+    for (auto& result : results) {
+        try {
+            result.get();
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+void SnapshotRepository::verify_in_background(std::vector<std::shared_ptr<SnapshotBundle>> bundles) {
+    std::scoped_lock lock(verification_mutex_);
+    // Newest bundles first: they are the most likely to be used
+    pending_verifications_.insert(pending_verifications_.end(), bundles.rbegin(), bundles.rend());
+    if (verification_running_) {
+        return;
+    }
+    if (verification_thread_.joinable()) {
+        verification_thread_.join();
+    }
+    verification_running_ = true;
+    stop_verification_ = false;
+    verification_thread_ = std::thread{[this]() {
+        StopWatch sw{StopWatch::kStart};
+        size_t verified_count{0};
+        while (!stop_verification_) {
+            std::shared_ptr<SnapshotBundle> bundle;
+            {
+                std::scoped_lock verification_lock(verification_mutex_);
+                if (pending_verifications_.empty()) {
+                    verification_running_ = false;
+                    break;
+                }
+                bundle = std::move(pending_verifications_.front());
+                pending_verifications_.pop_front();
+            }
+            try {
+                bundle->verify(settings_.verify_content);
+                ++verified_count;
+            } catch (const std::exception& ex) {
+                SILK_ERROR << "Snapshot bundle [" << bundle->block_from() << ", " << bundle->block_to() << ")"
+                           << " verification failed, bundle removed: " << ex.what();
+                unpublish_bundle(bundle);
+            }
+        }
+        SILK_INFO << "Background snapshot verification: " << verified_count << " bundles in " << StopWatch::format(sw.since_start());
+    }};
+}
+
+void SnapshotRepository::stop_background_verification() {
+    {
+        std::scoped_lock lock(verification_mutex_);
+        stop_verification_ = true;
+        pending_verifications_.clear();
+    }
+    if (verification_thread_.joinable()) {
+        verification_thread_.join();
+    }
+    std::scoped_lock lock(verification_mutex_);
+    verification_running_ = false;
+}
+
+std::shared_ptr<SnapshotBundle> SnapshotRepository::find_bundle(BlockNum number) const {
+    const auto bundles = this->bundles();
 
     // Search for target segment in reverse order (from the newest segment to the oldest one)
-    for (const auto& bundle : this->view_bundles_reverse()) {
+    for (const auto& entry : std::ranges::reverse_view(*bundles)) {
+        const auto& bundle = entry.second;
         // We're looking for the segment containing the target block number in its block range
-        if (((bundle.block_from() <= number) && (number < bundle.block_to())) ||
-            ((bundle.block_from() == number) && (bundle.block_from() == bundle.block_to()))) {
-            return &bundle;
+        if (((bundle->block_from() <= number) && (number < bundle->block_to())) ||
+            ((bundle->block_from() == number) && (bundle->block_from() == bundle->block_to()))) {
+            return bundle;
         }
     }
     return nullptr;
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <filesystem>
 #include <functional>
 #include <map>
@@ -24,24 +26,30 @@
 #include <optional>
 #include <ranges>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <silkworm/core/common/base.hpp>
-#include <silkworm/db/snapshots/common/iterator/map_values_view.hpp>
+#include <silkworm/db/snapshots/common/iterator/shared_map_values_view.hpp>
 #include <silkworm/db/snapshots/index_builder.hpp>
 #include <silkworm/db/snapshots/path.hpp>
 #include <silkworm/db/snapshots/settings.hpp>
 #include <silkworm/db/snapshots/snapshot_and_index.hpp>
 #include <silkworm/db/snapshots/snapshot_bundle.hpp>
 #include <silkworm/db/snapshots/snapshot_bundle_factory.hpp>
+#include <silkworm/db/snapshots/word_cache.hpp>
+#include <silkworm/infra/common/stopwatch.hpp>
 
 namespace silkworm::snapshots {
 
 struct IndexBuilder;
 
 //! Read-only repository for all snapshot files.
-//! @details Some simplifications are currently in place:
-//! - it opens snapshots only on startup and they are immutable
+//! @details Bundles are added or replaced one at a time on a copy of the bundle set, which is then published:
+//! readers keep using the set they got (and the bundles in it) without blocking on any reopen.
+//! New bundles are opened and verified in parallel; in lazy mode the older ones are verified in background
+//! after being published and removed if found inconsistent.
+//! Some simplifications are currently in place:
 //! - all snapshots of given blocks range must exist (to make such range available)
 //! - gaps in blocks range are not allowed
 //! - segments have [from:to) semantic
@@ -56,9 +64,22 @@ class SnapshotRepository {
     [[nodiscard]] std::filesystem::path path() const { return settings_.repository_dir; }
     [[nodiscard]] const SnapshotBundleFactory& bundle_factory() const { return *bundle_factory_; }
 
+    //! Wall-clock duration of each phase of reopen_folder
+    struct ReopenMetrics {
+        StopWatch::Duration scan{0};     // listing the files and grouping them in bundles
+        StopWatch::Duration open{0};     // opening the new bundles
+        StopWatch::Duration verify{0};   // verifying the new bundles before publishing them
+        StopWatch::Duration publish{0};  // publishing the new bundle set
+        std::size_t opened_bundles{0};
+        std::size_t deferred_verifications{0};
+    };
+
     void reopen_folder();
     void close();
 
+    [[nodiscard]] ReopenMetrics last_reopen_metrics() const;
+
+    //! Add the bundle replacing any existing bundle overlapping its block range
     void add_snapshot_bundle(SnapshotBundle bundle);
 
     [[nodiscard]] std::size_t bundles_count() const;
@@ -73,13 +94,34 @@ class SnapshotRepository {
     [[nodiscard]] std::vector<std::shared_ptr<IndexBuilder>> missing_indexes() const;
     void remove_stale_indexes() const;
 
-    auto view_bundles() const { return make_map_values_view(bundles_); }
+    //! A view over the current bundles, which stay open as long as the view is alive
+    auto view_bundles() const { return SharedMapValuesView<BlockNum, SnapshotBundle>{bundles()}; }
     auto view_bundles_reverse() const { return std::ranges::reverse_view(view_bundles()); }
 
     [[nodiscard]] std::optional<SnapshotAndIndex> find_segment(SnapshotType type, BlockNum number) const;
 
+    //! The hit ratio and memory usage of the cache of decoded words, if enabled
+    [[nodiscard]] std::optional<WordCache::Stats> word_cache_stats() const;
+
   private:
-    const SnapshotBundle* find_bundle(BlockNum number) const;
+    using Bundles = std::map<BlockNum, std::shared_ptr<SnapshotBundle>>;
+
+    std::shared_ptr<const Bundles> bundles() const;
+    std::shared_ptr<SnapshotBundle> find_bundle(BlockNum number) const;
+
+    std::shared_ptr<SnapshotBundle> open_bundle(SnapshotBundle bundle) const;
+
+    //! Publish a new bundle set with the given open bundles, replacing the overlapping ones
+    void publish_bundles(std::vector<std::shared_ptr<SnapshotBundle>> new_bundles);
+    void unpublish_bundle(const std::shared_ptr<SnapshotBundle>& bundle);
+
+    void run_in_parallel(std::size_t count, const std::function<void(std::size_t)>& task) const;
+
+    void verify_in_background(std::vector<std::shared_ptr<SnapshotBundle>> bundles);
+    void stop_background_verification();
+
+    void attach_word_cache(SnapshotBundle& bundle) const;
+    void set_access_policies(SnapshotBundle& bundle) const;
 
     [[nodiscard]] SnapshotPathList get_segment_files() const {
         return get_files(kSegmentExtension);
@@ -99,9 +141,25 @@ class SnapshotRepository {
     //! SnapshotBundle factory
     std::unique_ptr<SnapshotBundleFactory> bundle_factory_;
 
-    //! Full snapshot bundles ordered by block_from
-    std::map<BlockNum, SnapshotBundle> bundles_;
+    //! Full snapshot bundles ordered by block_from: the map is never modified after publication
+    std::shared_ptr<const Bundles> bundles_;
+    //! Protects just the read and the swap of the bundles_ pointer, never held while opening files
     mutable std::mutex bundles_mutex_;
+    //! Serializes the writers of new bundle sets
+    std::mutex writers_mutex_;
+
+    //! The cache of words decoded by random reads shared by all snapshots, if enabled
+    std::shared_ptr<WordCache> word_cache_;
+
+    //! The metrics of the last reopen_folder, protected by bundles_mutex_
+    ReopenMetrics reopen_metrics_;
+
+    //! The bundles published but not yet verified in background, newest first
+    std::deque<std::shared_ptr<SnapshotBundle>> pending_verifications_;
+    bool verification_running_{false};
+    std::atomic_bool stop_verification_{false};
+    std::mutex verification_mutex_;
+    std::thread verification_thread_;
 };
 
 }  // namespace silkworm::snapshots
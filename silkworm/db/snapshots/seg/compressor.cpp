@@ -16,14 +16,19 @@
 
 #include "compressor.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <limits>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include <silkworm/core/common/base.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 #include "compressor/bit_stream.hpp"
 #include "compressor/huffman_code.hpp"
@@ -48,22 +53,47 @@ constexpr size_t kSuperstringSamplingFactor = 4;
 constexpr size_t kOutputStreamBufferSize = 1_Mebi;
 constexpr size_t kIntermediateStreamBufferSize = kOutputStreamBufferSize * 4;
 
+//! Number of words read at once from the raw words file and covered with patterns by the workers
+constexpr size_t kCoveringBatchSize = 64 * 1024;
+
+using Pattern = PatternAggregator::Pattern;
+
+//! A word covered with patterns, ready to be written into the intermediate stream
+struct CoveredWord {
+    IntermediateCompressedStream::CompressedWord compressed_word;
+    Bytes uncovered_data;
+};
+
 class CompressorImpl {
   public:
     CompressorImpl(
         const std::filesystem::path& path,
-        const std::filesystem::path& tmp_dir_path)
+        const std::filesystem::path& tmp_dir_path,
+        size_t num_workers,
+        std::optional<size_t> superstring_size_limit)
         : path_(path),
           raw_words_file_path_(make_raw_words_file_path(path, tmp_dir_path)),
+          superstring_size_limit_(superstring_size_limit),
+          current_superstring_(superstring_size_limit),
           raw_words_(raw_words_file_path_, RawWordsStream::OpenMode::kCreate, kOutputStreamBufferSize),
-          pattern_aggregator_(tmp_dir_path) {}
+          pattern_aggregator_(tmp_dir_path),
+          num_workers_(num_workers > 1 ? num_workers : 1),
+          workers_(num_workers > 1 ? std::make_unique<ThreadPool>(static_cast<unsigned>(num_workers)) : nullptr) {}
     ~CompressorImpl();
 
     void add_word(ByteView word, bool is_compressed);
     void compress();
 
   private:
-    void consume_superstring(const Superstring& superstring);
+    void consume_superstring();
+    void collect_extracted_patterns();
+
+    //! Cover the given words with patterns: in parallel shards if workers are available, keeping the order of words
+    void cover_words(
+        const std::vector<std::pair<Bytes, bool>>& words,
+        std::vector<CoveredWord>& covered_words,
+        std::vector<std::unique_ptr<PatternCoveringSearch>>& searches,
+        const std::vector<Pattern>& candidate_patterns);
 
     static std::filesystem::path make_raw_words_file_path(
         const std::filesystem::path& path,
@@ -78,12 +108,18 @@ class CompressorImpl {
     std::filesystem::path path_;
     std::filesystem::path raw_words_file_path_;
 
+    std::optional<size_t> superstring_size_limit_;
     Superstring current_superstring_;
     size_t superstring_sample_cycle_index_{};
 
     RawWordsStream raw_words_;
     PatternExtractor pattern_extractor_;
     PatternAggregator pattern_aggregator_;
+
+    size_t num_workers_;
+    //! Patterns extracted from superstrings by the workers, in the same order as superstrings
+    std::deque<std::future<std::vector<Pattern>>> pending_extractions_;
+    std::unique_ptr<ThreadPool> workers_;
 };
 
 CompressorImpl::~CompressorImpl() {
@@ -95,7 +131,7 @@ void CompressorImpl::add_word(ByteView word, bool is_compressed) {
     if (is_compressed) {
         if (!current_superstring_.can_add_word(word)) {
             if (superstring_sample_cycle_index_ == 0) {
-                consume_superstring(current_superstring_);
+                consume_superstring();
             }
             current_superstring_.clear();
             superstring_sample_cycle_index_ = (superstring_sample_cycle_index_ + 1) % kSuperstringSamplingFactor;
@@ -107,10 +143,97 @@ void CompressorImpl::add_word(ByteView word, bool is_compressed) {
     raw_words_.write_word(word, is_compressed);
 }
 
-void CompressorImpl::consume_superstring(const Superstring& superstring) {
-    pattern_extractor_.extract_patterns(superstring, [this](ByteView pattern, uint64_t score) {
-        pattern_aggregator_.collect_pattern({Bytes{pattern}, score});
-    });
+void CompressorImpl::consume_superstring() {
+    if (!workers_) {
+        pattern_extractor_.extract_patterns(current_superstring_, [this](ByteView pattern, uint64_t score) {
+            pattern_aggregator_.collect_pattern({Bytes{pattern}, score});
+        });
+        return;
+    }
+
+    // Each superstring in flight takes several times its size for suffix arrays, hence bound them to the workers
+    if (pending_extractions_.size() >= num_workers_) {
+        collect_extracted_patterns();
+    }
+    auto superstring = std::make_shared<Superstring>(std::move(current_superstring_));
+    current_superstring_ = Superstring{superstring_size_limit_};
+    pending_extractions_.push_back(workers_->submit([superstring]() {
+        PatternExtractor pattern_extractor;
+        std::vector<Pattern> patterns;
+        pattern_extractor.extract_patterns(*superstring, [&patterns](ByteView pattern, uint64_t score) {
+            patterns.push_back({Bytes{pattern}, score});
+        });
+        return patterns;
+    }));
+}
+
+void CompressorImpl::collect_extracted_patterns() {
+    // The aggregation sums the scores grouped by pattern, hence its result does not depend on the collection order
+    for (auto& pattern : pending_extractions_.front().get()) {
+        pattern_aggregator_.collect_pattern(std::move(pattern));
+    }
+    pending_extractions_.pop_front();
+}
+
+static void cover_word(
+    ByteView word,
+    bool is_compressed,
+    PatternCoveringSearch& pattern_covering_search,
+    const std::vector<Pattern>& candidate_patterns,
+    CoveredWord& covered_word) {
+    auto& compressed_word = covered_word.compressed_word;
+    compressed_word.raw_length = word.size();
+    compressed_word.pattern_positions.clear();
+    covered_word.uncovered_data.clear();
+
+    if (!is_compressed) {
+        covered_word.uncovered_data.assign(word.cbegin(), word.cend());
+        return;
+    }
+
+    auto& result = pattern_covering_search.cover_word(word);
+
+    // a candidate pattern index stands for its code in the intermediate file
+    for (auto [pattern_pos, pattern_ptr] : result.pattern_positions) {
+        auto pattern = reinterpret_cast<const Pattern*>(pattern_ptr);
+        auto pattern_index = static_cast<size_t>(std::distance(candidate_patterns.data(), pattern));
+        compressed_word.pattern_positions.emplace_back(pattern_pos, pattern_index);
+    }
+
+    for (auto [start, end] : result.uncovered_ranges) {
+        covered_word.uncovered_data.append(
+            word.cbegin() + static_cast<Bytes::difference_type>(start),
+            word.cbegin() + static_cast<Bytes::difference_type>(end));
+    }
+}
+
+void CompressorImpl::cover_words(
+    const std::vector<std::pair<Bytes, bool>>& words,
+    std::vector<CoveredWord>& covered_words,
+    std::vector<std::unique_ptr<PatternCoveringSearch>>& searches,
+    const std::vector<Pattern>& candidate_patterns) {
+    covered_words.resize(words.size());
+
+    auto cover_shard = [&](size_t shard, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            cover_word(words[i].first, words[i].second, *searches[shard], candidate_patterns, covered_words[i]);
+        }
+    };
+
+    if (!workers_) {
+        cover_shard(0, 0, words.size());
+        return;
+    }
+
+    const size_t shard_size = (words.size() + searches.size() - 1) / searches.size();
+    std::vector<std::future<void>> shards;
+    for (size_t shard = 0, begin = 0; begin < words.size(); shard++, begin += shard_size) {
+        const size_t end = std::min(begin + shard_size, words.size());
+        shards.push_back(workers_->submit([=, &cover_shard]() { cover_shard(shard, begin, end); }));
+    }
+    for (auto& shard : shards) {
+        shard.get();
+    }
 }
 
 template <typename T>
@@ -129,10 +252,11 @@ static std::vector<size_t> invert_order(const std::vector<size_t>& order) {
 }
 
 void CompressorImpl::compress() {
-    using Pattern = PatternAggregator::Pattern;
-
     raw_words_.flush();
-    consume_superstring(current_superstring_);
+    consume_superstring();
+    while (!pending_extractions_.empty()) {
+        collect_extracted_patterns();
+    }
 
     auto candidate_patterns = PatternAggregator::aggregate(std::move(pattern_aggregator_));
 
@@ -141,19 +265,19 @@ void CompressorImpl::compress() {
         patterns_patricia_tree.insert(pattern.data, &pattern);
     }
 
-    PatternCoveringSearch pattern_covering_search{
-        patterns_patricia_tree,
-        [](void* pattern) { return reinterpret_cast<Pattern*>(pattern)->score; },
-    };
+    // each worker needs its own search, which keeps the state of the word being covered
+    std::vector<std::unique_ptr<PatternCoveringSearch>> pattern_covering_searches;
+    for (size_t i = 0; i < num_workers_; i++) {
+        pattern_covering_searches.push_back(std::make_unique<PatternCoveringSearch>(
+            patterns_patricia_tree,
+            [](void* pattern) { return reinterpret_cast<Pattern*>(pattern)->score; }));
+    }
 
     IntermediateCompressedStream intermediate_stream{
         intermediate_file_path(),
         kIntermediateStreamBufferSize,
     };
 
-    IntermediateCompressedStream::CompressedWord compressed_word{};
-    Bytes word_uncovered_data;
-
     // a pattern code for the intermediate file is equal to the index
     std::vector<uint64_t> intermediate_pattern_codes(candidate_patterns.size());
     std::iota(intermediate_pattern_codes.begin(), intermediate_pattern_codes.end(), 0);
@@ -163,44 +287,35 @@ void CompressorImpl::compress() {
     std::vector<uint64_t> pattern_uses(candidate_patterns.size(), 0);
     PositionsMap positions_map;
 
+    std::vector<std::pair<Bytes, bool>> words_batch;
+    std::vector<CoveredWord> covered_words_batch;
     raw_words_.rewind();
-    while (auto entry = raw_words_.read_word()) {
-        auto& [word, is_compressed] = entry.value();
-
-        words_count++;
-        if (word.empty()) empty_words_count++;
-
-        compressed_word.raw_length = word.size();
-        compressed_word.pattern_positions.clear();
-
-        if (is_compressed) {
-            auto& result = pattern_covering_search.cover_word(word);
-
-            for (auto [pattern_pos, pattern_ptr] : result.pattern_positions) {
-                auto pattern = reinterpret_cast<Pattern*>(pattern_ptr);
-                auto pattern_index = static_cast<size_t>(std::distance(&candidate_patterns[0], pattern));
+    for (bool words_left = true; words_left;) {
+        words_batch.clear();
+        while (words_batch.size() < kCoveringBatchSize) {
+            auto entry = raw_words_.read_word();
+            if (!entry) {
+                words_left = false;
+                break;
+            }
+            words_batch.push_back(std::move(*entry));
+        }
 
-                pattern_uses[pattern_index]++;
+        cover_words(words_batch, covered_words_batch, pattern_covering_searches, candidate_patterns);
 
-                size_t pattern_code = intermediate_pattern_codes[pattern_index];
-                compressed_word.pattern_positions.emplace_back(pattern_pos, pattern_code);
-            }
+        for (const auto& [compressed_word, uncovered_data] : covered_words_batch) {
+            words_count++;
+            if (compressed_word.raw_length == 0) empty_words_count++;
 
-            word_uncovered_data.clear();
-            for (auto [start, end] : result.uncovered_ranges) {
-                word_uncovered_data.append(
-                    word.cbegin() + static_cast<Bytes::difference_type>(start),
-                    word.cbegin() + static_cast<Bytes::difference_type>(end));
+            for (const auto& pattern_position : compressed_word.pattern_positions) {
+                pattern_uses[pattern_position.second]++;
             }
 
             intermediate_stream.write_word(compressed_word);
-            intermediate_stream.write_uncovered_data(word_uncovered_data);
-        } else {
-            intermediate_stream.write_word(compressed_word);
-            intermediate_stream.write_uncovered_data(word);
-        }
+            intermediate_stream.write_uncovered_data(uncovered_data);
 
-        positions_map.update_with_word(compressed_word.raw_length, compressed_word.pattern_positions);
+            positions_map.update_with_word(compressed_word.raw_length, compressed_word.pattern_positions);
+        }
     }
     intermediate_stream.flush();
 
@@ -339,8 +454,10 @@ void CompressorImpl::compress() {
 
 Compressor::Compressor(
     const std::filesystem::path& path,
-    const std::filesystem::path& tmp_dir_path)
-    : p_impl_(std::make_unique<CompressorImpl>(path, tmp_dir_path)) {}
+    const std::filesystem::path& tmp_dir_path,
+    size_t num_workers,
+    std::optional<size_t> superstring_size_limit)
+    : p_impl_(std::make_unique<CompressorImpl>(path, tmp_dir_path, num_workers, superstring_size_limit)) {}
 Compressor::~Compressor() { static_assert(true); }
 
 Compressor::Compressor(Compressor&& other) noexcept
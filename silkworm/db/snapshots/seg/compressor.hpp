@@ -19,6 +19,8 @@
 #include <filesystem>
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <thread>
 
 #include <silkworm/core/common/bytes.hpp>
 
@@ -28,9 +30,14 @@ class CompressorImpl;
 
 class Compressor {
   public:
+    //! \param num_workers number of threads extracting patterns and covering words, sequential if less than 2
+    //! \param superstring_size_limit size of the chunks of input words used for pattern extraction (16 MiB by default)
+    //! \remarks The compressed output is the same for any number of workers
     Compressor(
         const std::filesystem::path& path,
-        const std::filesystem::path& tmp_dir_path);
+        const std::filesystem::path& tmp_dir_path,
+        size_t num_workers = std::thread::hardware_concurrency(),
+        std::optional<size_t> superstring_size_limit = std::nullopt);
     ~Compressor();
 
     Compressor(Compressor&& other) noexcept;
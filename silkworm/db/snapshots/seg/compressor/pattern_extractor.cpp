@@ -40,13 +40,13 @@ static const size_t kPatternLenMax = 128;
 //! Minimum score of a pattern in a word.
 static const uint64_t kPatternScoreMin = 1024;
 
-Superstring::Superstring() {
-    superstring_.reserve(kSuperstringLimit);
+Superstring::Superstring(std::optional<size_t> size_limit) : size_limit_(size_limit.value_or(kSuperstringLimit)) {
+    superstring_.reserve(size_limit_);
 }
 
 bool Superstring::can_add_word(ByteView word) {
     size_t extra_size = word.size() * 2 + 2;
-    return superstring_.size() + extra_size <= kSuperstringLimit;
+    return superstring_.size() + extra_size <= size_limit_;
 }
 
 void Superstring::add_word(ByteView word, bool skip_copy) {
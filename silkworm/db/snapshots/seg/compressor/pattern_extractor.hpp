@@ -31,8 +31,9 @@ namespace silkworm::snapshots::seg {
  */
 class Superstring {
   public:
-    Superstring();
-    explicit Superstring(Bytes superstring) : superstring_(std::move(superstring)) {}
+    //! \param size_limit max size in bytes reached before the superstring is processed (16 MiB by default)
+    explicit Superstring(std::optional<size_t> size_limit = std::nullopt);
+    explicit Superstring(Bytes superstring) : superstring_(std::move(superstring)), size_limit_(superstring_.size()) {}
 
     bool can_add_word(ByteView word);
     void add_word(ByteView word, bool skip_copy = false);
@@ -50,6 +51,7 @@ class Superstring {
 
   private:
     Bytes superstring_;
+    size_t size_limit_;
 };
 
 class PatternExtractor {
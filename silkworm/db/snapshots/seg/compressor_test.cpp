@@ -0,0 +1,97 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "compressor.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/infra/common/directories.hpp>
+
+#include "decompressor.hpp"
+
+namespace silkworm::snapshots::seg {
+
+static std::vector<Bytes> generate_words(size_t count) {
+    std::vector<Bytes> words;
+    words.reserve(count);
+    for (size_t i{0}; i < count; ++i) {
+        // repetitive words give the pattern extractor something to find
+        const std::string word = "longlongword " + std::to_string(i % 1000) + (i % 7 ? " suffix" : "");
+        words.emplace_back(string_view_to_byte_view(word));
+    }
+    return words;
+}
+
+static Bytes compress_words(const std::vector<Bytes>& words, const std::filesystem::path& path, size_t num_workers,
+                            std::optional<size_t> superstring_size_limit = std::nullopt) {
+    TemporaryDirectory tmp_dir;
+    Compressor compressor{path, tmp_dir.path(), num_workers, superstring_size_limit};
+    for (const auto& word : words) {
+        compressor.add_word(word);
+    }
+    Compressor::compress(std::move(compressor));
+
+    std::ifstream file{path, std::ios::binary};
+    return Bytes{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+TEST_CASE("Compressor: same output for any number of workers", "[silkworm][node][seg][compressor]") {
+    TemporaryDirectory tmp_dir;
+    const auto words = generate_words(100'000);
+
+    const Bytes sequential_output = compress_words(words, tmp_dir.path() / "sequential.seg", 1);
+    const Bytes parallel_output = compress_words(words, tmp_dir.path() / "parallel.seg", 4);
+    CHECK(sequential_output == parallel_output);
+
+    Decompressor decompressor{tmp_dir.path() / "parallel.seg"};
+    decompressor.open();
+    CHECK(decompressor.words_count() == words.size());
+    auto it = decompressor.begin();
+    for (size_t i{0}; i < words.size(); ++i, ++it) {
+        REQUIRE(it != decompressor.end());
+        CHECK(*it == words[i]);
+    }
+}
+
+TEST_CASE("Compressor: same output for any number of workers with many superstrings", "[silkworm][node][seg][compressor]") {
+    TemporaryDirectory tmp_dir;
+    const auto words = generate_words(100'000);
+
+    // Small superstrings (~1'500 words each) get many of them extracted concurrently by the workers
+    constexpr size_t kSuperstringSizeLimit{64 * 1024};
+    const Bytes sequential_output = compress_words(words, tmp_dir.path() / "sequential.seg", 1, kSuperstringSizeLimit);
+    const Bytes parallel_output = compress_words(words, tmp_dir.path() / "parallel.seg", 4, kSuperstringSizeLimit);
+    CHECK(sequential_output == parallel_output);
+
+    Decompressor decompressor{tmp_dir.path() / "parallel.seg"};
+    decompressor.open();
+    CHECK(decompressor.words_count() == words.size());
+    auto it = decompressor.begin();
+    for (size_t i{0}; i < words.size(); ++i, ++it) {
+        REQUIRE(it != decompressor.end());
+        CHECK(*it == words[i]);
+    }
+}
+
+}  // namespace silkworm::snapshots::seg
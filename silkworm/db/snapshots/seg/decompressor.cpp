@@ -16,8 +16,11 @@
 
 #include "decompressor.hpp"
 
+#include <algorithm>
 #include <bitset>
 #include <limits>
+#include <map>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -301,6 +304,108 @@ std::ostream& operator<<(std::ostream& out, const PositionTable& pt) {
     return out;
 }
 
+//! Resolve the position code at the start of window using at most available bits
+static std::optional<std::pair<uint64_t, std::size_t>> resolve_position(
+    const PositionTable* table, uint32_t window, std::size_t available) {
+    if (table->bit_length() == 0) {
+        return std::make_pair(table->position(0), std::size_t{0});
+    }
+    std::size_t consumed{0};
+    while (table != nullptr) {
+        // Short codes are replicated over all the unknown upper bits, so only their own length must be available
+        const auto code = static_cast<uint16_t>((window >> consumed) & ((1u << table->bit_length()) - 1));
+        const uint8_t length = table->length(code);
+        consumed += length == 0 ? DecodingTable::kMaxTableBitLength : length;
+        if (consumed > available) {
+            return std::nullopt;
+        }
+        if (length != 0) {
+            return std::make_pair(table->position(code), consumed);
+        }
+        table = table->child(code);
+    }
+    return std::nullopt;
+}
+
+//! Resolve the pattern code at the start of window using at most available bits
+static std::optional<std::pair<ByteView, std::size_t>> resolve_pattern(
+    const PatternTable* table, uint32_t window, std::size_t available) {
+    if (table->bit_length() == 0) {
+        const auto* codeword{table->codeword(0)};
+        if (codeword == nullptr) {
+            return std::nullopt;
+        }
+        return std::make_pair(codeword->pattern(), std::size_t{0});
+    }
+    std::size_t consumed{0};
+    while (table != nullptr) {
+        const auto code = static_cast<uint16_t>((window >> consumed) & ((1u << table->bit_length()) - 1));
+        const auto* codeword{table->search_condensed(code)};
+        if (codeword == nullptr) {
+            return std::nullopt;
+        }
+        const uint8_t length = codeword->code_length();
+        consumed += length == 0 ? DecodingTable::kMaxTableBitLength : length;
+        if (consumed > available) {
+            return std::nullopt;
+        }
+        if (length != 0) {
+            return std::make_pair(codeword->pattern(), consumed);
+        }
+        table = codeword->table();
+    }
+    return std::nullopt;
+}
+
+std::unique_ptr<PairTable> PairTable::make(const PositionTable& positions, const PatternTable& patterns) {
+    // No pair of codes is longer than the sum of the max depths, so no need to go any wider
+    const std::size_t max_bit_length = std::min(positions.max_depth() + patterns.max_depth(), kMaxBitLength);
+    for (std::size_t bit_length{std::min(kMinBitLength, max_bit_length)};; ++bit_length) {
+        auto table = std::make_unique<PairTable>(positions, patterns, bit_length);
+        if (bit_length == max_bit_length || table->coverage() >= kTargetCoverage) {
+            SILK_TRACE << "PairTable bit length: " << bit_length << " coverage: " << table->coverage();
+            return table;
+        }
+    }
+}
+
+PairTable::PairTable(const PositionTable& positions, const PatternTable& patterns, std::size_t bit_length)
+    : bit_length_(bit_length), entries_(std::size_t{1} << bit_length) {
+    std::map<std::pair<const uint8_t*, std::size_t>, uint32_t> pattern_indexes;
+    for (uint32_t window{0}; window < entries_.size(); ++window) {
+        const auto position = resolve_position(&positions, window, bit_length);
+        if (!position) {
+            continue;
+        }
+        Entry& entry = entries_[window];
+        entry.position = static_cast<uint32_t>(position->first);
+        entry.position_bits = static_cast<uint8_t>(position->second);
+        entry.has_position = true;
+        if (entry.position == 0) {
+            continue;  // zero position terminates the word, no pattern follows
+        }
+        const auto pattern = resolve_pattern(&patterns, window >> entry.position_bits, bit_length - entry.position_bits);
+        if (!pattern) {
+            continue;
+        }
+        const auto [it, inserted] = pattern_indexes.emplace(
+            std::make_pair(pattern->first.data(), pattern->first.size()), static_cast<uint32_t>(patterns_.size()));
+        if (inserted) {
+            patterns_.push_back(pattern->first);
+        }
+        entry.pattern_index = it->second;
+        entry.pair_bits = static_cast<uint8_t>(entry.position_bits + pattern->second);
+        entry.has_pair = true;
+    }
+}
+
+double PairTable::coverage() const {
+    const auto resolved = std::count_if(entries_.cbegin(), entries_.cend(), [](const Entry& entry) {
+        return entry.has_pair || (entry.has_position && entry.position == 0);
+    });
+    return static_cast<double>(resolved) / static_cast<double>(entries_.size());
+}
+
 class Decompressor::ReadModeGuard {
   public:
     ReadModeGuard(
@@ -371,6 +476,9 @@ void Decompressor::open() {
     const std::size_t positions_dict_offset{patterns_dict_offset + pattern_dict_length + kDictionaryLengthSize};
     read_positions(ByteView{address + positions_dict_offset, position_dict_length});
 
+    // Tune the pair table for this file: most words are decoded one (position, pattern) pair per lookup
+    pair_dict_ = PairTable::make(*position_dict_, *pattern_dict_);
+
     // Store the start offset and length of the data words
     words_start_ = address + positions_dict_offset + position_dict_length;
     words_length_ = compressed_file_size - (positions_dict_offset + position_dict_length);
@@ -550,55 +658,41 @@ ByteView Decompressor::Iterator::data() const {
         return prefix_size == word_length;
     }
 
-    // First pass: we only check the patterns. Only run this loop as far as prefix goes, no need to go any further
-    std::size_t buffer_position{0};
-    for (auto pos{next_position(false)}; pos != 0; pos = next_position(false)) {
-        // Positions where to insert patterns are encoded relative to one another
-        buffer_position += pos - 1;
-        const ByteView pattern = next_pattern();
-        SILK_TRACE << "Iterator::has_prefix data-from-patterns pos=" << pos << " pattern=" << to_hex(pattern);
-        const auto comparison_size{std::min(prefix_size - buffer_position, pattern.size())};
+    read_placements();
+    if (bit_position_ > 0) {
+        ++word_offset_;
+        bit_position_ = 0;
+    }
+
+    // First pass: we only check the patterns. Only check as far as prefix goes, no need to go any further
+    for (const auto& [buffer_position, pattern] : placements_) {
         if (buffer_position < prefix_size) {
+            const auto comparison_size{std::min(prefix_size - buffer_position, pattern.size())};
             if (prefix.substr(buffer_position, comparison_size) != pattern.substr(0, comparison_size)) {
                 return false;
             }
         }
     }
-    if (bit_position_ > 0) {
-        ++word_offset_;
-        bit_position_ = 0;
-    }
-    uint64_t post_loop_offset = word_offset_;
-    word_offset_ = start_offset;
-    bit_position_ = 0;
-
-    // Reset the iterator state
-    (void)next_position(true);
 
     // Second pass: we check spaces not covered by the patterns
+    uint64_t post_loop_offset = word_offset_;
     std::size_t last_uncovered{0};
-    buffer_position = 0;
-    for (auto pos{next_position(false)}; pos != 0 && last_uncovered < prefix_size; pos = next_position(false)) {
-        // Positions where to insert patterns are encoded relative to one another
-        buffer_position += pos - 1;
+    for (const auto& [buffer_position, pattern] : placements_) {
+        if (last_uncovered >= prefix_size) {
+            break;
+        }
         if (buffer_position > last_uncovered) {
             const std::size_t position_diff = buffer_position - last_uncovered;
-            SILK_TRACE << "Iterator::has_prefix other-data pos=" << pos << " last_uncovered=" << last_uncovered
-                       << " buffer_position=" << buffer_position << " position_diff=" << position_diff
-                       << " data=" << to_hex(ByteView{data().data() + post_loop_offset, position_diff});
             const auto comparison_size{std::min(prefix_size - last_uncovered, position_diff)};
             if (prefix.substr(last_uncovered, comparison_size) != data().substr(post_loop_offset, comparison_size)) {
                 return false;
             }
             post_loop_offset += position_diff;
         }
-        last_uncovered = buffer_position + next_pattern().size();
+        last_uncovered = buffer_position + pattern.size();
     }
     if (prefix_size > last_uncovered && word_length > last_uncovered) {
         const std::size_t position_diff = word_length - last_uncovered;
-        SILK_TRACE << "Iterator::has_prefix other-data last_uncovered=" << last_uncovered
-                   << " buffer_position=" << buffer_position << " position_diff=" << position_diff
-                   << " data=" << to_hex(ByteView{data().data() + post_loop_offset, position_diff});
         const auto comparison_size{prefix_size < word_length ? prefix_size - last_uncovered : position_diff};
         if (prefix.substr(last_uncovered, comparison_size) != data().substr(post_loop_offset, comparison_size)) {
             return false;
@@ -626,61 +720,40 @@ uint64_t Decompressor::Iterator::next(Bytes& buffer) {
         return word_offset_;
     }
 
-    // Track position into buffer where to insert part of the word
-    std::size_t buffer_offset = buffer.size();
-    buffer.resize(buffer_offset + word_length);
-    SILK_TRACE << "Iterator::next buffer resized to: " << buffer.size();
-
-    // Fill in the patterns
-    std::size_t buffer_position = buffer_offset;
-    for (auto pos{next_position(false)}; pos != 0; pos = next_position(false)) {
-        // Positions where to insert patterns are encoded relative to one another
-        buffer_position += pos - 1;
-        const ByteView pattern = next_pattern();
-        SILK_TRACE << "Iterator::next data-from-patterns pos=" << pos << " pattern=" << to_hex(pattern);
-        if (buffer_position > buffer.size()) {
-            return word_offset_;
-        }
-        pattern.copy(buffer.data() + buffer_position, std::min(pattern.size(), buffer.size() - buffer_position));
-    }
+    // Decode all the patterns once, the uncovered data follows the codes at the next byte boundary
+    read_placements();
     if (bit_position_ > 0) {
         ++word_offset_;
+        bit_position_ = 0;
     }
     uint64_t post_loop_offset = word_offset_;
-    word_offset_ = start_offset;
-    bit_position_ = 0;
 
-    // Reset the iterator state
-    (void)next_position(true);
+    // Track position into buffer where to insert part of the word
+    const std::size_t buffer_offset = buffer.size();
+    buffer.resize(buffer_offset + word_length);
+    SILK_TRACE << "Iterator::next buffer resized to: " << buffer.size();
 
-    // Restore the beginning of buffer
-    buffer_position = buffer_offset;
+    // Fill in the patterns and, in between, the runs of data which is not the patterns
     std::size_t last_uncovered = buffer_offset;
-
-    // Fill in data which is not the patterns
-    for (auto pos{next_position(false)}; pos != 0; pos = next_position(false)) {
-        // Positions where to insert patterns are encoded relative to one another
-        buffer_position += pos - 1;
+    for (const auto& [pattern_position, pattern] : placements_) {
+        const std::size_t buffer_position = buffer_offset + pattern_position;
+        if (buffer_position > buffer.size()) {
+            return word_offset_;
+        }
         if (buffer_position > last_uncovered) {
-            std::size_t position_diff = buffer_position - last_uncovered;
-            SILK_TRACE << "Iterator::next other-data pos=" << pos << " last_uncovered=" << last_uncovered
-                       << " buffer_position=" << buffer_position << " position_diff=" << position_diff
-                       << " data=" << to_hex(ByteView{data().data() + post_loop_offset, position_diff});
-            data().copy(buffer.data() + last_uncovered, std::min(position_diff, buffer.size() - last_uncovered), post_loop_offset);
+            const std::size_t position_diff = buffer_position - last_uncovered;
+            data().copy(buffer.data() + last_uncovered, position_diff, post_loop_offset);
             post_loop_offset += position_diff;
         }
-        last_uncovered = buffer_position + next_pattern().size();
+        pattern.copy(buffer.data() + buffer_position, std::min(pattern.size(), buffer.size() - buffer_position));
+        last_uncovered = buffer_position + pattern.size();
     }
     if (buffer_offset + word_length > last_uncovered) {
-        std::size_t position_diff = buffer_offset + word_length - last_uncovered;
-        SILK_TRACE << "Iterator::next other-data last_uncovered=" << last_uncovered
-                   << " buffer_position=" << buffer_position << " position_diff=" << position_diff
-                   << " data=" << to_hex(ByteView{data().data() + post_loop_offset, position_diff});
-        data().copy(buffer.data() + last_uncovered, std::min(position_diff, buffer.size() - last_uncovered), post_loop_offset);
+        const std::size_t position_diff = buffer_offset + word_length - last_uncovered;
+        data().copy(buffer.data() + last_uncovered, position_diff, post_loop_offset);
         post_loop_offset += position_diff;
     }
     word_offset_ = post_loop_offset;
-    bit_position_ = 0;
     SILK_TRACE << "Iterator::next word_offset_=" << word_offset_;
     return post_loop_offset;
 }
@@ -724,25 +797,23 @@ uint64_t Decompressor::Iterator::skip() {
         return word_offset_;
     }
 
+    read_placements();
+    if (bit_position_ > 0) {
+        ++word_offset_;
+        bit_position_ = 0;
+    }
+
     std::size_t uncovered_count{0};
-    std::size_t buffer_position{0};
     std::size_t last_uncovered{0};
-    for (auto pos{next_position(false)}; pos != 0; pos = next_position(false)) {
-        // Positions where to insert are encoded relative to one another
-        buffer_position += pos - 1;
+    for (const auto& [buffer_position, pattern] : placements_) {
         if (word_length < buffer_position) {
             throw std::logic_error{"likely index file is invalid: " + decoder_->compressed_filename()};
         }
         if (buffer_position > last_uncovered) {
             uncovered_count += buffer_position - last_uncovered;
         }
-        last_uncovered = buffer_position + next_pattern().size();
+        last_uncovered = buffer_position + pattern.size();
     }
-    if (bit_position_ > 0) {
-        ++word_offset_;
-        bit_position_ = 0;
-    }
-
     if (word_length > last_uncovered) {
         uncovered_count += word_length - last_uncovered;
     }
@@ -819,6 +890,13 @@ uint64_t Decompressor::Iterator::next_position(bool clean) {
         bit_position_ = 0;
     }
     SILK_TRACE << "Iterator::next_position word_offset_=" << word_offset_ << " bit_position_=" << int{bit_position_};
+    if (const PairTable* pair_table = decoder_->pair_dict_.get()) {
+        const auto& entry = pair_table->entry(peek_bits(pair_table->bit_length()));
+        if (entry.has_position) {
+            skip_bits(entry.position_bits);
+            return entry.position;
+        }
+    }
     const PositionTable* table = decoder_->position_dict_.get();
     if (table->bit_length() == 0) {
         SILK_TRACE << "Iterator::next_position table->position(0)=" << table->position(0);
@@ -852,6 +930,49 @@ uint16_t Decompressor::Iterator::next_code(std::size_t bit_length) {
     return code;
 }
 
+uint32_t Decompressor::Iterator::peek_bits(std::size_t bit_length) const {
+    uint32_t bits{0};
+    if (word_offset_ + sizeof(uint32_t) <= data_size()) {
+        bits = endian::load_little_u32(decoder_->words_start_ + word_offset_);
+    } else {
+        for (std::size_t i{0}; word_offset_ + i < data_size(); ++i) {
+            bits |= static_cast<uint32_t>(decoder_->words_start_[word_offset_ + i]) << (i * CHAR_BIT);
+        }
+    }
+    return (bits >> bit_position_) & ((uint32_t{1} << bit_length) - 1);
+}
+
+void Decompressor::Iterator::skip_bits(std::size_t bit_count) {
+    const std::size_t bit_position = bit_position_ + bit_count;
+    word_offset_ += bit_position / CHAR_BIT;
+    bit_position_ = static_cast<uint8_t>(bit_position % CHAR_BIT);
+}
+
+void Decompressor::Iterator::read_placements() {
+    placements_.clear();
+    const PairTable* pair_table = decoder_->pair_dict_.get();
+    std::size_t buffer_position{0};
+    while (true) {
+        uint64_t pos{0};
+        ByteView pattern;
+        const PairTable::Entry* entry = pair_table ? &pair_table->entry(peek_bits(pair_table->bit_length())) : nullptr;
+        if (entry && entry->has_pair) {
+            skip_bits(entry->pair_bits);
+            pos = entry->position;
+            pattern = pair_table->pattern(entry->pattern_index);
+        } else {
+            pos = next_position(false);
+            if (pos == 0) {
+                break;
+            }
+            pattern = next_pattern();
+        }
+        // Positions where to insert patterns are encoded relative to one another
+        buffer_position += pos - 1;
+        placements_.push_back({buffer_position, pattern});
+    }
+}
+
 Decompressor::Iterator& Decompressor::Iterator::operator++() {
     if (has_next()) {
         current_word_offset_ = word_offset_;
@@ -878,4 +999,16 @@ Decompressor::Iterator Decompressor::Iterator::make_end(const Decompressor* deco
     return it;
 }
 
+Decompressor::Iterator Decompressor::Iterator::make_decoded(
+    const Decompressor* decoder,
+    uint64_t data_offset,
+    uint64_t next_data_offset,
+    Bytes word) {
+    Iterator it{decoder, {}};
+    it.current_word_offset_ = data_offset;
+    it.word_offset_ = next_data_offset;
+    it.current_word_ = std::move(word);
+    return it;
+}
+
 }  // namespace silkworm::snapshots::seg
@@ -37,6 +37,7 @@ class DecodingTable {
     constexpr static std::size_t kMaxTableBitLength{9};
 
     [[nodiscard]] std::size_t bit_length() const { return bit_length_; }
+    [[nodiscard]] std::size_t max_depth() const { return max_depth_; }
 
   protected:
     explicit DecodingTable(std::size_t max_depth);
@@ -167,6 +168,50 @@ class PositionTable : public DecodingTable {
     friend std::ostream& operator<<(std::ostream& out, const PositionTable& pt);
 };
 
+//! Flat decoding table resolving the codes of a position and of the following pattern with one lookup
+//! @details Entries are indexed by the next bit_length() bits of the data stream and packed in one contiguous array,
+//! so the whole table stays cache-resident. Pairs whose codes do not fit the lookup window, as well as the rare codes
+//! spanning nested tables, fall back to PositionTable and PatternTable
+class PairTable {
+  public:
+    //! The bit length range for the lookup window
+    constexpr static std::size_t kMinBitLength{8};
+    constexpr static std::size_t kMaxBitLength{12};
+
+    //! The fraction of pairs resolved by one lookup after which a wider (i.e. larger) table is not worth it
+    constexpr static double kTargetCoverage{0.9};
+
+    struct Entry {
+        uint32_t position{0};
+        uint32_t pattern_index{0};
+        //! Number of bits in the position code
+        uint8_t position_bits{0};
+        //! Number of bits in the position code plus the pattern code
+        uint8_t pair_bits{0};
+        bool has_position{false};
+        bool has_pair{false};
+    };
+
+    //! Build the table with the smallest lookup window reaching kTargetCoverage for the given dictionaries
+    static std::unique_ptr<PairTable> make(const PositionTable& positions, const PatternTable& patterns);
+
+    PairTable(const PositionTable& positions, const PatternTable& patterns, std::size_t bit_length);
+
+    [[nodiscard]] std::size_t bit_length() const { return bit_length_; }
+
+    [[nodiscard]] const Entry& entry(uint32_t window) const { return entries_[window]; }
+
+    [[nodiscard]] ByteView pattern(uint32_t index) const { return patterns_[index]; }
+
+    //! The fraction of lookup windows resolving either a pair or the terminating position of a word
+    [[nodiscard]] double coverage() const;
+
+  private:
+    std::size_t bit_length_;
+    std::vector<Entry> entries_;
+    std::vector<ByteView> patterns_;
+};
+
 //! Snapshot decoder using modified Condensed Huffman Table (CHT) algorithm
 class Decompressor {
   public:
@@ -221,6 +266,9 @@ class Decompressor {
         //! The current word position
         uint64_t current_word_offset() const { return current_word_offset_; }
 
+        //! The position of the word following the current one
+        uint64_t next_word_offset() const { return word_offset_; }
+
         //! input_iterator concept boilerplate
 
         using iterator_category = std::input_iterator_tag;
@@ -240,6 +288,9 @@ class Decompressor {
 
         static Iterator make_end(const Decompressor* decoder);
 
+        //! Make an iterator on a word already decoded (e.g. cached) at data_offset and followed by next_data_offset
+        static Iterator make_decoded(const Decompressor* decoder, uint64_t data_offset, uint64_t next_data_offset, Bytes word);
+
       private:
         //! View on the whole data stream.
         [[nodiscard]] inline ByteView data() const;
@@ -253,6 +304,21 @@ class Decompressor {
         //! Read next code from the data stream
         [[nodiscard]] inline uint16_t next_code(std::size_t bit_length);
 
+        //! Peek the next bits from the data stream (without moving offset), bits past the end read as zero
+        [[nodiscard]] inline uint32_t peek_bits(std::size_t bit_length) const;
+
+        //! Move offset forward by the specified number of bits
+        inline void skip_bits(std::size_t bit_count);
+
+        //! Pattern to be placed at some offset within the word
+        struct PatternPlacement {
+            std::size_t offset{0};
+            ByteView pattern;
+        };
+
+        //! Read the pattern placements of the current word up to the terminating position
+        void read_placements();
+
         //! The decoder on which iterator works
         const Decompressor* decoder_;
 
@@ -268,6 +334,9 @@ class Decompressor {
         //! Last extracted word
         Bytes current_word_;
 
+        //! Pattern placements of the last decoded word, reused across words
+        std::vector<PatternPlacement> placements_;
+
         std::shared_ptr<ReadModeGuard> read_mode_guard_;
     };
 
@@ -337,6 +406,9 @@ class Decompressor {
     //! The table of positions used to decode the data words
     std::unique_ptr<PositionTable> position_dict_;
 
+    //! The table of (position, pattern) pairs used to decode the data words, tuned on open
+    std::unique_ptr<PairTable> pair_dict_;
+
     //! The start offset of the data words
     uint8_t* words_start_{nullptr};
 
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
 
+#include <silkworm/core/common/base.hpp>
 #include <silkworm/db/snapshots/bittorrent/settings.hpp>
 #include <silkworm/infra/common/directories.hpp>
 
@@ -28,6 +30,11 @@ struct SnapshotSettings {
     bool enabled{true};                                                        // Flag indicating if snapshots are enabled
     bool no_downloader{false};                                                 // Flag indicating if snapshots download is disabled
     bittorrent::BitTorrentSettings bittorrent_settings;                        // The Bittorrent protocol settings
+    std::size_t index_build_memory_budget{4_Gibi};                             // Memory shared by concurrent index builds
+    std::size_t word_cache_size{0};                                            // Memory for words decoded by random reads (0: disabled)
+    std::size_t index_huge_page_max_size{0};                                   // Max size of hot indexes copied in huge pages (0: disabled)
+    bool verify_content{false};                                                // Flag indicating if snapshot verification decodes all the content
+    bool lazy_verification{false};                                             // Flag indicating if old bundles are verified in background
 };
 
 }  // namespace silkworm::snapshots
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "index.hpp"
 #include "snapshot_reader.hpp"
 
@@ -24,6 +26,8 @@ namespace silkworm::snapshots {
 struct SnapshotAndIndex {
     const Snapshot& snapshot;
     const Index& index;
+    //! Optional owner keeping snapshot and index alive, e.g. if they can be replaced concurrently
+    std::shared_ptr<const void> owner{};
 };
 
 }  // namespace silkworm::snapshots
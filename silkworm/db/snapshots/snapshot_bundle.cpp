@@ -16,11 +16,20 @@
 
 #include "snapshot_bundle.hpp"
 
+#include <string>
+
 #include <silkworm/infra/common/ensure.hpp>
 
 namespace silkworm::snapshots {
 
 void SnapshotBundle::reopen() {
+    // Drop the optional receipts when missing, the bundle is still usable without them
+    if (receipt_snapshot && !receipt_snapshot->path().exists()) {
+        receipt_snapshot.reset();
+    }
+    if (idx_receipt_number && (!receipt_snapshot || !idx_receipt_number->path().exists())) {
+        idx_receipt_number.reset();
+    }
     for (auto& snapshot_ref : snapshots()) {
         snapshot_ref.get().reopen_segment();
         ensure(!snapshot_ref.get().empty(), [&]() {
@@ -32,6 +41,31 @@ void SnapshotBundle::reopen() {
     }
 }
 
+void SnapshotBundle::verify(bool verify_content) const {
+    for (const SnapshotType type : snapshot_types()) {
+        const Snapshot& snapshot = this->snapshot(type);
+        ensure((snapshot.block_from() == block_from()) && (snapshot.block_to() == block_to()), [&]() {
+            return "snapshot " + snapshot.path().filename() + " has block range different from its bundle";
+        });
+    }
+
+    for (const SnapshotType type : index_types()) {
+        const Snapshot& snapshot = this->snapshot(type);
+        const Index& index = this->index(type);
+        ensure(index.is_open(), [&]() { return "index " + index.path().filename() + " is not open"; });
+        ensure(index.key_count() == snapshot.item_count(), [&]() {
+            return "index " + index.path().filename() + " has " + std::to_string(index.key_count()) +
+                   " keys, segment " + snapshot.path().filename() + " has " + std::to_string(snapshot.item_count()) + " words";
+        });
+    }
+
+    if (verify_content) {
+        for (const SnapshotType type : snapshot_types()) {
+            snapshot(type).verify_content();
+        }
+    }
+}
+
 void SnapshotBundle::close() {
     for (auto& index_ref : indexes()) {
         index_ref.get().close_index();
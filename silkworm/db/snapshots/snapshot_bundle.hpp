@@ -16,9 +16,10 @@
 
 #pragma once
 
-#include <array>
 #include <cassert>
 #include <functional>
+#include <optional>
+#include <vector>
 
 #include <silkworm/core/common/base.hpp>
 
@@ -43,41 +44,57 @@ struct SnapshotBundle {
     //! Index transaction_hash -> block_num
     Index idx_txn_hash_2_block;
 
+    //! Receipts are optional: snapshot sets produced elsewhere (e.g. downloaded) may not include them
+    std::optional<Snapshot> receipt_snapshot{};
+    //! Index block_num -> receipts_segment_offset
+    std::optional<Index> idx_receipt_number{};
+
+    //! Number of mandatory snapshots and indexes in each bundle
     static constexpr size_t kSnapshotsCount = 3;
     static constexpr size_t kIndexesCount = 4;
 
-    std::array<std::reference_wrapper<Snapshot>, kSnapshotsCount> snapshots() {
-        return {
+    bool has_receipts() const { return receipt_snapshot.has_value() && idx_receipt_number.has_value(); }
+
+    std::vector<std::reference_wrapper<Snapshot>> snapshots() {
+        std::vector<std::reference_wrapper<Snapshot>> result{
             header_snapshot,
             body_snapshot,
             txn_snapshot,
         };
+        if (receipt_snapshot) result.emplace_back(*receipt_snapshot);
+        return result;
     }
 
-    std::array<std::reference_wrapper<Index>, kIndexesCount> indexes() {
-        return {
+    std::vector<std::reference_wrapper<Index>> indexes() {
+        std::vector<std::reference_wrapper<Index>> result{
             idx_header_hash,
             idx_body_number,
             idx_txn_hash,
             idx_txn_hash_2_block,
         };
+        if (idx_receipt_number) result.emplace_back(*idx_receipt_number);
+        return result;
     }
 
-    std::array<SnapshotType, kSnapshotsCount> snapshot_types() {
-        return {
+    std::vector<SnapshotType> snapshot_types() const {
+        std::vector<SnapshotType> result{
             SnapshotType::headers,
             SnapshotType::bodies,
             SnapshotType::transactions,
         };
+        if (receipt_snapshot) result.push_back(SnapshotType::receipts);
+        return result;
     }
 
-    std::array<SnapshotType, kIndexesCount> index_types() {
-        return {
+    std::vector<SnapshotType> index_types() const {
+        std::vector<SnapshotType> result{
             SnapshotType::headers,
             SnapshotType::bodies,
             SnapshotType::transactions,
             SnapshotType::transactions_to_block,
         };
+        if (idx_receipt_number) result.push_back(SnapshotType::receipts);
+        return result;
     }
 
     const Snapshot& snapshot(SnapshotType type) const {
@@ -89,6 +106,9 @@ struct SnapshotBundle {
             case transactions:
             case transactions_to_block:
                 return txn_snapshot;
+            case receipts:
+                assert(receipt_snapshot);
+                return *receipt_snapshot;
         }
         assert(false);
         return header_snapshot;
@@ -104,6 +124,9 @@ struct SnapshotBundle {
                 return idx_txn_hash;
             case transactions_to_block:
                 return idx_txn_hash_2_block;
+            case receipts:
+                assert(idx_receipt_number);
+                return *idx_receipt_number;
         }
         assert(false);
         return idx_header_hash;
@@ -120,6 +143,10 @@ struct SnapshotBundle {
 
     void reopen();
     void close();
+
+    //! Check that the open snapshots and indexes are consistent with each other, throws if not
+    //! \param verify_content if true also decode the whole content of the snapshots
+    void verify(bool verify_content) const;
 };
 
 }  // namespace silkworm::snapshots
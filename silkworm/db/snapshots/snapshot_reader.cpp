@@ -44,6 +44,18 @@ void Snapshot::reopen_segment() {
 
     // Open decompressor that opens the mapped file in turns
     decoder_.open();
+
+    // Words cached for the previous file content must not be found anymore
+    if (word_cache_) {
+        word_cache_segment_id_ = word_cache_->register_segment();
+    }
+}
+
+void Snapshot::set_word_cache(std::shared_ptr<WordCache> word_cache) {
+    word_cache_ = std::move(word_cache);
+    if (word_cache_) {
+        word_cache_segment_id_ = word_cache_->register_segment();
+    }
 }
 
 Snapshot::Iterator& Snapshot::Iterator::operator++() {
@@ -94,15 +106,26 @@ seg::Decompressor::Iterator Snapshot::seek_decoder(uint64_t offset, std::optiona
 }
 
 Snapshot::Iterator Snapshot::seek(uint64_t offset, std::optional<Hash> hash_prefix, std::shared_ptr<SnapshotWordDeserializer> deserializer) const {
-    auto it = seek_decoder(offset, hash_prefix);
+    std::optional<WordCache::Word> cached_word;
+    if (word_cache_) {
+        cached_word = word_cache_->get(word_cache_segment_id_, offset);
+    }
+    auto it = cached_word ? seg::Decompressor::Iterator::make_decoded(&decoder_, offset, cached_word->next_offset, std::move(cached_word->data))
+                          : seek_decoder(offset, hash_prefix);
     if (it == decoder_.end()) {
         return end();
     }
+    if (cached_word && hash_prefix && !it->starts_with(ByteView{hash_prefix->bytes, 1})) {
+        return end();
+    }
     try {
         deserializer->decode_word(*it);
     } catch (...) {
         return end();
     }
+    if (word_cache_ && !cached_word) {
+        word_cache_->put(word_cache_segment_id_, offset, {*it, it.next_word_offset()});
+    }
     deserializer->check_sanity_with_metadata(path_.block_from(), path_.block_to());
     return Snapshot::Iterator{std::move(it), std::move(deserializer), path()};
 }
@@ -112,4 +135,14 @@ void Snapshot::close() {
     decoder_.close();
 }
 
+void Snapshot::verify_content() const {
+    uint64_t count{0};
+    for (auto it = decoder_.begin(); it != decoder_.end(); ++it) {
+        ++count;
+    }
+    ensure(count == item_count(), [&]() {
+        return "Snapshot: " + path_.filename() + " has " + std::to_string(count) + " words, expected " + std::to_string(item_count());
+    });
+}
+
 }  // namespace silkworm::snapshots
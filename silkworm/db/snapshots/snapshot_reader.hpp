@@ -35,6 +35,7 @@
 #include <silkworm/infra/common/os.hpp>
 
 #include "snapshot_word_serializer.hpp"
+#include "word_cache.hpp"
 
 namespace silkworm::snapshots {
 
@@ -101,6 +102,12 @@ class Snapshot {
     void reopen_segment();
     void close();
 
+    //! Decode all the words in the segment and check they are as many as declared, throws if not
+    void verify_content() const;
+
+    //! Use the given cache for the words decoded by seek, nullptr to stop caching
+    void set_word_cache(std::shared_ptr<WordCache> word_cache);
+
     Iterator begin(std::shared_ptr<SnapshotWordDeserializer> deserializer) const;
     Iterator end() const;
 
@@ -113,6 +120,10 @@ class Snapshot {
     SnapshotPath path_;
 
     seg::Decompressor decoder_;
+
+    //! The optional cache of words decoded by seek and the id of this segment in it
+    std::shared_ptr<WordCache> word_cache_;
+    uint64_t word_cache_segment_id_{0};
 };
 
 template <SnapshotWordDeserializerConcept TWordDeserializer>
@@ -28,6 +28,7 @@ enum SnapshotType : uint8_t {
     bodies = 1,
     transactions = 2,
     transactions_to_block = 3,
+    receipts = 4,
 };
 
 }  // namespace silkworm::snapshots
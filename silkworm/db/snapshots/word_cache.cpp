@@ -0,0 +1,104 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "word_cache.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace silkworm::snapshots {
+
+static std::size_t entry_memory_usage(const WordCache::Word& word) {
+    return word.data.size() + WordCache::kEntryOverhead;
+}
+
+std::size_t WordCache::KeyHash::operator()(const Key& key) const noexcept {
+    // Mix segment id and offset so that the same offset in different segments goes to different shards
+    uint64_t h = key.offset ^ (key.segment_id * 0x9E3779B97F4A7C15ull);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+WordCache::WordCache(std::size_t max_memory_usage, std::size_t shard_count)
+    : shard_max_memory_usage_{max_memory_usage / std::max(shard_count, std::size_t{1})} {
+    shards_.resize(std::max(shard_count, std::size_t{1}));
+    for (auto& shard : shards_) {
+        shard = std::make_unique<Shard>();
+    }
+}
+
+std::optional<WordCache::Word> WordCache::get(uint64_t segment_id, uint64_t offset) {
+    const Key key{segment_id, offset};
+    Shard& s = shard(key);
+    std::scoped_lock lock{s.mutex};
+    const auto it = s.entries.find(key);
+    if (it == s.entries.end()) {
+        ++s.misses;
+        return std::nullopt;
+    }
+    ++s.hits;
+    s.lru_list.splice(s.lru_list.begin(), s.lru_list, it->second);
+    return it->second->second;
+}
+
+void WordCache::put(uint64_t segment_id, uint64_t offset, Word word) {
+    const std::size_t word_memory_usage = entry_memory_usage(word);
+    if (word_memory_usage > shard_max_memory_usage_) {
+        return;
+    }
+    const Key key{segment_id, offset};
+    Shard& s = shard(key);
+    std::scoped_lock lock{s.mutex};
+    if (const auto it = s.entries.find(key); it != s.entries.end()) {
+        s.memory_usage -= entry_memory_usage(it->second->second);
+        s.lru_list.erase(it->second);
+        s.entries.erase(it);
+    }
+    while (s.memory_usage + word_memory_usage > shard_max_memory_usage_) {
+        const auto& [lru_key, lru_word] = s.lru_list.back();
+        s.memory_usage -= entry_memory_usage(lru_word);
+        s.entries.erase(lru_key);
+        s.lru_list.pop_back();
+    }
+    s.lru_list.emplace_front(key, std::move(word));
+    s.entries.emplace(key, s.lru_list.begin());
+    s.memory_usage += word_memory_usage;
+}
+
+WordCache::Stats WordCache::stats() const {
+    Stats stats;
+    for (const auto& s : shards_) {
+        std::scoped_lock lock{s->mutex};
+        stats.hits += s->hits;
+        stats.misses += s->misses;
+        stats.entries += s->entries.size();
+        stats.memory_usage += s->memory_usage;
+    }
+    return stats;
+}
+
+void WordCache::clear() {
+    for (auto& s : shards_) {
+        std::scoped_lock lock{s->mutex};
+        s->lru_list.clear();
+        s->entries.clear();
+        s->memory_usage = 0;
+    }
+}
+
+}  // namespace silkworm::snapshots
@@ -0,0 +1,111 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+
+namespace silkworm::snapshots {
+
+//! \brief Cache of decoded snapshot words for random-access reads, keyed by (segment, offset)
+//! \details The cache is split into shards, each one with its own lock and LRU eviction within an even share of the
+//! memory limit, so that concurrent readers rarely contend. Segment ids are never reused: the entries of a closed
+//! or reopened segment are not looked up anymore and just age out
+class WordCache {
+  public:
+    static constexpr std::size_t kDefaultShardCount{16};
+
+    //! Estimated memory used by the bookkeeping of one entry in addition to the word data
+    static constexpr std::size_t kEntryOverhead{96};
+
+    struct Word {
+        Bytes data;
+        //! The offset of the following word in the segment
+        uint64_t next_offset{0};
+    };
+
+    struct Stats {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        std::size_t entries{0};
+        std::size_t memory_usage{0};
+
+        [[nodiscard]] double hit_ratio() const {
+            const auto lookups = hits + misses;
+            return lookups > 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+
+    explicit WordCache(std::size_t max_memory_usage, std::size_t shard_count = kDefaultShardCount);
+
+    // Not copyable nor movable
+    WordCache(const WordCache&) = delete;
+    WordCache& operator=(const WordCache&) = delete;
+
+    //! Get a new id for a segment being opened
+    uint64_t register_segment() { return next_segment_id_++; }
+
+    [[nodiscard]] std::optional<Word> get(uint64_t segment_id, uint64_t offset);
+
+    //! Insert the word unless too big for the cache, evicting the least recently used ones if needed
+    void put(uint64_t segment_id, uint64_t offset, Word word);
+
+    [[nodiscard]] Stats stats() const;
+
+    void clear();
+
+  private:
+    struct Key {
+        uint64_t segment_id{0};
+        uint64_t offset{0};
+
+        friend bool operator==(const Key&, const Key&) = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Shard {
+        using Entry = std::pair<Key, Word>;
+
+        std::list<Entry> lru_list;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries;
+        std::size_t memory_usage{0};
+        uint64_t hits{0};
+        uint64_t misses{0};
+        mutable std::mutex mutex;
+    };
+
+    Shard& shard(const Key& key) { return *shards_[KeyHash{}(key) % shards_.size()]; }
+
+    std::size_t shard_max_memory_usage_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic_uint64_t next_segment_id_{0};
+};
+
+}  // namespace silkworm::snapshots
@@ -0,0 +1,79 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "word_cache.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm::snapshots {
+
+static WordCache::Word make_word(std::size_t size, uint64_t next_offset) {
+    return WordCache::Word{Bytes(size, 0xAB), next_offset};
+}
+
+TEST_CASE("WordCache: get and put", "[silkworm][node][snapshot]") {
+    WordCache cache{1_Mebi};
+    const auto segment1 = cache.register_segment();
+    const auto segment2 = cache.register_segment();
+    CHECK(segment1 != segment2);
+
+    CHECK_FALSE(cache.get(segment1, 0));
+    cache.put(segment1, 0, make_word(10, 12));
+
+    const auto word = cache.get(segment1, 0);
+    REQUIRE(word);
+    CHECK(word->data == Bytes(10, 0xAB));
+    CHECK(word->next_offset == 12);
+    CHECK_FALSE(cache.get(segment2, 0));
+
+    const auto stats = cache.stats();
+    CHECK(stats.hits == 1);
+    CHECK(stats.misses == 2);
+    CHECK(stats.entries == 1);
+    CHECK(stats.memory_usage == 10 + WordCache::kEntryOverhead);
+    CHECK(stats.hit_ratio() == 1.0 / 3);
+
+    cache.clear();
+    CHECK(cache.stats().entries == 0);
+    CHECK(cache.stats().memory_usage == 0);
+}
+
+TEST_CASE("WordCache: evict least recently used", "[silkworm][node][snapshot]") {
+    constexpr std::size_t kWordSize{100};
+    constexpr std::size_t kEntrySize{kWordSize + WordCache::kEntryOverhead};
+    WordCache cache{3 * kEntrySize, /*shard_count=*/1};
+    const auto segment = cache.register_segment();
+
+    cache.put(segment, 0, make_word(kWordSize, 1));
+    cache.put(segment, 1, make_word(kWordSize, 2));
+    cache.put(segment, 2, make_word(kWordSize, 3));
+    CHECK(cache.get(segment, 0));  // now offset 1 is the least recently used
+    cache.put(segment, 3, make_word(kWordSize, 4));
+
+    CHECK(cache.get(segment, 0));
+    CHECK_FALSE(cache.get(segment, 1));
+    CHECK(cache.get(segment, 2));
+    CHECK(cache.get(segment, 3));
+    CHECK(cache.stats().memory_usage == 3 * kEntrySize);
+
+    SECTION("words too big are not cached") {
+        cache.put(segment, 4, make_word(3 * kEntrySize, 5));
+        CHECK_FALSE(cache.get(segment, 4));
+        CHECK(cache.stats().entries == 3);
+    }
+}
+
+}  // namespace silkworm::snapshots
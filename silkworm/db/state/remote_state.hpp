@@ -29,6 +29,7 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/state/state.hpp>
 #include <silkworm/db/chain/chain_storage.hpp>
+#include <silkworm/db/kv/api/historical_state_cache.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
 #include <silkworm/db/state/state_reader.hpp>
 
@@ -36,8 +37,12 @@ namespace silkworm::db::state {
 
 class AsyncRemoteState {
   public:
-    explicit AsyncRemoteState(kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number)
-        : storage_(storage), block_number_(block_number), state_reader_{tx} {}
+    explicit AsyncRemoteState(kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number,
+                              kv::api::HistoricalStateCache* historical_cache = nullptr,
+                              uint64_t historical_cache_generation = 0)
+        : storage_(storage),
+          block_number_(block_number),
+          state_reader_{tx, historical_cache, historical_cache_generation} {}
 
     Task<std::optional<Account>> read_account(const evmc::address& address) const noexcept;
 
@@ -69,8 +74,9 @@ class AsyncRemoteState {
 
 class RemoteState : public State {
   public:
-    explicit RemoteState(boost::asio::any_io_executor& executor, kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number)
-        : executor_(executor), async_state_{tx, storage, block_number} {}
+    explicit RemoteState(boost::asio::any_io_executor& executor, kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number,
+                         kv::api::HistoricalStateCache* historical_cache = nullptr, uint64_t historical_cache_generation = 0)
+        : executor_(executor), async_state_{tx, storage, block_number, historical_cache, historical_cache_generation} {}
 
     std::optional<Account> read_account(const evmc::address& address) const noexcept override;
 
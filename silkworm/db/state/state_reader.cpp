@@ -27,6 +27,21 @@
 
 namespace silkworm::db::state {
 
+//! Return the first block number of the interval ending at the change found for block_number within the bitmap,
+//! i.e. the block following the previous change if present in the bitmap otherwise block_number itself
+static BlockNum change_interval_start(const roaring::Roaring64Map& bitmap, BlockNum block_number) {
+    if (block_number == 0) {
+        return 0;
+    }
+    const uint64_t previous_changes{bitmap.rank(block_number - 1)};
+    if (previous_changes == 0) {
+        return block_number;  // the previous change, if any, is in another bitmap chunk
+    }
+    uint64_t previous_change_block{0};
+    bitmap.select(previous_changes - 1, &previous_change_block);
+    return previous_change_block + 1;
+}
+
 Task<std::optional<Account>> StateReader::read_account(const evmc::address& address, BlockNum block_number) const {
     std::optional<Bytes> encoded{co_await read_historical_account(address, block_number)};
     if (!encoded) {
@@ -81,6 +96,12 @@ Task<std::optional<Bytes>> StateReader::read_code(const evmc::bytes32& code_hash
 }
 
 Task<std::optional<Bytes>> StateReader::read_historical_account(const evmc::address& address, BlockNum block_number) const {
+    if (historical_cache_) {
+        if (auto cached_value{historical_cache_->get(address.bytes, block_number)}) {
+            co_return cached_value;
+        }
+    }
+
     const auto account_history_key{db::account_history_key(address, block_number)};
     SILK_DEBUG << "StateReader::read_historical_account account_history_key: " << account_history_key;
     const auto kv_pair{co_await tx_.get(table::kAccountHistoryName, account_history_key)};
@@ -110,11 +131,25 @@ Task<std::optional<Bytes>> StateReader::read_historical_account(const evmc::addr
     const auto value{co_await tx_.get_both_range(table::kAccountChangeSetName, block_key, address_subkey)};
     SILK_DEBUG << "StateReader::read_historical_account value: " << (value ? *value : Bytes{});
 
+    if (historical_cache_ && value) {
+        const kv::api::BlockInterval interval{change_interval_start(bitmap, block_number), *change_block};
+        historical_cache_->insert(address.bytes, interval, *value, historical_cache_generation_);
+    }
+
     co_return value;
 }
 
 Task<std::optional<Bytes>> StateReader::read_historical_storage(const evmc::address& address, uint64_t incarnation,
                                                                 const evmc::bytes32& location_hash, BlockNum block_number) const {
+    Bytes cache_key;
+    if (historical_cache_) {
+        cache_key = db::storage_prefix(address, incarnation);
+        cache_key.append(location_hash.bytes, kHashLength);
+        if (auto cached_value{historical_cache_->get(cache_key, block_number)}) {
+            co_return cached_value;
+        }
+    }
+
     const auto storage_history_key{db::storage_history_key(address, location_hash, block_number)};
     SILK_DEBUG << "StateReader::read_historical_storage storage_history_key: " << storage_history_key;
     const auto kv_pair{co_await tx_.get(table::kStorageHistoryName, storage_history_key)};
@@ -141,6 +176,11 @@ Task<std::optional<Bytes>> StateReader::read_historical_storage(const evmc::addr
     const auto value{co_await tx_.get_both_range(table::kStorageChangeSetName, storage_change_key, location_subkey)};
     SILK_DEBUG << "StateReader::read_historical_storage value: " << (value ? *value : Bytes{});
 
+    if (historical_cache_ && value) {
+        const kv::api::BlockInterval interval{change_interval_start(bitmap, block_number), *change_block};
+        historical_cache_->insert(cache_key, interval, *value, historical_cache_generation_);
+    }
+
     co_return value;
 }
 }  // namespace silkworm::db::state
@@ -24,13 +24,18 @@
 
 #include <silkworm/core/common/bytes.hpp>
 #include <silkworm/core/types/account.hpp>
+#include <silkworm/db/kv/api/historical_state_cache.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
 
 namespace silkworm::db::state {
 
 class StateReader {
   public:
-    explicit StateReader(kv::api::Transaction& tx) : tx_(tx) {}
+    //! \param historical_cache_generation the generation of the historical cache when tx started: values resolved by
+    //! tx are cached only if no unwind happened since then, otherwise they could come from unwound change sets
+    explicit StateReader(kv::api::Transaction& tx, kv::api::HistoricalStateCache* historical_cache = nullptr,
+                         uint64_t historical_cache_generation = 0)
+        : tx_(tx), historical_cache_(historical_cache), historical_cache_generation_(historical_cache_generation) {}
 
     StateReader(const StateReader&) = delete;
     StateReader& operator=(const StateReader&) = delete;
@@ -55,6 +60,8 @@ class StateReader {
 
   private:
     kv::api::Transaction& tx_;
+    kv::api::HistoricalStateCache* historical_cache_;
+    uint64_t historical_cache_generation_;
 };
 
 }  // namespace silkworm::db::state
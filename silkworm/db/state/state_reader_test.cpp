@@ -208,6 +208,79 @@ TEST_CASE_METHOD(StateReaderTest, "StateReader::read_storage") {
     }
 }
 
+TEST_CASE_METHOD(StateReaderTest, "StateReader::read_account with historical cache") {
+    kv::api::HistoricalStateCache historical_cache;
+    StateReader state_reader{transaction_, &historical_cache};
+
+    // Set the call expectations: history resolution must happen just once
+    // 1. DatabaseReader::get call on kAccountHistory returns the account bitmap
+    EXPECT_CALL(transaction_, get(db::table::kAccountHistoryName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> {
+        co_return KeyValue{Bytes{ByteView{kZeroAddress.bytes}}, kEncodedAccountHistory};
+    }));
+    // 2. DatabaseReader::get_both_range call on kPlainAccountChangeSet returns the account data
+    EXPECT_CALL(transaction_, get_both_range(db::table::kAccountChangeSetName, _, _)).WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<Bytes>> {
+        co_return kEncodedAccount;
+    }));
+
+    // Execute the test: calling read_account twice at the same block should return the same account
+    for (int i{0}; i < 2; ++i) {
+        std::optional<Account> account;
+        CHECK_NOTHROW(account = spawn_and_wait(state_reader.read_account(kZeroAddress, kEarliestBlockNumber)));
+        CHECK(account);
+        if (account) {
+            CHECK(account->nonce == 2);
+            CHECK(account->balance == 1000);
+        }
+    }
+    CHECK(historical_cache.size() == 1);
+    CHECK(historical_cache.hit_count() == 1);
+    CHECK(historical_cache.miss_count() == 1);
+}
+
+TEST_CASE_METHOD(StateReaderTest, "StateReader::read_account with historical cache unwound meanwhile") {
+    kv::api::HistoricalStateCache historical_cache;
+    StateReader state_reader{transaction_, &historical_cache, historical_cache.generation()};
+
+    // Set the call expectations: an unwind happens while the history is resolved
+    EXPECT_CALL(transaction_, get(db::table::kAccountHistoryName, _)).WillOnce(InvokeWithoutArgs([&]() -> Task<KeyValue> {
+        historical_cache.unwind(kEarliestBlockNumber);
+        co_return KeyValue{Bytes{ByteView{kZeroAddress.bytes}}, kEncodedAccountHistory};
+    }));
+    EXPECT_CALL(transaction_, get_both_range(db::table::kAccountChangeSetName, _, _)).WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<Bytes>> {
+        co_return kEncodedAccount;
+    }));
+
+    // Execute the test: the account is returned but not cached, it could come from unwound change sets
+    std::optional<Account> account;
+    CHECK_NOTHROW(account = spawn_and_wait(state_reader.read_account(kZeroAddress, kEarliestBlockNumber)));
+    CHECK(account);
+    CHECK(historical_cache.size() == 0);
+}
+
+TEST_CASE_METHOD(StateReaderTest, "StateReader::read_account with historical cache unwound after tx start") {
+    kv::api::HistoricalStateCache historical_cache;
+    // The generation is captured when the transaction starts, then an unwind happens before the lookup
+    const uint64_t tx_generation{historical_cache.generation()};
+    historical_cache.unwind(kEarliestBlockNumber);
+    StateReader state_reader{transaction_, &historical_cache, tx_generation};
+
+    // Set the call expectations:
+    // 1. DatabaseReader::get call on kAccountHistory returns account history
+    EXPECT_CALL(transaction_, get(db::table::kAccountHistoryName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> {
+        co_return KeyValue{Bytes{ByteView{kZeroAddress.bytes}}, kEncodedAccountHistory};
+    }));
+    // 2. DatabaseReader::get_both_range call on kPlainAccountChangeSet returns account data
+    EXPECT_CALL(transaction_, get_both_range(db::table::kAccountChangeSetName, _, _)).WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<Bytes>> {
+        co_return kEncodedAccount;
+    }));
+
+    // Execute the test: the account is returned but not cached, tx data could predate the unwind
+    std::optional<Account> account;
+    CHECK_NOTHROW(account = spawn_and_wait(state_reader.read_account(kZeroAddress, kEarliestBlockNumber)));
+    CHECK(account);
+    CHECK(historical_cache.size() == 0);
+}
+
 TEST_CASE_METHOD(StateReaderTest, "StateReader::read_code") {
     SECTION("no code for empty code hash") {
         // Execute the test: calling read_code should return no code for empty hash
@@ -248,6 +248,18 @@ inline constexpr db::MapConfig kLogTopicIndex{kLogTopicIndexName};
 inline constexpr const char* kLogsName{"TransactionLog"};
 inline constexpr db::MapConfig kLogs{kLogsName};
 
+//! \details Holds a compact summary of the logs stored in TransactionLog for every block having logs
+//! \struct
+//! \verbatim
+//!   key   : block_num_u64 (BE)
+//!   value : one 16 bytes entry for each log in block order, made of
+//!           transaction_index_u32 (BE) + log_index_u32 (BE) + address fragment (4 bytes) + first topic fragment (4 bytes)
+//! \endverbatim
+//! \remark Fragments are the leading 4 bytes of address and first topic, the latter being zero when log has no topics
+//! \see silkworm/db/log_summary.hpp
+inline constexpr const char* kLogSummaryName{"LogSummary"};
+inline constexpr db::MapConfig kLogSummary{kLogSummaryName};
+
 inline constexpr const char* kMigrationsName{"Migration"};
 inline constexpr db::MapConfig kMigrations{kMigrationsName};
 
@@ -384,6 +396,7 @@ inline constexpr db::MapConfig kChainDataTables[]{
     kIncarnationMap,
     kLastForkchoice,
     kLogAddressIndex,
+    kLogSummary,
     kLogTopicIndex,
     kLogs,
     kMigrations,
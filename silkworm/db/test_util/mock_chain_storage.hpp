@@ -72,6 +72,8 @@ class MockChainStorage : public chain::ChainStorage {
     MOCK_METHOD((Task<std::optional<intx::uint256>>), read_total_difficulty, (const Hash& block_hash, BlockNum block_number), (const override));
 
     MOCK_METHOD((Task<std::optional<BlockNum>>), read_block_number_by_transaction_hash, (const evmc::bytes32& transaction_hash), (const override));
+
+    MOCK_METHOD((Task<std::optional<snapshots::BlockReceiptsForStorage>>), read_frozen_receipts, (BlockNum), (const override));
 };
 
 }  // namespace silkworm::db::test_util
@@ -38,7 +38,7 @@
 namespace silkworm {
 
 MemoryMappedFile::MemoryMappedFile(std::filesystem::path path, std::optional<MemoryMappedRegion> region, bool read_only)
-    : path_(std::move(path)), managed_{!region.has_value()} {
+    : path_(std::move(path)), managed_{!region.has_value()}, read_only_{read_only} {
     ensure(std::filesystem::exists(path_), [&]() { return "MemoryMappedFile: " + path_.string() + " does not exist"; });
     ensure(std::filesystem::is_regular_file(path_), [&]() { return "MemoryMappedFile: " + path_.string() + " is not regular file"; });
 
@@ -63,6 +63,33 @@ MemoryMappedFile::~MemoryMappedFile() {
 #endif
 }
 
+void MemoryMappedFile::apply_access_policy(MemoryAccessPolicy policy) {
+    switch (policy) {
+        case MemoryAccessPolicy::kNormal:
+            advise_normal();
+            break;
+        case MemoryAccessPolicy::kRandom:
+            advise_random();
+            break;
+        case MemoryAccessPolicy::kSequential:
+            advise_sequential();
+            break;
+        case MemoryAccessPolicy::kWillNeed:
+            advise_willneed();
+            break;
+        case MemoryAccessPolicy::kHugePageCopy:
+            if (access_policy_ == MemoryAccessPolicy::kHugePageCopy) {
+                return;
+            }
+            if (!copy_to_huge_pages()) {
+                advise_random();
+                policy = MemoryAccessPolicy::kRandom;
+            }
+            break;
+    }
+    access_policy_ = policy;
+}
+
 #ifdef _WIN32
 void MemoryMappedFile::map_existing(bool read_only) {
     DWORD desired_access = read_only ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE);
@@ -99,6 +126,13 @@ void MemoryMappedFile::advise_random() const {
 void MemoryMappedFile::advise_sequential() const {
 }
 
+void MemoryMappedFile::advise_willneed() const {
+}
+
+bool MemoryMappedFile::copy_to_huge_pages() {
+    return false;
+}
+
 void* MemoryMappedFile::mmap(FileDescriptor fd, size_t size, bool read_only) {
     DWORD protection = static_cast<DWORD>(read_only ? PAGE_READONLY : PAGE_READWRITE);
 
@@ -159,6 +193,39 @@ void MemoryMappedFile::advise_sequential() const {
     advise(MADV_SEQUENTIAL);
 }
 
+void MemoryMappedFile::advise_willneed() const {
+    advise(MADV_WILLNEED);
+}
+
+bool MemoryMappedFile::copy_to_huge_pages() {
+#ifdef MADV_HUGEPAGE
+    if (!managed_ || !read_only_ || region_.empty()) {
+        return false;
+    }
+
+    void* address = ::mmap(nullptr, region_.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error{"mmap anonymous failed for: " + path_.string() + " error: " + safe_strerror(errno)};
+    }
+    const MemoryMappedRegion copy{static_cast<uint8_t*>(address), region_.size()};
+    // Transparent huge pages may be disabled in kernel: the copy still avoids page faults on file-backed pages
+    ::madvise(copy.data(), copy.size(), MADV_HUGEPAGE);
+    std::memcpy(copy.data(), region_.data(), region_.size());
+    if (::mprotect(copy.data(), copy.size(), PROT_READ) == -1) {
+        const int error = errno;
+        ::munmap(copy.data(), copy.size());
+        throw std::runtime_error{"mprotect failed for: " + path_.string() + " error: " + safe_strerror(error)};
+    }
+
+    // The file-backed mapping is no longer needed
+    unmap();
+    region_ = copy;
+    return true;
+#else
+    return false;
+#endif  // MADV_HUGEPAGE
+}
+
 void* MemoryMappedFile::mmap(FileDescriptor fd, size_t size, bool read_only) {
     int flags = MAP_SHARED;
 
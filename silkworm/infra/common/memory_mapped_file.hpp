@@ -72,6 +72,15 @@ using FileDescriptor = int;
 
 using MemoryMappedRegion = std::span<uint8_t>;
 
+//! Paging policy of a memory-mapped file, to be chosen according to how the file is going to be accessed
+enum class MemoryAccessPolicy : uint8_t {
+    kNormal,        // default kernel read-ahead
+    kRandom,        // no read-ahead, e.g. for hash index lookups
+    kSequential,    // aggressive read-ahead, e.g. for full scans
+    kWillNeed,      // load the whole file in page cache in advance
+    kHugePageCopy,  // private read-only copy in anonymous memory backed by transparent huge pages, for small hot files
+};
+
 class MemoryMappedFile {
   public:
     explicit MemoryMappedFile(std::filesystem::path path, std::optional<MemoryMappedRegion> region = {}, bool read_only = true);
@@ -104,9 +113,20 @@ class MemoryMappedFile {
     void advise_normal() const;
     void advise_random() const;
     void advise_sequential() const;
+    void advise_willneed() const;
+
+    //! Apply the specified access policy to the whole mapped area
+    //! \warning kHugePageCopy relocates the mapped area, so any pointer into the previous region() gets invalid
+    //! \details kHugePageCopy falls back to kRandom for external or writable regions and where not supported
+    void apply_access_policy(MemoryAccessPolicy policy);
+
+    [[nodiscard]] MemoryAccessPolicy access_policy() const {
+        return access_policy_;
+    }
 
   private:
     void map_existing(bool read_only);
+    bool copy_to_huge_pages();
 
     void* mmap(FileDescriptor fd, size_t size, bool read_only);
     void unmap();
@@ -120,6 +140,12 @@ class MemoryMappedFile {
     //! Flag indicating if memory-mapping is managed internally or not
     bool managed_;
 
+    //! Flag indicating if memory-mapping is read-only or not
+    bool read_only_;
+
+    //! The last access policy applied
+    MemoryAccessPolicy access_policy_{MemoryAccessPolicy::kNormal};
+
 #ifdef _WIN32
     void cleanup();
 
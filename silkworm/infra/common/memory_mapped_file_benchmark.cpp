@@ -17,6 +17,7 @@
 #include <filesystem>
 #include <fstream>
 #include <utility>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -27,6 +28,7 @@
 #include "memory_mapped_file.hpp"
 
 constexpr uint64_t k4MiBFileSize{4u * silkworm::kMebi};
+constexpr uint64_t k64MiBFileSize{64u * silkworm::kMebi};
 
 static inline std::filesystem::path create_random_temporary_file(int64_t file_size) {
     auto tmp_file = silkworm::TemporaryDirectory::get_unique_temporary_path();
@@ -77,3 +79,34 @@ static void benchmark_checksum_memory_mapped_file(benchmark::State& state) {
 }
 
 BENCHMARK(benchmark_checksum_memory_mapped_file)->Arg(k4MiBFileSize);
+
+static void benchmark_random_access_memory_mapped_file(benchmark::State& state) {
+    constexpr std::size_t kLookupCount{64 * 1024};
+    const auto tmp_file_path = create_random_temporary_file(state.range(0));
+    const auto policy = static_cast<silkworm::MemoryAccessPolicy>(state.range(1));
+
+    silkworm::RandomNumber rnd{0, static_cast<uint64_t>(state.range(0) - 1)};
+    std::vector<std::size_t> offsets(kLookupCount);
+    for (auto& offset : offsets) {
+        offset = static_cast<std::size_t>(rnd.generate_one());
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        silkworm::MemoryMappedFile mapped_file{tmp_file_path};
+        mapped_file.apply_access_policy(policy);
+        const auto region = mapped_file.region();
+        int checksum{0};
+        for (const auto offset : offsets) {
+            checksum += region[offset];
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+}
+
+BENCHMARK(benchmark_random_access_memory_mapped_file)
+    ->ArgNames({"file_size", "policy"})
+    ->ArgsProduct({{k4MiBFileSize, k64MiBFileSize},
+                   {static_cast<int64_t>(silkworm::MemoryAccessPolicy::kNormal),
+                    static_cast<int64_t>(silkworm::MemoryAccessPolicy::kRandom),
+                    static_cast<int64_t>(silkworm::MemoryAccessPolicy::kWillNeed),
+                    static_cast<int64_t>(silkworm::MemoryAccessPolicy::kHugePageCopy)}});
@@ -78,6 +78,35 @@ TEST_CASE("MemoryMappedFile from file", "[silkworm][infra][common][memory_mapped
         CHECK_NOTHROW(mmf.advise_random());
     }
 
+    SECTION("advise_willneed") {
+        CHECK_NOTHROW(mmf.advise_willneed());
+    }
+
+    SECTION("apply_access_policy") {
+        for (const auto policy : {MemoryAccessPolicy::kNormal, MemoryAccessPolicy::kRandom,
+                                  MemoryAccessPolicy::kSequential, MemoryAccessPolicy::kWillNeed}) {
+            CHECK_NOTHROW(mmf.apply_access_policy(policy));
+            CHECK(mmf.access_policy() == policy);
+        }
+    }
+
+    SECTION("apply_access_policy with huge page copy keeps content") {
+        CHECK_NOTHROW(mmf.apply_access_policy(MemoryAccessPolicy::kHugePageCopy));
+        CHECK((mmf.access_policy() == MemoryAccessPolicy::kHugePageCopy ||
+               mmf.access_policy() == MemoryAccessPolicy::kRandom));
+        CHECK(mmf.size() == kFileContent.size());
+        const auto data{mmf.region().data()};
+        CHECK(data[0] == '\x01');
+        CHECK(data[1] == '\x02');
+        CHECK(data[2] == '\x03');
+    }
+
+    SECTION("apply_access_policy with huge page copy falls back for writable file") {
+        MemoryMappedFile writable_mmf{tmp_file, {}, false};
+        writable_mmf.apply_access_policy(MemoryAccessPolicy::kHugePageCopy);
+        CHECK(writable_mmf.access_policy() == MemoryAccessPolicy::kRandom);
+    }
+
     SECTION("input stream") {
         MemoryMappedInputStream mmis{mmf.region()};
         std::string s;
@@ -146,6 +175,12 @@ TEST_CASE("MemoryMappedFile from memory", "[silkworm][infra][common][memory_mapp
         CHECK_NOTHROW(mmf.advise_random());
     }
 
+    SECTION("apply_access_policy with huge page copy falls back for external region") {
+        mmf.apply_access_policy(MemoryAccessPolicy::kHugePageCopy);
+        CHECK(mmf.access_policy() == MemoryAccessPolicy::kRandom);
+        CHECK(mmf.region().data() == region.data());
+    }
+
     SECTION("input stream") {
         MemoryMappedInputStream mmis{mmf.region()};
         std::string s;
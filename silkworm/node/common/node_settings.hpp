@@ -46,6 +46,7 @@ struct NodeSettings {
     std::optional<ChainConfig> chain_config;               // Chain config
     size_t batch_size{512_Mebi};                           // Batch size to use in stages
     size_t etl_buffer_size{256_Mebi};                      // Buffer size for ETL operations
+    bool etl_compress_files{false};                        // Whether to compress ETL temporary files
     std::vector<std::string> remote_sentry_addresses;      // Remote Sentry API addresses (host:port,host2:port2,...)
     bool fake_pow{false};                                  // Whether to verify Proof-of-Work (PoW)
     std::optional<evmc::address> etherbase{std::nullopt};  // Coinbase address (PoW only)
@@ -54,9 +55,12 @@ struct NodeSettings {
     uint32_t sync_loop_log_interval_seconds{30};           // Interval for sync loop to emit logs
     bool parallel_fork_tracking_enabled{false};            // Whether to track multiple parallel forks at head
     bool keep_db_txn_open{true};                           // Whether to keep db transaction open between requests
+    bool parallel_execution_enabled{false};                // Whether to execute block transactions in parallel
+    size_t state_prefetch_blocks{0};                       // Number of upcoming blocks whose state is prefetched
+    bool arena_state_buffer_enabled{false};                // Whether to buffer execution state in arena storage
 
     inline db::etl::CollectorSettings etl() const {
-        return {data_directory->etl().path(), etl_buffer_size};
+        return {data_directory->etl().path(), etl_buffer_size, etl_compress_files};
     }
 };
 
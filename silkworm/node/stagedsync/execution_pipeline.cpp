@@ -121,7 +121,7 @@ void ExecutionPipeline::load_stages() {
     stages_.emplace(db::stages::kSendersKey,
                     std::make_unique<stagedsync::Senders>(sync_context_.get(), *node_settings_->chain_config, node_settings_->batch_size, node_settings_->etl(), node_settings_->prune_mode.senders()));
     stages_.emplace(db::stages::kExecutionKey,
-                    std::make_unique<stagedsync::Execution>(sync_context_.get(), *node_settings_->chain_config, node_settings_->batch_size, node_settings_->prune_mode));
+                    std::make_unique<stagedsync::Execution>(sync_context_.get(), *node_settings_->chain_config, node_settings_->batch_size, node_settings_->prune_mode, node_settings_->parallel_execution_enabled, node_settings_->state_prefetch_blocks, node_settings_->arena_state_buffer_enabled ? db::Buffer::StateStorage::kArena : db::Buffer::StateStorage::kHashMaps));
     stages_.emplace(db::stages::kHashStateKey,
                     std::make_unique<stagedsync::HashState>(sync_context_.get(), node_settings_->etl()));
     stages_.emplace(db::stages::kIntermediateHashesKey,
@@ -149,7 +149,8 @@ std::vector<std::string> BlockHashes::get_log_progress() {
             case 2:
                 return {"from", "etl",
                         "to", db::table::kHeaderNumbers.name,
-                        "key", collector_ ? collector_->get_load_key() : ""};
+                        "key", collector_ ? collector_->get_load_key() : "",
+                        "rate", collector_ ? collector_->get_load_throughput() : ""};
             default:
                 break;
         }
@@ -457,14 +457,17 @@ std::vector<std::string> CallTraceIndex::get_log_progress() {
         switch (operation_) {
             case OperationType::Forward:
                 if (loading_) {
+                    std::string rate;
                     if (current_target_ == db::table::kCallFromIndex.name) {
                         current_key_ = abridge(call_from_collector_->get_load_key(), kAddressLength);
+                        rate = call_from_collector_->get_load_throughput();
                     } else if (current_target_ == db::table::kCallToIndex.name) {
                         current_key_ = abridge(call_to_collector_->get_load_key(), kAddressLength);
+                        rate = call_to_collector_->get_load_throughput();
                     } else {
                         current_key_.clear();
                     }
-                    ret.insert(ret.end(), {"from", "ETL", "to", current_target_, "key", current_key_});
+                    ret.insert(ret.end(), {"from", "ETL", "to", current_target_, "key", current_key_, "rate", rate});
                 } else {
                     ret.insert(ret.end(), {"from", current_source_, "to", "ETL", "key", current_key_});
                 }
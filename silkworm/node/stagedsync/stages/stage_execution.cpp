@@ -16,8 +16,9 @@
 
 #include "stage_execution.hpp"
 
-#include <span>
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 
 #include <magic_enum.hpp>
 
@@ -65,6 +66,11 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
         processed_blocks_ = 0;
         processed_transactions_ = 0;
         processed_gas_ = 0;
+        speculated_transactions_ = 0;
+        reexecuted_transactions_ = 0;
+        prefetched_keys_ = 0;
+        prefetch_hits_ = 0;
+        prefetch_misses_ = 0;
         lap_time_ = std::chrono::steady_clock::now();
         progress_lock.unlock();
 
@@ -90,12 +96,31 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
             prune_call_traces = std::min(prune_call_traces, hashstate_stage_progress - 1);
         }
 
+        if (parallel_execution_ && !parallel_executor_) {
+            parallel_executor_ = std::make_unique<ParallelExecutor>(*rule_set_, chain_config_,
+                                                                    std::max(1u, std::thread::hardware_concurrency()));
+        }
+
         static constexpr size_t kCacheSize{5'000};
         AnalysisCache analysis_cache{kCacheSize};
         ObjectPool<evmone::ExecutionState> state_pool;
 
         prefetched_blocks_.clear();
 
+        // Decode blocks in background if the reader can see them, i.e. if we are allowed to commit block data
+        if (!txn.commit_disabled()) {
+            txn.commit_and_renew();
+            BlockReader::LookaheadFunc on_lookahead;
+            if (state_prefetch_blocks_ > 0) {
+                state_prefetcher_ = std::make_unique<StatePrefetcher>(txn.db(), std::thread::hardware_concurrency());
+                on_lookahead = [prefetcher = state_prefetcher_.get()](const Block& block) {
+                    prefetcher->prefetch(block);
+                };
+            }
+            block_reader_ = std::make_unique<BlockReader>(txn.db(), block_num_, max_block_num, kMaxPrefetchedBlocks,
+                                                          state_prefetch_blocks_, std::move(on_lookahead));
+        }
+
         while (block_num_ <= max_block_num) {
             throw_if_stopping();
             const auto execution_result{execute_batch(txn, max_block_num, analysis_cache, state_pool,
@@ -138,56 +163,39 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
         ret = Stage::Result::kUnexpectedError;
     }
 
+    if (block_reader_) {
+        log::Debug(log_prefix_, {"block reader wait", StopWatch::format(block_reader_->wait_duration())});
+        block_reader_.reset();
+    }
+    state_prefetcher_.reset();
+
     operation_ = OperationType::None;
     return ret;
 }
 
 void Execution::prefetch_blocks(db::RWTxn& txn, const BlockNum from, const BlockNum to) {
+    assert(prefetched_blocks_.empty());
+
+    if (block_reader_) {
+        // Blocks are decoded in background: just take the next one out of the reader
+        prefetched_blocks_.push_back();
+        if (!block_reader_->pop(prefetched_blocks_.back())) {
+            throw std::runtime_error("Missing block " + std::to_string(from));
+        }
+        return;
+    }
+
     std::unique_ptr<StopWatch> sw;
     if (log::test_verbosity(log::Level::kTrace)) {
         sw = std::make_unique<StopWatch>(/*auto_start=*/true);
     }
 
-    assert(prefetched_blocks_.empty());
-
     const size_t count{std::min(static_cast<size_t>(to - from + 1), kMaxPrefetchedBlocks)};
-    size_t num_read{0};
-
-    db::DataModel data_model{txn};
-    auto canonicals = txn.ro_cursor(db::table::kCanonicalHashes);
-    Bytes starting_key{db::block_key(from)};
-    if (canonicals->seek(db::to_slice(starting_key))) {
-        BlockNum block_num{from};
-        auto walk_function{[&](ByteView key, ByteView value) {
-            BlockNum reached_block_num{endian::load_big_u64(key.data())};
-            if (reached_block_num != block_num) {
-                throw std::runtime_error("Bad canonical header sequence: expected " + std::to_string(block_num) +
-                                         " got " + std::to_string(reached_block_num));
-            } else if (value.length() != kHashLength) {
-                throw std::runtime_error("Invalid value for hash in " +
-                                         std::string(db::table::kCanonicalHashes.name) +
-                                         " expected=" + std::to_string(kHashLength) +
-                                         " got=" + std::to_string(value.length()));
-            }
-
-            const auto hash_ptr{value.data()};
-            prefetched_blocks_.push_back();
-            if (!data_model.read_block(std::span<const uint8_t, kHashLength>{hash_ptr, kHashLength}, block_num,
-                                       /*read_senders=*/true, prefetched_blocks_.back())) {
-                throw std::runtime_error("Unable to read block " + std::to_string(block_num));
-            }
-            ++block_num;
-        }};
-        num_read = db::cursor_for_count(*canonicals, walk_function, count);
-    }
-
-    if (num_read != count) {
-        throw std::runtime_error("Missing block " + std::to_string(from + num_read));
-    }
+    read_canonical_blocks(txn, from, count, [&](Block&& block) { prefetched_blocks_.push_back(std::move(block)); });
 
     if (sw) {
         auto [_, duration]{sw->lap()};
-        log::Trace("Fetched blocks", {"size", std::to_string(num_read), "in", StopWatch::format(duration)});
+        log::Trace("Fetched blocks", {"size", std::to_string(count), "in", StopWatch::format(duration)});
     }
 }
 
@@ -199,9 +207,10 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
     auto log_time{std::chrono::steady_clock::now()};
 
     try {
-        db::Buffer buffer{txn};
+        db::Buffer buffer{txn, state_storage_};
         buffer.set_prune_history_threshold(prune_history_threshold);
         buffer.set_memory_limit(batch_size_);
+        buffer.set_flush_workers(std::thread::hardware_concurrency());
 
         std::vector<Receipt> receipts;
 
@@ -233,7 +242,13 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
             CallTracer tracer{traces};
             processor.evm().add_tracer(tracer);
 
-            if (const ValidationResult res = processor.execute_block(receipts); res != ValidationResult::kOk) {
+            if (state_prefetcher_) {
+                state_prefetcher_->begin_block(block_num_);
+            }
+            const ValidationResult res{parallel_executor_
+                                           ? parallel_executor_->execute_block(processor, block, buffer, receipts, traces)
+                                           : processor.execute_block(receipts)};
+            if (res != ValidationResult::kOk) {
                 // Persist work done so far
                 if (block_num_ >= prune_receipts_threshold) {
                     buffer.insert_receipts(block_num_, receipts);
@@ -260,6 +275,10 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
                 break;
             }
 
+            if (state_prefetcher_) {
+                state_prefetcher_->end_block(block_num_, traces);
+            }
+
             if (block_num_ >= prune_receipts_threshold) {
                 buffer.insert_receipts(block_num_, receipts);
             }
@@ -274,6 +293,18 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
             ++processed_blocks_;
             processed_transactions_ += block.transactions.size();
             processed_gas_ += block.header.gas_used;
+            if (parallel_executor_) {
+                speculated_transactions_ += parallel_executor_->stats().applied_transactions;
+                reexecuted_transactions_ += parallel_executor_->stats().reexecuted_transactions;
+                parallel_executor_->reset_stats();
+            }
+            if (state_prefetcher_) {
+                const auto prefetch_stats{state_prefetcher_->stats()};
+                prefetched_keys_ += prefetch_stats.accounts + prefetch_stats.slots;
+                prefetch_hits_ += prefetch_stats.hits;
+                prefetch_misses_ += prefetch_stats.misses;
+                state_prefetcher_->reset_stats();
+            }
             progress_lock.unlock();
 
             prefetched_blocks_.pop_front();
@@ -553,10 +584,30 @@ std::vector<std::string> Execution::get_log_progress() {
     processed_blocks_ = 0;
     processed_transactions_ = 0;
     processed_gas_ = 0;
+    const size_t speculated_transactions{speculated_transactions_};
+    const size_t reexecuted_transactions{reexecuted_transactions_};
+    speculated_transactions_ = 0;
+    reexecuted_transactions_ = 0;
+    const size_t prefetched_keys{prefetched_keys_};
+    const size_t prefetch_hits{prefetch_hits_};
+    const size_t prefetch_misses{prefetch_misses_};
+    prefetched_keys_ = 0;
+    prefetch_hits_ = 0;
+    prefetch_misses_ = 0;
     progress_lock.unlock();
 
-    return {"block", std::to_string(block_num_), "blocks/s", std::to_string(speed_blocks),
-            "txns/s", std::to_string(speed_transactions), "Mgas/s", std::to_string(speed_mgas)};
+    std::vector<std::string> progress{"block", std::to_string(block_num_), "blocks/s", std::to_string(speed_blocks),
+                                      "txns/s", std::to_string(speed_transactions), "Mgas/s", std::to_string(speed_mgas)};
+    if (parallel_executor_) {
+        progress.insert(progress.end(), {"speculated", std::to_string(speculated_transactions),
+                                         "re-executed", std::to_string(reexecuted_transactions)});
+    }
+    if (state_prefetch_blocks_ > 0) {
+        progress.insert(progress.end(), {"prefetched", std::to_string(prefetched_keys),
+                                         "prefetch hits", std::to_string(prefetch_hits),
+                                         "prefetch misses", std::to_string(prefetch_misses)});
+    }
+    return progress;
 }
 
 void Execution::revert_state(ByteView key, ByteView value, db::RWCursorDupSort& plain_state_table,
@@ -21,8 +21,12 @@
 #include <silkworm/core/chain/config.hpp>
 #include <silkworm/core/execution/evm.hpp>
 #include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/db/buffer.hpp>
 #include <silkworm/db/prune_mode.hpp>
 #include <silkworm/db/stage.hpp>
+#include <silkworm/node/stagedsync/stages/stage_execution/block_reader.hpp>
+#include <silkworm/node/stagedsync/stages/stage_execution/parallel_executor.hpp>
+#include <silkworm/node/stagedsync/stages/stage_execution/state_prefetcher.hpp>
 
 namespace silkworm::stagedsync {
 
@@ -32,11 +36,17 @@ class Execution final : public Stage {
         SyncContext* sync_context,
         const ChainConfig& chain_config,
         size_t batch_size,
-        db::PruneMode prune_mode)
+        db::PruneMode prune_mode,
+        bool parallel_execution = false,
+        size_t state_prefetch_blocks = 0,
+        db::Buffer::StateStorage state_storage = db::Buffer::StateStorage::kHashMaps)
         : Stage(sync_context, db::stages::kExecutionKey),
           chain_config_(chain_config),
           batch_size_(batch_size),
           prune_mode_(prune_mode),
+          parallel_execution_(parallel_execution),
+          state_prefetch_blocks_(state_prefetch_blocks),
+          state_storage_(state_storage),
           rule_set_{protocol::rule_set_factory(chain_config)} {}
 
     ~Execution() override = default;
@@ -52,15 +62,22 @@ class Execution final : public Stage {
     const ChainConfig& chain_config_;
     size_t batch_size_;
     db::PruneMode prune_mode_;
+    bool parallel_execution_;
+    size_t state_prefetch_blocks_;            // Number of upcoming blocks whose state is prefetched (0 means disabled)
+    db::Buffer::StateStorage state_storage_;  // Storage engine of state buffer
     protocol::RuleSetPtr rule_set_;
+    std::unique_ptr<ParallelExecutor> parallel_executor_;  // Executor of block transactions in parallel (if enabled)
     BlockNum block_num_{0};
     boost::circular_buffer<Block> prefetched_blocks_{/*buffer_capacity=*/kMaxPrefetchedBlocks};
+    std::unique_ptr<StatePrefetcher> state_prefetcher_;  // Warms up state for upcoming blocks (if enabled)
+    std::unique_ptr<BlockReader> block_reader_;          // Background reader of blocks (if block data is committed)
 
     //! \brief Prefetches blocks for processing
     //! \param [in] from: the first block to prefetch (inclusive)
     //! \param [in] to: the last block to prefetch (inclusive)
     //! \remarks The amount of blocks to be fetched is determined by the upper block number (to)
-    //! or kMaxPrefetchedBlocks collected, whichever comes first
+    //! or kMaxPrefetchedBlocks collected, whichever comes first. When the background reader is active
+    //! just the next block is taken, because the reader keeps decoding ahead of execution
     void prefetch_blocks(db::RWTxn& txn, BlockNum from, BlockNum to);
 
     //! \brief Executes a batch of blocks
@@ -83,6 +100,11 @@ class Execution final : public Stage {
     size_t processed_blocks_{0};
     size_t processed_transactions_{0};
     size_t processed_gas_{0};
+    size_t speculated_transactions_{0};
+    size_t reexecuted_transactions_{0};
+    size_t prefetched_keys_{0};
+    size_t prefetch_hits_{0};
+    size_t prefetch_misses_{0};
 };
 
 }  // namespace silkworm::stagedsync
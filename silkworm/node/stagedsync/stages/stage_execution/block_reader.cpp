@@ -0,0 +1,148 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_reader.hpp"
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/tables.hpp>
+
+namespace silkworm::stagedsync {
+
+void read_canonical_blocks(db::ROTxn& txn, BlockNum from, size_t count, const std::function<void(Block&&)>& consumer) {
+    size_t num_read{0};
+
+    db::DataModel data_model{txn};
+    auto canonicals = txn.ro_cursor(db::table::kCanonicalHashes);
+    Bytes starting_key{db::block_key(from)};
+    if (canonicals->seek(db::to_slice(starting_key))) {
+        BlockNum block_num{from};
+        auto walk_function{[&](ByteView key, ByteView value) {
+            BlockNum reached_block_num{endian::load_big_u64(key.data())};
+            if (reached_block_num != block_num) {
+                throw std::runtime_error("Bad canonical header sequence: expected " + std::to_string(block_num) +
+                                         " got " + std::to_string(reached_block_num));
+            } else if (value.length() != kHashLength) {
+                throw std::runtime_error("Invalid value for hash in " +
+                                         std::string(db::table::kCanonicalHashes.name) +
+                                         " expected=" + std::to_string(kHashLength) +
+                                         " got=" + std::to_string(value.length()));
+            }
+
+            const auto hash_ptr{value.data()};
+            Block block;
+            if (!data_model.read_block(std::span<const uint8_t, kHashLength>{hash_ptr, kHashLength}, block_num,
+                                       /*read_senders=*/true, block)) {
+                throw std::runtime_error("Unable to read block " + std::to_string(block_num));
+            }
+            consumer(std::move(block));
+            ++block_num;
+        }};
+        num_read = db::cursor_for_count(*canonicals, walk_function, count);
+    }
+
+    if (num_read != count) {
+        throw std::runtime_error("Missing block " + std::to_string(from + num_read));
+    }
+}
+
+BlockReader::BlockReader(mdbx::env env, BlockNum from, BlockNum to, size_t capacity, size_t lookahead,
+                         LookaheadFunc on_lookahead)
+    : env_{std::move(env)},
+      next_block_num_{from},
+      to_{to},
+      blocks_{capacity},
+      lookahead_{std::min(lookahead, capacity)},
+      on_lookahead_{std::move(on_lookahead)} {
+    thread_ = std::thread{[this]() { run(); }};
+}
+
+BlockReader::~BlockReader() {
+    stop();
+}
+
+bool BlockReader::pop(Block& block) {
+    std::unique_lock lock{mutex_};
+    if (blocks_.empty() && !done_) {
+        const auto start{std::chrono::steady_clock::now()};
+        not_empty_.wait(lock, [this]() { return !blocks_.empty() || done_; });
+        wait_duration_ += std::chrono::steady_clock::now() - start;
+    }
+    if (blocks_.empty()) {
+        // Blocks decoded before any failure are always delivered first
+        if (exception_) std::rethrow_exception(exception_);
+        return false;
+    }
+    block = std::move(blocks_.front());
+    blocks_.pop_front();
+    // The block at lookahead distance from the consumer has just entered the lookahead window
+    if (on_lookahead_ && lookahead_ > 0 && blocks_.size() >= lookahead_) {
+        on_lookahead_(blocks_[lookahead_ - 1]);
+    }
+    lock.unlock();
+    not_full_.notify_one();
+    return true;
+}
+
+void BlockReader::stop() {
+    {
+        std::unique_lock lock{mutex_};
+        stopping_ = true;
+    }
+    not_full_.notify_one();
+    if (thread_.joinable()) thread_.join();
+}
+
+void BlockReader::run() {
+    try {
+        while (next_block_num_ <= to_) {
+            const size_t count{std::min(static_cast<size_t>(to_ - next_block_num_ + 1), kBlocksPerTxn)};
+
+            db::ROTxnManaged txn{env_};
+            read_canonical_blocks(txn, next_block_num_, count, [this](Block&& block) {
+                std::unique_lock lock{mutex_};
+                not_full_.wait(lock, [this]() { return stopping_ || !blocks_.full(); });
+                if (stopping_) return;
+                blocks_.push_back(std::move(block));
+                if (on_lookahead_ && blocks_.size() <= lookahead_) {
+                    on_lookahead_(blocks_.back());
+                }
+                lock.unlock();
+                not_empty_.notify_one();
+            });
+            next_block_num_ += count;
+
+            std::unique_lock lock{mutex_};
+            if (stopping_) break;
+        }
+    } catch (...) {
+        std::unique_lock lock{mutex_};
+        exception_ = std::current_exception();
+    }
+
+    {
+        std::unique_lock lock{mutex_};
+        done_ = true;
+    }
+    not_empty_.notify_one();
+}
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,98 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <boost/circular_buffer.hpp>
+
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/db/mdbx/mdbx.hpp>
+
+namespace silkworm::stagedsync {
+
+//! \brief Reads a sequence of canonical blocks (senders included) starting at given height
+//! \param [in] from: the first block to read (inclusive)
+//! \param [in] count: the number of blocks to read
+//! \param [in] consumer: the function receiving each decoded block in sequence
+//! \throws std::runtime_error if the canonical sequence is broken or any block is missing
+void read_canonical_blocks(db::ROTxn& txn, BlockNum from, size_t count, const std::function<void(Block&&)>& consumer);
+
+//! \brief BlockReader decodes canonical blocks on a background thread, keeping a bounded ring of blocks ahead of
+//! the consumer so that block execution does not wait for headers, bodies and senders to be read and decoded
+//! \details The reader works on its own read-only transactions, hence it sees only *committed* data: block data
+//! must have been committed before the reader is started. Read-only transactions are periodically renewed not to
+//! hold old database snapshots for too long.
+class BlockReader {
+  public:
+    //! The function invoked on each block as soon as it gets within the lookahead distance from the consumer
+    using LookaheadFunc = std::function<void(const Block&)>;
+
+    //! \param [in] env: the database environment
+    //! \param [in] from: the first block to read (inclusive)
+    //! \param [in] to: the last block to read (inclusive)
+    //! \param [in] capacity: the max number of decoded blocks kept ahead of the consumer
+    //! \param [in] lookahead: the distance from the consumer at which blocks are passed to on_lookahead
+    //! \param [in] on_lookahead: the lookahead function (optional), which must be fast because invoked under lock
+    BlockReader(mdbx::env env, BlockNum from, BlockNum to, size_t capacity, size_t lookahead = 0,
+                LookaheadFunc on_lookahead = {});
+
+    // Not copyable nor movable
+    BlockReader(const BlockReader&) = delete;
+    BlockReader& operator=(const BlockReader&) = delete;
+
+    ~BlockReader();
+
+    //! \brief Waits for the next block in sequence to be available and moves it into the provided one
+    //! \return true if the block has been provided, false if all the blocks in range have been consumed
+    //! \throws the exception raised in the background reader, if any
+    bool pop(Block& block);
+
+    //! \brief Stops the background reader waiting for its termination
+    void stop();
+
+    //! \brief The overall time spent by the consumer waiting for blocks to be decoded
+    [[nodiscard]] std::chrono::nanoseconds wait_duration() const { return wait_duration_; }
+
+  private:
+    //! The number of blocks read using the same read-only transaction
+    static constexpr size_t kBlocksPerTxn{256};
+
+    void run();
+
+    mdbx::env env_;
+    BlockNum next_block_num_;  // the next block to be read by the background reader
+    const BlockNum to_;
+    boost::circular_buffer<Block> blocks_;
+    const size_t lookahead_;
+    LookaheadFunc on_lookahead_;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    bool done_{false};      // true when the background reader has terminated
+    bool stopping_{false};  // true when the background reader is asked to terminate
+    std::exception_ptr exception_;
+    std::chrono::nanoseconds wait_duration_{0};
+    std::thread thread_;
+};
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,96 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_reader.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+
+namespace silkworm::stagedsync {
+
+static void write_blocks(db::RWTxn& txn, BlockNum from, BlockNum to) {
+    for (BlockNum block_num{from}; block_num <= to; ++block_num) {
+        BlockHeader header;
+        header.number = block_num;
+        header.gas_limit = 30'000'000;
+        const auto block_hash{header.hash()};
+        db::write_header(txn, header, /*with_header_numbers=*/true);
+        db::write_body(txn, BlockBody{}, block_hash, block_num);
+        db::write_canonical_hash(txn, block_num, block_hash);
+    }
+}
+
+TEST_CASE("BlockReader") {
+    db::test_util::TempChainData context;
+    write_blocks(context.rw_txn(), 1, 10);
+    context.commit_and_renew_txn();
+
+    SECTION("read all blocks in sequence") {
+        BlockReader reader{context.env(), 1, 10, /*capacity=*/3};
+        Block block;
+        for (BlockNum block_num{1}; block_num <= 10; ++block_num) {
+            REQUIRE(reader.pop(block));
+            CHECK(block.header.number == block_num);
+        }
+        CHECK(!reader.pop(block));
+    }
+
+    SECTION("lookahead") {
+        std::vector<BlockNum> lookahead_blocks;
+        BlockReader reader{context.env(), 1, 10, /*capacity=*/5, /*lookahead=*/2, [&](const Block& block) {
+                               lookahead_blocks.push_back(block.header.number);
+                           }};
+        Block block;
+        for (BlockNum block_num{1}; block_num <= 10; ++block_num) {
+            REQUIRE(reader.pop(block));
+            CHECK(block.header.number == block_num);
+        }
+        CHECK(!reader.pop(block));
+        CHECK(lookahead_blocks == std::vector<BlockNum>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    }
+
+    SECTION("missing block") {
+        BlockReader reader{context.env(), 9, 11, /*capacity=*/3};
+        Block block;
+        REQUIRE(reader.pop(block));
+        CHECK(block.header.number == 9);
+        REQUIRE(reader.pop(block));
+        CHECK(block.header.number == 10);
+        CHECK_THROWS_AS(reader.pop(block), std::runtime_error);
+    }
+
+    SECTION("stop while reader is waiting") {
+        BlockReader reader{context.env(), 1, 10, /*capacity=*/1};
+        Block block;
+        REQUIRE(reader.pop(block));
+        CHECK(block.header.number == 1);
+        CHECK_NOTHROW(reader.stop());
+    }
+
+    SECTION("uncommitted blocks are not visible") {
+        write_blocks(context.rw_txn(), 11, 12);
+        BlockReader reader{context.env(), 11, 12, /*capacity=*/3};
+        Block block;
+        CHECK_THROWS_AS(reader.pop(block), std::runtime_error);
+    }
+}
+
+}  // namespace silkworm::stagedsync
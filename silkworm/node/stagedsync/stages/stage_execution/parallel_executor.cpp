@@ -0,0 +1,135 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "parallel_executor.hpp"
+
+#include <silkworm/core/protocol/validation.hpp>
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::stagedsync {
+
+ParallelExecutor::ParallelExecutor(protocol::RuleSet& rule_set, const ChainConfig& chain_config, size_t num_workers)
+    : rule_set_{rule_set},
+      chain_config_{chain_config},
+      workers_{static_cast<unsigned>(num_workers)} {}
+
+ValidationResult ParallelExecutor::execute_block(ExecutionProcessor& processor, const Block& block, const State& state,
+                                                 std::vector<Receipt>& receipts, CallTraces& traces) {
+    // Nothing to gain from speculation when there is at most one transaction
+    if (block.transactions.size() < 2) {
+        return processor.execute_block(receipts);
+    }
+
+    block_ = &block;
+    state_ = &state;
+    traces_ = &traces;
+
+    const size_t num_transactions{block.transactions.size()};
+    speculations_.clear();
+    speculations_.reserve(num_transactions);
+    for (size_t i{0}; i < num_transactions; ++i) {
+        speculations_.emplace_back(std::make_unique<Speculation>());
+    }
+    pending_speculations_ = num_transactions;
+    for (size_t i{0}; i < num_transactions; ++i) {
+        workers_.push_task([this, i]() { speculate(i); });
+    }
+
+    const ValidationResult result{processor.execute_block(receipts, this)};
+
+    // Speculations still running (e.g. after an invalid transaction) may need their reads to be served before ending
+    dispatcher_.serve_until([&]() { return pending_speculations_ == 0; });
+
+    speculations_.clear();
+    cache_.clear();
+    block_ = nullptr;
+    state_ = nullptr;
+    traces_ = nullptr;
+
+    return result;
+}
+
+void ParallelExecutor::speculate(size_t index) noexcept {
+    Speculation& speculation{*speculations_[index]};
+    try {
+        const Transaction& txn{block_->transactions[index]};
+        speculation.state = std::make_unique<SpeculativeState>(*state_, dispatcher_, cache_);
+        speculation.processor = std::make_unique<ExecutionProcessor>(*block_, rule_set_, *speculation.state,
+                                                                     chain_config_);
+        speculation.tracer = std::make_unique<CallTracer>(speculation.traces);
+        speculation.processor->evm().add_tracer(*speculation.tracer);
+
+        // The transaction may be invalid against the state at the beginning of the block (e.g. nonce too high
+        // because of a previous transaction from the same sender): leave it to serial execution
+        const auto& tx_state{speculation.processor->evm().state()};
+        if (protocol::validate_transaction(txn, tx_state, block_->header.gas_limit) == ValidationResult::kOk) {
+            speculation.gas_used = speculation.processor->execute_transaction_without_fees(txn, speculation.receipt);
+            speculation.valid = !speculation.state->read_failed();
+        }
+    } catch (const std::exception& ex) {
+        log::Warning("ParallelExecutor", {"speculation", std::to_string(index), "exception", ex.what()});
+        speculation.valid = false;
+    } catch (...) {
+        log::Warning("ParallelExecutor", {"speculation", std::to_string(index), "exception", "undefined"});
+        speculation.valid = false;
+    }
+    speculation.done = true;
+    --pending_speculations_;
+    dispatcher_.notify();
+}
+
+bool ParallelExecutor::try_apply(size_t index, ExecutionProcessor& processor, Receipt& receipt) noexcept {
+    Speculation& speculation{*speculations_[index]};
+    dispatcher_.serve_until([&]() { return speculation.done.load(); });
+
+    IntraBlockState& block_state{processor.evm().state()};
+    if (!speculation.valid || has_conflicts(speculation, block_state)) {
+        ++stats_.reexecuted_transactions;
+        return false;
+    }
+
+    receipt = std::move(speculation.receipt);
+    processor.apply_transaction(block_->transactions[index], speculation.processor->evm().state(),
+                                speculation.gas_used, receipt);
+    traces_->senders.merge(speculation.traces.senders);
+    traces_->recipients.merge(speculation.traces.recipients);
+
+    // Release memory as soon as possible, the speculation is done
+    speculation.processor.reset();
+    speculation.state.reset();
+    speculation.tracer.reset();
+
+    ++stats_.applied_transactions;
+    return true;
+}
+
+bool ParallelExecutor::has_conflicts(const Speculation& speculation, const IntraBlockState& block_state) noexcept {
+    for (const auto& address : speculation.state->account_reads()) {
+        if (block_state.is_account_modified(address)) {
+            return true;
+        }
+    }
+    for (const auto& [address, locations] : speculation.state->storage_reads()) {
+        for (const auto& location : locations) {
+            if (block_state.is_storage_modified(address, location)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace silkworm::stagedsync
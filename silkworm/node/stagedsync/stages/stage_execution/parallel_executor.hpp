@@ -0,0 +1,103 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/execution/call_tracer.hpp>
+#include <silkworm/core/execution/processor.hpp>
+#include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/core/types/call_traces.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+#include <silkworm/node/stagedsync/stages/stage_execution/speculative_state.hpp>
+
+namespace silkworm::stagedsync {
+
+//! \brief Optimistic parallel executor of block transactions (Block-STM style)
+//! \details All the transactions in a block are executed speculatively on a pool of worker threads, each one
+//! against the state at the beginning of the block and recording its read set. Transactions are then applied in
+//! order to the block state: a transaction whose reads do not overlap with the changes made by its predecessors is
+//! applied as is, otherwise it is executed again serially. Hence the outcome is always identical to serial execution.
+//! Fees are credited to the block beneficiary when applying, so that they don't make every transaction conflict.
+class ParallelExecutor final : public SpeculativeTransactions {
+  public:
+    struct Stats {
+        size_t applied_transactions{0};     // Transactions applied from speculative execution
+        size_t reexecuted_transactions{0};  // Transactions executed again due to conflicts or invalid speculation
+    };
+
+    ParallelExecutor(protocol::RuleSet& rule_set, const ChainConfig& chain_config, size_t num_workers);
+
+    // Not copyable nor movable
+    ParallelExecutor(const ParallelExecutor&) = delete;
+    ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+    ~ParallelExecutor() override = default;
+
+    //! \brief Execute the block on the processor running its transactions speculatively on the worker threads
+    //! \param processor: the block processor, which must have been created for the same block
+    //! \param state: the state underlying the processor, which is accessed only by the calling thread
+    //! \param receipts: the block receipts
+    //! \param traces: the collector of call traces for the transactions applied from speculative execution
+    //! \remarks Any call traces for transactions executed serially are collected by the processor tracers
+    [[nodiscard]] ValidationResult execute_block(ExecutionProcessor& processor, const Block& block, const State& state,
+                                                 std::vector<Receipt>& receipts, CallTraces& traces);
+
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+    void reset_stats() noexcept { stats_ = {}; }
+
+  private:
+    //! \brief The outcome of one transaction executed speculatively
+    struct Speculation {
+        std::unique_ptr<SpeculativeState> state;
+        std::unique_ptr<ExecutionProcessor> processor;
+        std::unique_ptr<CallTracer> tracer;
+        CallTraces traces;
+        Receipt receipt;
+        uint64_t gas_used{0};
+        bool valid{false};
+        std::atomic_bool done{false};
+    };
+
+    bool try_apply(size_t index, ExecutionProcessor& processor, Receipt& receipt) noexcept override;
+
+    //! \brief Execute the transaction at the specified index against the state at the beginning of the block
+    void speculate(size_t index) noexcept;
+
+    //! \brief Whether the speculative execution read anything modified by the preceding transactions
+    static bool has_conflicts(const Speculation& speculation, const IntraBlockState& block_state) noexcept;
+
+    protocol::RuleSet& rule_set_;
+    const ChainConfig& chain_config_;
+    ThreadPool workers_;
+    StateReadDispatcher dispatcher_;
+    SpeculativeState::Cache cache_;
+
+    // Current block execution context
+    const Block* block_{nullptr};
+    const State* state_{nullptr};
+    CallTraces* traces_{nullptr};
+    std::vector<std::unique_ptr<Speculation>> speculations_;
+    std::atomic_size_t pending_speculations_{0};
+
+    Stats stats_;
+};
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,219 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "parallel_executor.hpp"
+
+#include <bit>
+#include <stdexcept>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/test_util.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+#include <silkworm/core/trie/vector_root.hpp>
+#include <silkworm/core/types/evmc_bytes32.hpp>
+
+namespace silkworm::stagedsync {
+
+using namespace evmc::literals;
+
+static constexpr evmc::address kMiner{0x5a0b54d5dc17e0aadc383d2db43b0a0d3e029c4c_address};
+
+// Stores the first calldata word into storage slot 0 and logs it
+static constexpr evmc::address kStoreContract{0x1000000000000000000000000000000000000001_address};
+static const Bytes kStoreCode{*from_hex("60003560005536600060003760206000a0")};
+
+// Stores the balance of COINBASE into storage slot 0
+static constexpr evmc::address kCoinbaseContract{0x1000000000000000000000000000000000000002_address};
+static const Bytes kCoinbaseCode{*from_hex("4131600055")};
+
+static evmc::address sender(uint8_t i) {
+    evmc::address address{0x2000000000000000000000000000000000000000_address};
+    address.bytes[kAddressLength - 1] = i;
+    return address;
+}
+
+static void populate(InMemoryState& state) {
+    for (uint8_t i{1}; i <= 6; ++i) {
+        state.update_account(sender(i), std::nullopt, Account{.balance = kEther});
+    }
+    const std::vector<std::pair<evmc::address, Bytes>> contracts{{kStoreContract, kStoreCode},
+                                                                 {kCoinbaseContract, kCoinbaseCode}};
+    for (const auto& [address, code] : contracts) {
+        const auto code_hash{std::bit_cast<evmc_bytes32>(keccak256(code))};
+        state.update_account(address, std::nullopt, Account{.code_hash = code_hash, .incarnation = kDefaultIncarnation});
+        state.update_account_code(address, kDefaultIncarnation, code_hash, code);
+    }
+}
+
+static Transaction make_transaction(const evmc::address& from, uint64_t nonce, const evmc::address& to, Bytes data = {}) {
+    Transaction txn{};
+    txn.type = TransactionType::kLegacy;
+    txn.nonce = nonce;
+    txn.max_priority_fee_per_gas = 20 * kGiga;
+    txn.max_fee_per_gas = 20 * kGiga;
+    txn.gas_limit = 100'000;
+    txn.to = to;
+    txn.value = 1'000;
+    txn.data = std::move(data);
+    txn.r = 1;  // dummy
+    txn.s = 1;  // dummy
+    txn.set_sender(from);
+    return txn;
+}
+
+static Block make_block() {
+    const auto x{0x3000000000000000000000000000000000000001_address};
+    const auto y{0x3000000000000000000000000000000000000002_address};
+    const auto z{0x3000000000000000000000000000000000000003_address};
+
+    Block block{};
+    block.header.number = 1;
+    block.header.beneficiary = kMiner;
+    block.header.gas_limit = 10'000'000;
+    block.header.base_fee_per_gas = 10 * kGiga;
+    block.transactions = {
+        make_transaction(sender(1), 0, x),                                // independent
+        make_transaction(sender(2), 0, kStoreContract, Bytes(32, 0x01)),  // independent
+        make_transaction(sender(1), 1, y),                                // same sender as #0
+        make_transaction(sender(3), 0, kStoreContract, Bytes(32, 0x02)),  // same storage as #1
+        make_transaction(sender(4), 0, kCoinbaseContract),                // reads beneficiary credited by fees
+        make_transaction(sender(5), 0, x),                                // same recipient as #0
+        make_transaction(sender(6), 0, z),                                // independent
+    };
+    return block;
+}
+
+static void seal_block(Block& block, const std::vector<Receipt>& receipts) {
+    static constexpr auto kEncoder = [](Bytes& to, const Receipt& r) { rlp::encode(to, r); };
+    block.header.gas_used = receipts.back().cumulative_gas_used;
+    block.header.receipts_root = trie::root_hash(receipts, kEncoder);
+    block.header.logs_bloom = {};
+    for (const Receipt& receipt : receipts) {
+        join(block.header.logs_bloom, receipt.bloom);
+    }
+}
+
+static Bytes encode(const std::vector<Receipt>& receipts) {
+    Bytes encoded;
+    for (const Receipt& receipt : receipts) {
+        rlp::encode(encoded, receipt);
+    }
+    return encoded;
+}
+
+TEST_CASE("ParallelExecutor: consensus equivalence with serial execution") {
+    const ChainConfig& config{test::kLondonConfig};
+    auto rule_set{protocol::rule_set_factory(config)};
+    REQUIRE(rule_set);
+
+    Block block{make_block()};
+
+    // Dry run to fill in the header fields checked by post-execution validation
+    {
+        InMemoryState state;
+        populate(state);
+        ExecutionProcessor processor{block, *rule_set, state, config};
+        std::vector<Receipt> receipts;
+        (void)processor.execute_block(receipts);
+        REQUIRE(receipts.size() == block.transactions.size());
+        seal_block(block, receipts);
+    }
+
+    InMemoryState serial_state;
+    populate(serial_state);
+    ExecutionProcessor serial_processor{block, *rule_set, serial_state, config};
+    CallTraces serial_traces;
+    CallTracer serial_tracer{serial_traces};
+    serial_processor.evm().add_tracer(serial_tracer);
+    std::vector<Receipt> serial_receipts;
+    const ValidationResult serial_result{serial_processor.execute_block(serial_receipts)};
+    REQUIRE((serial_result == ValidationResult::kOk));
+    serial_processor.flush_state();
+
+    InMemoryState parallel_state;
+    populate(parallel_state);
+    ExecutionProcessor parallel_processor{block, *rule_set, parallel_state, config};
+    CallTraces parallel_traces;
+    CallTracer parallel_tracer{parallel_traces};
+    parallel_processor.evm().add_tracer(parallel_tracer);
+    std::vector<Receipt> parallel_receipts;
+    ParallelExecutor executor{*rule_set, config, /*num_workers=*/4};
+    const ValidationResult parallel_result{
+        executor.execute_block(parallel_processor, block, parallel_state, parallel_receipts, parallel_traces)};
+    CHECK((parallel_result == ValidationResult::kOk));
+    parallel_processor.flush_state();
+
+    // Conflicts are detected against the state at the beginning of the block, so they do not depend on scheduling
+    CHECK(executor.stats().applied_transactions == 3);
+    CHECK(executor.stats().reexecuted_transactions == 4);
+
+    CHECK(encode(parallel_receipts) == encode(serial_receipts));
+    CHECK(parallel_state.state_root_hash() == serial_state.state_root_hash());
+    CHECK(parallel_state.account_changes() == serial_state.account_changes());
+    CHECK(parallel_traces.senders == serial_traces.senders);
+    CHECK(parallel_traces.recipients == serial_traces.recipients);
+}
+
+TEST_CASE("ParallelExecutor: invalid transaction") {
+    const ChainConfig& config{test::kLondonConfig};
+    auto rule_set{protocol::rule_set_factory(config)};
+    REQUIRE(rule_set);
+
+    Block block{make_block()};
+    block.transactions[2].nonce = 5;  // wrong nonce
+
+    InMemoryState serial_state;
+    populate(serial_state);
+    ExecutionProcessor serial_processor{block, *rule_set, serial_state, config};
+    std::vector<Receipt> serial_receipts;
+    const ValidationResult serial_result{serial_processor.execute_block(serial_receipts)};
+
+    InMemoryState parallel_state;
+    populate(parallel_state);
+    ExecutionProcessor parallel_processor{block, *rule_set, parallel_state, config};
+    std::vector<Receipt> parallel_receipts;
+    CallTraces traces;
+    ParallelExecutor executor{*rule_set, config, /*num_workers=*/2};
+    const ValidationResult parallel_result{
+        executor.execute_block(parallel_processor, block, parallel_state, parallel_receipts, traces)};
+
+    CHECK((serial_result == ValidationResult::kWrongNonce));
+    CHECK((parallel_result == serial_result));
+}
+
+TEST_CASE("StateReadDispatcher: read failure forwarded to requesting thread") {
+    StateReadDispatcher dispatcher;
+    std::atomic_bool done{false};
+    bool rethrown{false};
+    std::thread worker{[&]() {
+        try {
+            (void)dispatcher.dispatch([]() -> int { throw std::runtime_error{"read failure"}; });
+        } catch (const std::runtime_error&) {
+            rethrown = true;
+        }
+        CHECK(dispatcher.dispatch([]() { return 42; }) == 42);
+        done = true;
+        dispatcher.notify();
+    }};
+    CHECK_NOTHROW(dispatcher.serve_until([&]() { return done.load(); }));
+    worker.join();
+    CHECK(rethrown);
+}
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,220 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "speculative_state.hpp"
+
+#include <stdexcept>
+
+namespace silkworm::stagedsync {
+
+void StateReadDispatcher::serve_until(const std::function<bool()>& condition) {
+    std::unique_lock lock{mutex_};
+    while (true) {
+        while (!requests_.empty()) {
+            Request* request{requests_.front()};
+            requests_.pop_front();
+            lock.unlock();
+            try {
+                request->read();
+                request->done.set_value();
+            } catch (...) {
+                request->done.set_exception(std::current_exception());
+            }
+            lock.lock();
+        }
+        if (condition()) {
+            return;
+        }
+        cv_.wait(lock);
+    }
+}
+
+void StateReadDispatcher::notify() {
+    {
+        // Synchronize with the owner thread checking the condition to avoid losing this wake-up
+        std::scoped_lock lock{mutex_};
+    }
+    cv_.notify_one();
+}
+
+std::optional<std::optional<Account>> SpeculativeState::Cache::get_account(const evmc::address& address) const {
+    std::scoped_lock lock{mutex_};
+    if (auto it{accounts_.find(address)}; it != accounts_.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void SpeculativeState::Cache::put_account(const evmc::address& address, const std::optional<Account>& account) {
+    std::scoped_lock lock{mutex_};
+    accounts_.insert_or_assign(address, account);
+}
+
+std::optional<evmc::bytes32> SpeculativeState::Cache::get_storage(const evmc::address& address, uint64_t incarnation,
+                                                                  const evmc::bytes32& location) const {
+    std::scoped_lock lock{mutex_};
+    auto it1{storage_.find(address)};
+    if (it1 == storage_.end()) {
+        return std::nullopt;
+    }
+    auto it2{it1->second.find(incarnation)};
+    if (it2 == it1->second.end()) {
+        return std::nullopt;
+    }
+    auto it3{it2->second.find(location)};
+    if (it3 == it2->second.end()) {
+        return std::nullopt;
+    }
+    return it3->second;
+}
+
+void SpeculativeState::Cache::put_storage(const evmc::address& address, uint64_t incarnation,
+                                          const evmc::bytes32& location, const evmc::bytes32& value) {
+    std::scoped_lock lock{mutex_};
+    storage_[address][incarnation].insert_or_assign(location, value);
+}
+
+std::optional<ByteView> SpeculativeState::Cache::get_code(const evmc::bytes32& code_hash) const {
+    std::scoped_lock lock{mutex_};
+    if (auto it{code_.find(code_hash)}; it != code_.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void SpeculativeState::Cache::put_code(const evmc::bytes32& code_hash, ByteView code) {
+    std::scoped_lock lock{mutex_};
+    code_.insert_or_assign(code_hash, code);
+}
+
+void SpeculativeState::Cache::clear() {
+    std::scoped_lock lock{mutex_};
+    accounts_.clear();
+    storage_.clear();
+    code_.clear();
+}
+
+std::optional<Account> SpeculativeState::read_account(const evmc::address& address) const noexcept {
+    account_reads_.insert(address);
+    if (auto cached{cache_.get_account(address)}) {
+        return *cached;
+    }
+    auto account{dispatch_read([&]() { return base_.read_account(address); })};
+    if (!read_failed_) {
+        cache_.put_account(address, account);
+    }
+    return account;
+}
+
+ByteView SpeculativeState::read_code(const evmc::bytes32& code_hash) const noexcept {
+    // Code is immutable content addressed by hash, so reading it never conflicts
+    if (auto cached{cache_.get_code(code_hash)}) {
+        return *cached;
+    }
+    ByteView code{dispatch_read([&]() { return base_.read_code(code_hash); })};
+    if (!read_failed_) {
+        cache_.put_code(code_hash, code);
+    }
+    return code;
+}
+
+evmc::bytes32 SpeculativeState::read_storage(const evmc::address& address, uint64_t incarnation,
+                                             const evmc::bytes32& location) const noexcept {
+    storage_reads_[address].insert(location);
+    if (auto cached{cache_.get_storage(address, incarnation, location)}) {
+        return *cached;
+    }
+    evmc::bytes32 value{dispatch_read([&]() { return base_.read_storage(address, incarnation, location); })};
+    if (!read_failed_) {
+        cache_.put_storage(address, incarnation, location, value);
+    }
+    return value;
+}
+
+uint64_t SpeculativeState::previous_incarnation(const evmc::address& address) const noexcept {
+    account_reads_.insert(address);
+    return dispatch_read([&]() { return base_.previous_incarnation(address); });
+}
+
+std::optional<BlockHeader> SpeculativeState::read_header(BlockNum block_number,
+                                                         const evmc::bytes32& block_hash) const noexcept {
+    return dispatch_read([&]() { return base_.read_header(block_number, block_hash); });
+}
+
+bool SpeculativeState::read_body(BlockNum block_number, const evmc::bytes32& block_hash,
+                                 BlockBody& out) const noexcept {
+    return dispatch_read([&]() { return base_.read_body(block_number, block_hash, out); });
+}
+
+std::optional<intx::uint256> SpeculativeState::total_difficulty(BlockNum block_number,
+                                                                const evmc::bytes32& block_hash) const noexcept {
+    return dispatch_read([&]() { return base_.total_difficulty(block_number, block_hash); });
+}
+
+evmc::bytes32 SpeculativeState::state_root_hash() const {
+    return dispatcher_.dispatch([&]() { return base_.state_root_hash(); });
+}
+
+BlockNum SpeculativeState::current_canonical_block() const {
+    return dispatcher_.dispatch([&]() { return base_.current_canonical_block(); });
+}
+
+std::optional<evmc::bytes32> SpeculativeState::canonical_hash(BlockNum block_number) const {
+    return dispatcher_.dispatch([&]() { return base_.canonical_hash(block_number); });
+}
+
+void SpeculativeState::insert_block(const Block&, const evmc::bytes32&) {
+    throw std::logic_error{"SpeculativeState::insert_block not supported"};
+}
+
+void SpeculativeState::canonize_block(BlockNum, const evmc::bytes32&) {
+    throw std::logic_error{"SpeculativeState::canonize_block not supported"};
+}
+
+void SpeculativeState::decanonize_block(BlockNum) {
+    throw std::logic_error{"SpeculativeState::decanonize_block not supported"};
+}
+
+void SpeculativeState::insert_receipts(BlockNum, const std::vector<Receipt>&) {
+    throw std::logic_error{"SpeculativeState::insert_receipts not supported"};
+}
+
+void SpeculativeState::insert_call_traces(BlockNum, const CallTraces&) {
+    throw std::logic_error{"SpeculativeState::insert_call_traces not supported"};
+}
+
+void SpeculativeState::begin_block(BlockNum, size_t) {
+    throw std::logic_error{"SpeculativeState::begin_block not supported"};
+}
+
+void SpeculativeState::update_account(const evmc::address&, std::optional<Account>, std::optional<Account>) {
+    throw std::logic_error{"SpeculativeState::update_account not supported"};
+}
+
+void SpeculativeState::update_account_code(const evmc::address&, uint64_t, const evmc::bytes32&, ByteView) {
+    throw std::logic_error{"SpeculativeState::update_account_code not supported"};
+}
+
+void SpeculativeState::update_storage(const evmc::address&, uint64_t, const evmc::bytes32&, const evmc::bytes32&,
+                                      const evmc::bytes32&) {
+    throw std::logic_error{"SpeculativeState::update_storage not supported"};
+}
+
+void SpeculativeState::unwind_state_changes(BlockNum) {
+    throw std::logic_error{"SpeculativeState::unwind_state_changes not supported"};
+}
+
+}  // namespace silkworm::stagedsync
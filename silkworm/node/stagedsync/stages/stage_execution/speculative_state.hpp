@@ -0,0 +1,203 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <silkworm/core/common/hash_maps.hpp>
+#include <silkworm/core/state/state.hpp>
+
+namespace silkworm::stagedsync {
+
+//! \brief Runs on the thread owning a state the reads requested by other threads
+//! \details The state used during execution (e.g. db::Buffer on top of a MDBX RW transaction) cannot be accessed
+//! concurrently nor from threads other than its owner, so workers queue their reads here and wait for the owner
+//! thread to serve them
+class StateReadDispatcher {
+  public:
+    StateReadDispatcher() = default;
+
+    // Not copyable nor movable
+    StateReadDispatcher(const StateReadDispatcher&) = delete;
+    StateReadDispatcher& operator=(const StateReadDispatcher&) = delete;
+
+    //! \brief Run the read on the owner thread and return its result, blocking the calling thread until done
+    //! \throws any exception thrown by the read on the owner thread
+    //! \pre Must not be called on the owner thread
+    template <typename F>
+    std::invoke_result_t<F> dispatch(F&& read) {
+        std::optional<std::invoke_result_t<F>> result;
+        Request request{[&]() { result.emplace(read()); }, {}};
+        std::future<void> done{request.done.get_future()};
+        {
+            std::scoped_lock lock{mutex_};
+            requests_.push_back(&request);
+        }
+        cv_.notify_one();
+        done.get();
+        return std::move(*result);
+    }
+
+    //! \brief Serve the pending reads on the owner thread until the specified condition is satisfied
+    //! \remarks Threads changing the condition state must call notify afterwards. Any exception thrown by a read is
+    //! forwarded to the requesting thread, so serving never throws
+    void serve_until(const std::function<bool()>& condition);
+
+    //! \brief Wake up the owner thread to check again the serving condition
+    void notify();
+
+  private:
+    struct Request {
+        std::function<void()> read;
+        std::promise<void> done;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Request*> requests_;
+};
+
+//! \brief Read-only view of the state at the beginning of a block used to execute one transaction speculatively
+//! \details All the accounts and storage locations read are recorded, so that the transaction outcome can be
+//! validated against the changes made by the preceding transactions in the block. Reads are shared among the
+//! speculative states of the same block through a common cache and dispatched to the base state owner on misses.
+class SpeculativeState : public State {
+  public:
+    //! \brief Cache of base state reads shared among the speculative states of the same block
+    class Cache {
+      public:
+        std::optional<std::optional<Account>> get_account(const evmc::address& address) const;
+        void put_account(const evmc::address& address, const std::optional<Account>& account);
+
+        std::optional<evmc::bytes32> get_storage(const evmc::address& address, uint64_t incarnation,
+                                                 const evmc::bytes32& location) const;
+        void put_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
+                         const evmc::bytes32& value);
+
+        std::optional<ByteView> get_code(const evmc::bytes32& code_hash) const;
+        void put_code(const evmc::bytes32& code_hash, ByteView code);
+
+        void clear();
+
+      private:
+        mutable std::mutex mutex_;
+        FlatHashMap<evmc::address, std::optional<Account>> accounts_;
+        FlatHashMap<evmc::address, FlatHashMap<uint64_t, FlatHashMap<evmc::bytes32, evmc::bytes32>>> storage_;
+        FlatHashMap<evmc::bytes32, ByteView> code_;
+    };
+
+    using StorageReads = FlatHashMap<evmc::address, FlatHashSet<evmc::bytes32>>;
+
+    SpeculativeState(const State& base, StateReadDispatcher& dispatcher, Cache& cache)
+        : base_{base}, dispatcher_{dispatcher}, cache_{cache} {}
+
+    //! \brief The accounts read by the transaction (including non-existent ones)
+    const FlatHashSet<evmc::address>& account_reads() const { return account_reads_; }
+
+    //! \brief The storage locations read by the transaction
+    const StorageReads& storage_reads() const { return storage_reads_; }
+
+    //! \brief Whether any read from the base state failed, so that the speculative execution must be discarded
+    bool read_failed() const { return read_failed_; }
+
+    /** @name Readers */
+    //!@{
+
+    std::optional<Account> read_account(const evmc::address& address) const noexcept override;
+
+    ByteView read_code(const evmc::bytes32& code_hash) const noexcept override;
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation,
+                               const evmc::bytes32& location) const noexcept override;
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override;
+
+    std::optional<BlockHeader> read_header(BlockNum block_number,
+                                           const evmc::bytes32& block_hash) const noexcept override;
+
+    [[nodiscard]] bool read_body(BlockNum block_number, const evmc::bytes32& block_hash,
+                                 BlockBody& out) const noexcept override;
+
+    std::optional<intx::uint256> total_difficulty(BlockNum block_number,
+                                                  const evmc::bytes32& block_hash) const noexcept override;
+
+    evmc::bytes32 state_root_hash() const override;
+
+    BlockNum current_canonical_block() const override;
+
+    std::optional<evmc::bytes32> canonical_hash(BlockNum block_number) const override;
+
+    //!@}
+
+    /** @name Writers: not supported, speculative execution never writes to the state */
+    //!@{
+
+    void insert_block(const Block& block, const evmc::bytes32& hash) override;
+
+    void canonize_block(BlockNum block_number, const evmc::bytes32& block_hash) override;
+
+    void decanonize_block(BlockNum block_number) override;
+
+    void insert_receipts(BlockNum block_number, const std::vector<Receipt>& receipts) override;
+
+    void insert_call_traces(BlockNum block_number, const CallTraces& traces) override;
+
+    void begin_block(BlockNum block_number, size_t updated_accounts_count) override;
+
+    void update_account(const evmc::address& address, std::optional<Account> initial,
+                        std::optional<Account> current) override;
+
+    void update_account_code(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& code_hash,
+                             ByteView code) override;
+
+    void update_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
+                        const evmc::bytes32& initial, const evmc::bytes32& current) override;
+
+    void unwind_state_changes(BlockNum block_number) override;
+
+    //!@}
+
+  private:
+    //! \brief Dispatch the read to the base state owner, recording any failure and returning a default value instead
+    //! \remarks Readers are noexcept, hence failures cannot propagate through the EVM and are checked afterwards
+    template <typename F>
+    std::invoke_result_t<F> dispatch_read(F&& read) const noexcept {
+        try {
+            return dispatcher_.dispatch(std::forward<F>(read));
+        } catch (...) {
+            read_failed_ = true;
+            return {};
+        }
+    }
+
+    const State& base_;
+    StateReadDispatcher& dispatcher_;
+    Cache& cache_;
+
+    mutable FlatHashSet<evmc::address> account_reads_;
+    mutable StorageReads storage_reads_;
+    mutable bool read_failed_{false};
+};
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,157 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_prefetcher.hpp"
+
+#include <algorithm>
+
+#include <silkworm/core/common/empty_hashes.hpp>
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::stagedsync {
+
+StatePrefetcher::StatePrefetcher(mdbx::env env, size_t num_workers)
+    : env_{std::move(env)},
+      workers_{static_cast<unsigned>(num_workers)} {}
+
+StatePrefetcher::~StatePrefetcher() {
+    // Let pending tasks complete as soon as possible
+    stopping_ = true;
+}
+
+void StatePrefetcher::prefetch(const Block& block) {
+    const BlockNum block_num{block.header.number};
+
+    FlatHashSet<evmc::address> unique_accounts;
+    std::vector<evmc::address> accounts;
+    std::vector<StorageKey> slots;
+    const auto add_account{[&](const evmc::address& address) {
+        if (unique_accounts.insert(address).second) {
+            accounts.push_back(address);
+        }
+    }};
+    add_account(block.header.beneficiary);
+    for (const auto& txn : block.transactions) {
+        if (const auto sender{txn.sender()}; sender) {
+            add_account(*sender);
+        }
+        if (txn.to) {
+            add_account(*txn.to);
+        }
+        for (const auto& entry : txn.access_list) {
+            add_account(entry.account);
+            for (const auto& storage_key : entry.storage_keys) {
+                slots.emplace_back(entry.account, storage_key);
+            }
+        }
+    }
+
+    // Split lookups in tasks, so that the lookups for the same block are performed in parallel
+    for (size_t i{0}; i < accounts.size(); i += kLookupsPerTask) {
+        const auto last{std::min(i + kLookupsPerTask, accounts.size())};
+        std::vector<evmc::address> task_accounts(accounts.begin() + static_cast<std::ptrdiff_t>(i),
+                                                 accounts.begin() + static_cast<std::ptrdiff_t>(last));
+        workers_.push_task([this, block_num, task_accounts = std::move(task_accounts)]() {
+            lookup(block_num, task_accounts, {});
+        });
+    }
+    for (size_t i{0}; i < slots.size(); i += kLookupsPerTask) {
+        const auto last{std::min(i + kLookupsPerTask, slots.size())};
+        std::vector<StorageKey> task_slots(slots.begin() + static_cast<std::ptrdiff_t>(i),
+                                           slots.begin() + static_cast<std::ptrdiff_t>(last));
+        workers_.push_task([this, block_num, task_slots = std::move(task_slots)]() {
+            lookup(block_num, {}, task_slots);
+        });
+    }
+}
+
+void StatePrefetcher::lookup(BlockNum block_num, const std::vector<evmc::address>& accounts,
+                             const std::vector<StorageKey>& slots) noexcept {
+    // Too late: the block is already being executed or done
+    if (stopping_ || block_num <= executing_block_num_) return;
+
+    try {
+        db::ROTxnManaged txn{env_};
+
+        std::vector<evmc::address> warmed;
+        warmed.reserve(accounts.size());
+        for (const auto& address : accounts) {
+            if (stopping_) return;
+            const auto account{db::read_account(txn, address)};
+            if (account && account->code_hash != kEmptyHash) {
+                (void)db::read_code(txn, account->code_hash);
+            }
+            warmed.push_back(address);
+        }
+        for (const auto& [address, location] : slots) {
+            if (stopping_) return;
+            if (const auto account{db::read_account(txn, address)}; account) {
+                (void)db::read_storage(txn, address, account->incarnation, location);
+            }
+        }
+
+        std::unique_lock lock{mutex_};
+        stats_.accounts += accounts.size();
+        stats_.slots += slots.size();
+        if (block_num > executing_block_num_) {
+            auto& warmed_accounts{warmed_accounts_[block_num]};
+            warmed_accounts.insert(warmed.cbegin(), warmed.cend());
+        }
+    } catch (const std::exception& ex) {
+        log::Trace("StatePrefetcher", {"block", std::to_string(block_num), "exception", ex.what()});
+    }
+}
+
+void StatePrefetcher::begin_block(BlockNum block_num) {
+    std::unique_lock lock{mutex_};
+    executing_block_num_ = block_num;
+}
+
+void StatePrefetcher::end_block(BlockNum block_num, const CallTraces& traces) {
+    std::unique_lock lock{mutex_};
+    const auto it{warmed_accounts_.find(block_num)};
+    const auto count_access{[&](const evmc::address& address) {
+        if (it != warmed_accounts_.end() && it->second.contains(address)) {
+            ++stats_.hits;
+        } else {
+            ++stats_.misses;
+        }
+    }};
+    for (const auto& address : traces.senders) {
+        count_access(address);
+    }
+    for (const auto& address : traces.recipients) {
+        if (!traces.senders.contains(address)) {
+            count_access(address);
+        }
+    }
+    if (it != warmed_accounts_.end()) {
+        warmed_accounts_.erase(it);
+    }
+}
+
+StatePrefetcher::Stats StatePrefetcher::stats() const {
+    std::unique_lock lock{mutex_};
+    return stats_;
+}
+
+void StatePrefetcher::reset_stats() {
+    std::unique_lock lock{mutex_};
+    stats_ = {};
+}
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,91 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <silkworm/core/common/hash_maps.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/core/types/call_traces.hpp>
+#include <silkworm/db/mdbx/mdbx.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+
+namespace silkworm::stagedsync {
+
+//! \brief StatePrefetcher warms up the database pages holding the state touched by upcoming blocks
+//! \details Senders, recipients, block beneficiary and access lists of upcoming blocks are looked up in PlainState
+//! (and contract code in Code) on a pool of worker threads using read-only transactions, so that the pages are
+//! already resident when execution reaches them. Looked up values are discarded: just the page cache is warmed.
+//! Accounts touched by execution are compared against the ones warmed before the block execution started to get
+//! hit/miss counters.
+class StatePrefetcher {
+  public:
+    struct Stats {
+        size_t accounts{0};  // Accounts looked up
+        size_t slots{0};     // Storage slots looked up
+        size_t hits{0};      // Accounts touched by execution which had been prefetched in time
+        size_t misses{0};    // Accounts touched by execution which had not been prefetched in time
+    };
+
+    StatePrefetcher(mdbx::env env, size_t num_workers);
+
+    // Not copyable nor movable
+    StatePrefetcher(const StatePrefetcher&) = delete;
+    StatePrefetcher& operator=(const StatePrefetcher&) = delete;
+
+    ~StatePrefetcher();
+
+    //! \brief Schedules the lookups for the state touched by the specified block
+    //! \remarks Just the keys are copied, so the block is not referenced after returning
+    void prefetch(const Block& block);
+
+    //! \brief Waits for all the scheduled lookups to complete
+    void wait_for_lookups() { workers_.wait_for_tasks(); }
+
+    //! \brief Signals that the specified block is about to be executed
+    void begin_block(BlockNum block_num);
+
+    //! \brief Signals that the specified block has been executed touching the accounts in given traces
+    void end_block(BlockNum block_num, const CallTraces& traces);
+
+    [[nodiscard]] Stats stats() const;
+    void reset_stats();
+
+  private:
+    //! The max number of lookups performed by one worker task
+    static constexpr size_t kLookupsPerTask{64};
+
+    using StorageKey = std::pair<evmc::address, evmc::bytes32>;
+
+    void lookup(BlockNum block_num, const std::vector<evmc::address>& accounts,
+                const std::vector<StorageKey>& slots) noexcept;
+
+    mdbx::env env_;
+    std::atomic<BlockNum> executing_block_num_{0};
+    std::atomic_bool stopping_{false};
+
+    mutable std::mutex mutex_;                                           // Synchronizes access to fields below
+    FlatHashMap<BlockNum, FlatHashSet<evmc::address>> warmed_accounts_;  // Accounts warmed before block execution
+    Stats stats_;
+
+    ThreadPool workers_;  // Must be last: pending tasks are completed on destruction
+};
+
+}  // namespace silkworm::stagedsync
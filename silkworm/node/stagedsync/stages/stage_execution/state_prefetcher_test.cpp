@@ -0,0 +1,82 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_prefetcher.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+
+namespace silkworm::stagedsync {
+
+using namespace evmc::literals;
+
+TEST_CASE("StatePrefetcher") {
+    db::test_util::TempChainData context;
+    context.commit_and_renew_txn();
+
+    static constexpr auto kBeneficiary{0xc000000000000000000000000000000000000000_address};
+    static constexpr auto kSender{0xa000000000000000000000000000000000000000_address};
+    static constexpr auto kRecipient{0xb000000000000000000000000000000000000000_address};
+    static constexpr auto kOther{0xd000000000000000000000000000000000000000_address};
+
+    Block block;
+    block.header.number = 1;
+    block.header.beneficiary = kBeneficiary;
+    block.transactions.resize(1);
+    block.transactions[0].set_sender(kSender);
+    block.transactions[0].to = kRecipient;
+    block.transactions[0].access_list = {{kRecipient, {0x01_bytes32, 0x02_bytes32}}};
+
+    StatePrefetcher prefetcher{context.env(), /*num_workers=*/2};
+
+    SECTION("prefetch before execution") {
+        prefetcher.prefetch(block);
+        prefetcher.wait_for_lookups();
+        CHECK(prefetcher.stats().accounts == 3);
+        CHECK(prefetcher.stats().slots == 2);
+
+        CallTraces traces;
+        traces.senders.insert(kSender);
+        traces.recipients.insert(kRecipient);
+        traces.recipients.insert(kBeneficiary);
+        traces.recipients.insert(kOther);
+        prefetcher.begin_block(1);
+        prefetcher.end_block(1, traces);
+        CHECK(prefetcher.stats().hits == 3);
+        CHECK(prefetcher.stats().misses == 1);
+
+        prefetcher.reset_stats();
+        CHECK(prefetcher.stats().accounts == 0);
+        CHECK(prefetcher.stats().hits == 0);
+    }
+
+    SECTION("prefetch too late") {
+        prefetcher.begin_block(1);
+        prefetcher.prefetch(block);
+        prefetcher.wait_for_lookups();
+        CHECK(prefetcher.stats().accounts == 0);
+        CHECK(prefetcher.stats().slots == 0);
+
+        CallTraces traces;
+        traces.senders.insert(kSender);
+        prefetcher.end_block(1, traces);
+        CHECK(prefetcher.stats().hits == 0);
+        CHECK(prefetcher.stats().misses == 1);
+    }
+}
+
+}  // namespace silkworm::stagedsync
@@ -16,6 +16,8 @@
 
 #include "stage_hashstate.hpp"
 
+#include <algorithm>
+#include <future>
 #include <stdexcept>
 
 #include <magic_enum.hpp>
@@ -26,6 +28,7 @@
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/db/access_layer.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 
 namespace silkworm::stagedsync {
 
@@ -72,6 +75,7 @@ Stage::Result HashState::forward(db::RWTxn& txn) {
             txn->clear_map(db::table::kHashedCodeHash.name);
             txn.commit_and_renew();
 
+            collector_ = std::make_unique<db::etl_mdbx::Collector>(etl_settings_);
             success_or_throw(hash_from_plainstate(txn));
             collector_->clear();
             reset_log_progress();
@@ -175,103 +179,148 @@ Stage::Result HashState::prune(db::RWTxn&) {
     return Stage::Result::kSuccess;
 }
 
-Stage::Result HashState::hash_from_plainstate(db::RWTxn& txn) {
-    Stage::Result ret{Stage::Result::kSuccess};
-    try {
-        auto source = txn.ro_cursor_dup_sort(db::table::kPlainState);
-        auto data{source->to_first(/*throw_notfound=*/true)};
+void HashState::hash_plainstate_range(db::ROTxn& txn, size_t first_byte, size_t end_byte,
+                                      db::etl_mdbx::Collector& collector) {
+    auto source = txn.ro_cursor_dup_sort(db::table::kPlainState);
+    const Bytes first_key(1, static_cast<uint8_t>(first_byte));
+    auto data{source->lower_bound(db::to_slice(first_key), /*throw_notfound=*/false)};
 
-        /*
-         * This relies on the assumption previous execution stage has completed correctly,
-         * and we do nothing more than hashing keys already present in PlainState either
-         * to HashedAccount or to HashedStorage. We don't need to check an upper block
-         * limit as PlainState holds info up to the highest executed block.
-         */
-
-        evmc::address last_address{};
-        ethash_hash256 address_hash{keccak256(last_address.bytes)};  // We might have all zeroed addresses ?
-
-        std::unique_lock log_lck(log_mtx_);
-        current_source_ = std::string(db::table::kPlainState.name);
-        current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
-        log_lck.unlock();
+    /*
+     * This relies on the assumption previous execution stage has completed correctly,
+     * and we do nothing more than hashing keys already present in PlainState either
+     * to HashedAccount or to HashedStorage. We don't need to check an upper block
+     * limit as PlainState holds info up to the highest executed block.
+     */
 
-        // New Hashed Storage Entry Key (72 bytes)
-        // + Address hash  (32 bytes)
-        // + Incarnation   ( 8 bytes)
-        // + Location hash (32 bytes)
-        Bytes etl_storage_entry_key(72, '\0');
+    evmc::address last_address{};
+    ethash_hash256 address_hash{keccak256(last_address.bytes)};  // We might have all zeroed addresses ?
+
+    // New Hashed Storage Entry Key (72 bytes)
+    // + Address hash  (32 bytes)
+    // + Incarnation   ( 8 bytes)
+    // + Location hash (32 bytes)
+    Bytes etl_storage_entry_key(72, '\0');
+
+    // Hash accounts
+    while (data) {
+        auto data_key_view{db::from_slice(data.key)};
+        if (data_key_view[0] >= end_byte) {
+            break;
+        }
 
-        // Hash accounts
-        while (data) {
-            auto data_key_view{db::from_slice(data.key)};
+        // We're reading PlainState which keys are ordered by address (always initial 20 bytes of key)
+        // Rehash the address only when changes
+        if (std::memcmp(data_key_view.data(), last_address.bytes, kAddressLength) != 0) {
+            throw_if_stopping();
+            last_address = bytes_to_address(data_key_view);
+            address_hash = keccak256(last_address.bytes);
+            std::unique_lock log_lck(log_mtx_);
+            current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
+        }
 
-            // We're reading PlainState which keys are ordered by address (always initial 20 bytes of key)
-            // Rehash the address only when changes
-            if (std::memcmp(data_key_view.data(), last_address.bytes, kAddressLength) != 0) {
-                throw_if_stopping();
-                last_address = bytes_to_address(data_key_view);
-                address_hash = keccak256(last_address.bytes);
-                log_lck.lock();
-                current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
-                log_lck.unlock();
+        if (data.key.length() == kAddressLength) {
+            // Hash account
+            // data.key == Address
+            // data.value == Account encoded for storage (must exist)
+            if (data.value.empty()) {
+                const std::string what("Unexpected empty value in PlainState for Account " +
+                                       to_hex(last_address.bytes, /*with_prefix=*/true));
+                throw StageError(Stage::Result::kUnexpectedError, what);
             }
 
-            if (data.key.length() == kAddressLength) {
-                // Hash account
-                // data.key == Address
-                // data.value == Account encoded for storage (must exist)
-                if (data.value.empty()) {
-                    const std::string what("Unexpected empty value in PlainState for Account " + current_key_);
+            collector.collect(address_hash.bytes, db::from_slice(data.value));
+
+        } else if (data.key.length() == db::kPlainStoragePrefixLength) {
+            // Hash storage
+            // data.key           == Address + Incarnation
+            // data.value (multi) == Location + zeroless Value
+
+            // See above for allocation
+            std::memcpy(&etl_storage_entry_key[0], address_hash.bytes, kHashLength);
+            std::memcpy(&etl_storage_entry_key[kHashLength], &data_key_view[kAddressLength],
+                        db::kIncarnationLength);
+
+            // Iterate dupkeys only to avoid re-hashing of same address
+            while (data) {
+                if (!(data.value.length() > kHashLength)) {
+                    const auto incarnation{endian::load_big_u64(&data_key_view[kAddressLength])};
+                    const std::string what("Unexpected empty value in PlainState for Account " +
+                                           to_hex(last_address.bytes, /*with_prefix=*/true) +
+                                           " incarnation " + std::to_string(incarnation));
                     throw StageError(Stage::Result::kUnexpectedError, what);
                 }
 
-                Entry entry{Bytes(address_hash.bytes, kHashLength), Bytes{db::from_slice(data.value)}};
-                collector_->collect(std::move(entry));
-
-            } else if (data.key.length() == db::kPlainStoragePrefixLength) {
-                // Hash storage
-                // data.key           == Address + Incarnation
-                // data.value (multi) == Location + zeroless Value
-
-                // See above for allocation
-                std::memcpy(&etl_storage_entry_key[0], address_hash.bytes, kHashLength);
-                std::memcpy(&etl_storage_entry_key[kHashLength], &data_key_view[kAddressLength],
-                            db::kIncarnationLength);
-
-                // Iterate dupkeys only to avoid re-hashing of same address
-                while (data) {
-                    if (!(data.value.length() > kHashLength)) {
-                        const auto incarnation{endian::load_big_u64(&data_key_view[kAddressLength])};
-                        const std::string what("Unexpected empty value in PlainState for Account " + current_key_ +
-                                               " incarnation " + std::to_string(incarnation));
-                        throw StageError(Stage::Result::kUnexpectedError, what);
-                    }
+                /*
+                 * NOTE !
+                 * Destination table kHashedStorage is dup-sorted but as Collector implements sorting only on entry
+                 * key here we have to build the entry key as hashed address + incarnation + hashed storage location
+                 * eventually leaving entry value to only hashed storage value. This ensures entries are collected
+                 * and sorted properly and eventually the loader will move back hashed storage location in the value
+                 * part of the db record. This way we can reliably insert records using MDBX_APPENDDUP
+                 */
+
+                auto data_value_view{db::from_slice(data.value)};
+                std::memcpy(&etl_storage_entry_key[kHashLength + db::kIncarnationLength],
+                            keccak256(data_value_view.substr(0, kHashLength)).bytes, kHashLength);
+                data_value_view.remove_prefix(kHashLength);
+                collector.collect(etl_storage_entry_key, data_value_view);
+                data = source->to_current_next_multi(false);
+            }
 
-                    /*
-                     * NOTE !
-                     * Destination table kHashedStorage is dup-sorted but as Collector implements sorting only on entry
-                     * key here we have to build the entry key as hashed address + incarnation + hashed storage location
-                     * eventually leaving entry value to only hashed storage value. This ensures entries are collected
-                     * and sorted properly and eventually the loader will move back hashed storage location in the value
-                     * part of the db record. This way we can reliably insert records using MDBX_APPENDDUP
-                     */
-
-                    auto data_value_view{db::from_slice(data.value)};
-                    std::memcpy(&etl_storage_entry_key[kHashLength + db::kIncarnationLength],
-                                keccak256(data_value_view.substr(0, kHashLength)).bytes, kHashLength);
-                    data_value_view.remove_prefix(kHashLength);
-                    Entry entry{etl_storage_entry_key, Bytes{data_value_view}};
-                    collector_->collect(std::move(entry));
-                    data = source->to_current_next_multi(false);
-                }
+        } else {
+            std::string what{"Unexpected key length " + std::to_string(data.key.length())};
+            throw StageError(Stage::Result::kUnexpectedError, what);
+        }
 
-            } else {
-                std::string what{"Unexpected key length " + std::to_string(data.key.length())};
-                throw StageError(Stage::Result::kUnexpectedError, what);
+        data = source->to_next(/*throw_notfound=*/false);
+    }
+}
+
+Stage::Result HashState::hash_from_plainstate(db::RWTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+    try {
+        std::unique_lock log_lck(log_mtx_);
+        current_source_ = std::string(db::table::kPlainState.name);
+        current_key_.clear();
+        log_lck.unlock();
+
+        // Per-range collectors flush into the same work path of collector_ which takes over their files
+        std::vector<std::unique_ptr<db::etl_mdbx::Collector>> range_collectors;
+
+        // Parallel readers only see committed data: PlainState has been committed by forward (unless disabled)
+        const size_t num_ranges{txn.commit_disabled() ? 1 : std::clamp<size_t>(num_workers_, 1, 256)};
+        if (num_ranges == 1) {
+            hash_plainstate_range(txn, 0, 256, *collector_);
+        } else {
+            // Split PlainState in ranges of first address byte, each one hashed by its own reader into its own
+            // collector. Total memory for collectors stays the same as for the sequential path
+            db::etl::CollectorSettings range_settings{etl_settings_};
+            range_settings.buffer_size = std::max<size_t>(etl_settings_.buffer_size / num_ranges, 1_Mebi);
+            for (size_t i{0}; i < num_ranges; ++i) {
+                range_collectors.push_back(std::make_unique<db::etl_mdbx::Collector>(range_settings));
             }
 
-            data = source->to_next(/*throw_notfound=*/false);
+            ThreadPool workers{static_cast<unsigned>(num_ranges)};
+            std::vector<std::future<void>> results;
+            results.reserve(num_ranges);
+            for (size_t i{0}; i < num_ranges; ++i) {
+                results.push_back(workers.submit([&, i]() {
+                    db::ROTxnManaged range_txn{txn.db()};
+                    hash_plainstate_range(range_txn, 256 * i / num_ranges, 256 * (i + 1) / num_ranges,
+                                          *range_collectors[i]);
+                }));
+            }
+            for (auto& result : results) {
+                result.wait();
+            }
+            for (auto& result : results) {
+                result.get();  // Rethrows the first error occurred in workers
+            }
+
+            // Hashed keys are spread over all ranges: collector_ merges the sorted files of every range on load
+            for (auto& range_collector : range_collectors) {
+                collector_->merge(*range_collector);
+            }
         }
 
         throw_if_stopping();
@@ -377,8 +426,7 @@ Stage::Result HashState::hash_from_plaincode(db::RWTxn& txn) {
 
             std::memcpy(&new_key[kHashLength], &data_key_view[kAddressLength], db::kIncarnationLength);
 
-            Entry entry{new_key, Bytes{db::from_slice(data.value)}};
-            collector_->collect(std::move(entry));
+            collector_->collect(new_key, db::from_slice(data.value));
             data = source->to_next(/*throw_notfound=*/false);
         }
 
@@ -417,6 +465,55 @@ Stage::Result HashState::hash_from_plaincode(db::RWTxn& txn) {
     return ret;
 }
 
+size_t HashState::changeset_scan_ranges(const db::RWTxn& txn, BlockNum from, BlockNum to) const {
+    // Below this number of blocks per range the setup of parallel readers is not worth it
+    static constexpr BlockNum kMinBlocksPerRange{1'024};
+    if (txn.commit_disabled() || num_workers_ < 2 || to < from || to - from + 1 < 2 * kMinBlocksPerRange) {
+        return 1;
+    }
+    return std::min<size_t>(num_workers_, (to - from + 1) / kMinBlocksPerRange);
+}
+
+void HashState::collect_account_changes(db::ROTxn& txn, BlockNum from, BlockNum to,
+                                        ChangedAddresses& changed_addresses) {
+    BlockNum reached_blocknum{0};
+
+    auto source_initial_key{db::block_key(from)};
+    auto source_changeset = txn.ro_cursor_dup_sort(db::table::kAccountChangeSet);
+    auto source_plainstate = txn.ro_cursor_dup_sort(db::table::kPlainState);
+    // Blocks may have no account changes at all (e.g. empty blocks with no miner reward) so look for the first one
+    auto changeset_data{source_changeset->lower_bound(db::to_slice(source_initial_key), /*throw_notfound=*/false)};
+    while (changeset_data.done) {
+        reached_blocknum = endian::load_big_u64(db::from_slice(changeset_data.key).data());
+        if (reached_blocknum > to) {
+            break;
+        }
+
+        if (reached_blocknum % 32 == 0) {
+            throw_if_stopping();
+            std::unique_lock log_lck(log_mtx_);
+            current_key_ = std::to_string(reached_blocknum);
+        }
+
+        while (changeset_data) {
+            auto changeset_value_view{db::from_slice(changeset_data.value)};
+            evmc::address address{bytes_to_address(changeset_value_view)};
+            if (!changed_addresses.contains(address)) {
+                auto address_hash{to_bytes32(keccak256(address.bytes).bytes)};
+                auto plainstate_data{source_plainstate->find(db::to_slice(address), /*throw_notfound=*/false)};
+                if (plainstate_data.done) {
+                    Bytes current_value{db::from_slice(plainstate_data.value)};
+                    changed_addresses[address] = std::make_pair(address_hash, current_value);
+                } else {
+                    changed_addresses[address] = std::make_pair(address_hash, Bytes());
+                }
+            }
+            changeset_data = source_changeset->to_current_next_multi(/*throw_notfound=*/false);
+        }
+        changeset_data = source_changeset->to_next(/*throw_notfound=*/false);
+    }
+}
+
 Stage::Result HashState::hash_from_account_changeset(db::RWTxn& txn, BlockNum previous_progress, BlockNum to) {
     Stage::Result ret{Stage::Result::kSuccess};
     try {
@@ -424,57 +521,46 @@ Stage::Result HashState::hash_from_account_changeset(db::RWTxn& txn, BlockNum pr
          * 1) Read AccountChangeSet from previous_progress to 'to'
          * 2) For each address changed hash it and lookup current value from PlainState
          * 3) Process the collected list and write values into Hashed tables (Account and Code)
+         *
+         * Large segments are split into block ranges scanned in parallel. Collected values are the current ones
+         * in PlainState hence the same address collected by different ranges brings the same value
          */
 
-        BlockNum reached_blocknum{0};
-        BlockNum expected_blocknum{previous_progress + 1};
         ChangedAddresses changed_addresses{};
 
         std::unique_lock log_lck(log_mtx_);
         operation_ = OperationType::Forward;
         incremental_ = true;
         current_source_ = std::string(db::table::kAccountChangeSet.name);
-        current_key_ = std::to_string(expected_blocknum);
+        current_key_ = std::to_string(previous_progress + 1);
         log_lck.unlock();
 
-        auto source_initial_key{db::block_key(expected_blocknum)};
-        auto source_changeset = txn.ro_cursor_dup_sort(db::table::kAccountChangeSet);
-        auto source_plainstate = txn.ro_cursor_dup_sort(db::table::kPlainState);
-        auto changeset_data{
-            source_changeset->find(db::to_slice(source_initial_key),  // Initial record MUST be found because
-                                   /*throw_notfound=*/true)};         // there is at least 1 change per block
-                                                                      // (the miner reward)
-        while (changeset_data.done) {
-            reached_blocknum = endian::load_big_u64(db::from_slice(changeset_data.key).data());
-            check_block_sequence(reached_blocknum, expected_blocknum);
-            if (reached_blocknum > to) {
-                break;
+        const size_t num_ranges{changeset_scan_ranges(txn, previous_progress + 1, to)};
+        if (num_ranges == 1) {
+            collect_account_changes(txn, previous_progress + 1, to, changed_addresses);
+        } else {
+            std::vector<ChangedAddresses> range_changes(num_ranges);
+            const BlockNum range_width{(to - previous_progress) / num_ranges};
+            ThreadPool workers{static_cast<unsigned>(num_ranges)};
+            std::vector<std::future<void>> results;
+            results.reserve(num_ranges);
+            for (size_t i{0}; i < num_ranges; ++i) {
+                const BlockNum range_from{previous_progress + 1 + i * range_width};
+                const BlockNum range_to{i + 1 == num_ranges ? to : range_from + range_width - 1};
+                results.push_back(workers.submit([&, i, range_from, range_to]() {
+                    db::ROTxnManaged range_txn{txn.db()};
+                    collect_account_changes(range_txn, range_from, range_to, range_changes[i]);
+                }));
             }
-
-            if (reached_blocknum % 32 == 0) {
-                throw_if_stopping();
-                log_lck.lock();
-                current_key_ = std::to_string(reached_blocknum);
-                log_lck.unlock();
+            for (auto& result : results) {
+                result.wait();
             }
-
-            while (changeset_data) {
-                auto changeset_value_view{db::from_slice(changeset_data.value)};
-                evmc::address address{bytes_to_address(changeset_value_view)};
-                if (!changed_addresses.contains(address)) {
-                    auto address_hash{to_bytes32(keccak256(address.bytes).bytes)};
-                    auto plainstate_data{source_plainstate->find(db::to_slice(address), /*throw_notfound=*/false)};
-                    if (plainstate_data.done) {
-                        Bytes current_value{db::from_slice(plainstate_data.value)};
-                        changed_addresses[address] = std::make_pair(address_hash, current_value);
-                    } else {
-                        changed_addresses[address] = std::make_pair(address_hash, Bytes());
-                    }
-                }
-                changeset_data = source_changeset->to_current_next_multi(/*throw_notfound=*/false);
+            for (auto& result : results) {
+                result.get();  // Rethrows the first error occurred in workers
+            }
+            for (auto& changes : range_changes) {
+                changed_addresses.merge(changes);
             }
-            ++expected_blocknum;
-            changeset_data = source_changeset->to_next(/*throw_notfound=*/false);
         }
 
         ret = write_changes_from_changed_addresses(txn, changed_addresses);
@@ -500,6 +586,66 @@ Stage::Result HashState::hash_from_account_changeset(db::RWTxn& txn, BlockNum pr
     return ret;
 }
 
+void HashState::collect_storage_changes(db::ROTxn& txn, BlockNum from, BlockNum to,
+                                        db::StorageChanges& storage_changes, HashedAddresses& hashed_addresses) {
+    BlockNum reached_blocknum{0};
+
+    auto source_changeset = txn.ro_cursor_dup_sort(db::table::kStorageChangeSet);
+    auto source_plainstate = txn.ro_cursor_dup_sort(db::table::kPlainState);
+
+    // find fist block with changes
+    BlockNum initial_block{from};
+    auto source_initial_key{db::block_key(initial_block)};
+    auto changeset_data = source_changeset->lower_bound(db::to_slice(source_initial_key), /*throw_notfound=*/false);
+    while (!changeset_data.done && initial_block <= to) {
+        ++initial_block;
+        source_initial_key = db::block_key(initial_block);
+        changeset_data = source_changeset->lower_bound(db::to_slice(source_initial_key), /*throw_notfound=*/false);
+    }
+
+    // process changes
+    while (changeset_data.done) {
+        auto changeset_key_view{db::from_slice(changeset_data.key)};
+        reached_blocknum = endian::load_big_u64(changeset_key_view.data());
+        if (reached_blocknum > to) {
+            break;
+        }
+
+        if (reached_blocknum % 32 == 0) {
+            throw_if_stopping();
+            std::unique_lock log_lck(log_mtx_);
+            current_key_ = std::to_string(reached_blocknum);
+        }
+
+        changeset_key_view.remove_prefix(8);
+        evmc::address address{bytes_to_address(changeset_key_view)};
+        changeset_key_view.remove_prefix(kAddressLength);
+
+        const auto incarnation{endian::load_big_u64(changeset_key_view.data())};
+        if (!incarnation) {
+            throw StageError(Stage::Result::kUnexpectedError, "Unexpected EOA in StorageChangeset");
+        }
+        if (!hashed_addresses.contains(address)) {
+            hashed_addresses[address] = to_bytes32(keccak256(address.bytes).bytes);
+            storage_changes[address].insert_or_assign(incarnation, absl::btree_map<evmc::bytes32, Bytes>());
+        }
+
+        Bytes plain_storage_prefix{db::storage_prefix(address, incarnation)};
+
+        while (changeset_data.done) {
+            auto changeset_value_view{db::from_slice(changeset_data.value)};
+            auto location{to_bytes32(changeset_value_view)};
+            if (!storage_changes[address][incarnation].contains(location)) {
+                auto plain_state_value{db::find_value_suffix(*source_plainstate, plain_storage_prefix, location.bytes)};
+                storage_changes[address][incarnation].insert_or_assign(location,
+                                                                       plain_state_value.value_or(Bytes()));
+            }
+            changeset_data = source_changeset->to_current_next_multi(/*throw_notfound=*/false);
+        }
+        changeset_data = source_changeset->to_next(/*throw_notfound=*/false);
+    }
+}
+
 Stage::Result HashState::hash_from_storage_changeset(db::RWTxn& txn, BlockNum previous_progress, BlockNum to) {
     Stage::Result ret{Stage::Result::kSuccess};
     try {
@@ -507,12 +653,12 @@ Stage::Result HashState::hash_from_storage_changeset(db::RWTxn& txn, BlockNum pr
          * 1) Read StorageChangeSet from previous_progress to 'to'
          * 2) For each address + incarnation changed hash it and lookup current value from PlainState
          * 3) Process the collected list and write values into HashedStorage
+         *
+         * Large segments are split into block ranges scanned in parallel (see hash_from_account_changeset)
          */
 
-        BlockNum reached_blocknum{0};
-
         db::StorageChanges storage_changes{};
-        absl::btree_map<evmc::address, evmc::bytes32> hashed_addresses{};
+        HashedAddresses hashed_addresses{};
 
         std::unique_lock log_lck(log_mtx_);
         operation_ = OperationType::Forward;
@@ -521,60 +667,39 @@ Stage::Result HashState::hash_from_storage_changeset(db::RWTxn& txn, BlockNum pr
         current_key_ = std::to_string(previous_progress + 1);
         log_lck.unlock();
 
-        auto source_changeset = txn.ro_cursor_dup_sort(db::table::kStorageChangeSet);
-        auto source_plainstate = txn.ro_cursor_dup_sort(db::table::kPlainState);
-
-        // find fist block with changes
-        BlockNum initial_block{previous_progress + 1};
-        auto source_initial_key{db::block_key(initial_block)};
-        auto changeset_data = source_changeset->lower_bound(db::to_slice(source_initial_key), /*throw_notfound=*/false);
-        while (!changeset_data.done && initial_block <= to) {
-            ++initial_block;
-            source_initial_key = db::block_key(initial_block);
-            changeset_data = source_changeset->lower_bound(db::to_slice(source_initial_key), /*throw_notfound=*/false);
-        }
-
-        // process changes
-        while (changeset_data.done) {
-            auto changeset_key_view{db::from_slice(changeset_data.key)};
-            reached_blocknum = endian::load_big_u64(changeset_key_view.data());
-            if (reached_blocknum > to) {
-                break;
-            }
-
-            if (reached_blocknum % 32 == 0) {
-                throw_if_stopping();
-                log_lck.lock();
-                current_key_ = std::to_string(reached_blocknum);
-                log_lck.unlock();
+        const size_t num_ranges{changeset_scan_ranges(txn, previous_progress + 1, to)};
+        if (num_ranges == 1) {
+            collect_storage_changes(txn, previous_progress + 1, to, storage_changes, hashed_addresses);
+        } else {
+            std::vector<db::StorageChanges> range_storage_changes(num_ranges);
+            std::vector<HashedAddresses> range_hashed_addresses(num_ranges);
+            const BlockNum range_width{(to - previous_progress) / num_ranges};
+            ThreadPool workers{static_cast<unsigned>(num_ranges)};
+            std::vector<std::future<void>> results;
+            results.reserve(num_ranges);
+            for (size_t i{0}; i < num_ranges; ++i) {
+                const BlockNum range_from{previous_progress + 1 + i * range_width};
+                const BlockNum range_to{i + 1 == num_ranges ? to : range_from + range_width - 1};
+                results.push_back(workers.submit([&, i, range_from, range_to]() {
+                    db::ROTxnManaged range_txn{txn.db()};
+                    collect_storage_changes(range_txn, range_from, range_to, range_storage_changes[i],
+                                            range_hashed_addresses[i]);
+                }));
             }
-
-            changeset_key_view.remove_prefix(8);
-            evmc::address address{bytes_to_address(changeset_key_view)};
-            changeset_key_view.remove_prefix(kAddressLength);
-
-            const auto incarnation{endian::load_big_u64(changeset_key_view.data())};
-            if (!incarnation) {
-                throw StageError(Stage::Result::kUnexpectedError, "Unexpected EOA in StorageChangeset");
+            for (auto& result : results) {
+                result.wait();
             }
-            if (!hashed_addresses.contains(address)) {
-                hashed_addresses[address] = to_bytes32(keccak256(address.bytes).bytes);
-                storage_changes[address].insert_or_assign(incarnation, absl::btree_map<evmc::bytes32, Bytes>());
+            for (auto& result : results) {
+                result.get();  // Rethrows the first error occurred in workers
             }
-
-            Bytes plain_storage_prefix{db::storage_prefix(address, incarnation)};
-
-            while (changeset_data.done) {
-                auto changeset_value_view{db::from_slice(changeset_data.value)};
-                auto location{to_bytes32(changeset_value_view)};
-                if (!storage_changes[address][incarnation].contains(location)) {
-                    auto plain_state_value{db::find_value_suffix(*source_plainstate, plain_storage_prefix, location.bytes)};
-                    storage_changes[address][incarnation].insert_or_assign(location,
-                                                                           plain_state_value.value_or(Bytes()));
+            for (size_t i{0}; i < num_ranges; ++i) {
+                hashed_addresses.merge(range_hashed_addresses[i]);
+                for (auto& [address, incarnations] : range_storage_changes[i]) {
+                    for (auto& [incarnation, locations] : incarnations) {
+                        storage_changes[address][incarnation].merge(locations);
+                    }
                 }
-                changeset_data = source_changeset->to_current_next_multi(/*throw_notfound=*/false);
             }
-            changeset_data = source_changeset->to_next(/*throw_notfound=*/false);
         }
 
         ret = write_changes_from_changed_storage(txn, storage_changes, hashed_addresses);
@@ -845,7 +970,7 @@ Stage::Result HashState::write_changes_from_changed_addresses(db::RWTxn& txn, co
 
 Stage::Result HashState::write_changes_from_changed_storage(
     db::RWTxn& txn, db::StorageChanges& storage_changes,
-    const absl::btree_map<evmc::address, evmc::bytes32>& hashed_addresses) {
+    const HashedAddresses& hashed_addresses) {
     throw_if_stopping();
     auto target_hashed_storage = txn.rw_cursor_dup_sort(db::table::kHashedStorage);
 
@@ -890,7 +1015,7 @@ std::vector<std::string> HashState::get_log_progress() {
         if (!incremental_ && !collector_->get_load_key().empty()) {
             current_key_ = abridge(collector_->get_load_key(), kAddressLength * 2 + 2);
         }
-        ret.insert(ret.end(), {"to", current_target_, "key", current_key_});
+        ret.insert(ret.end(), {"to", current_target_, "key", current_key_, "rate", collector_->get_load_throughput()});
     } else {
         ret.insert(ret.end(), {"from", current_source_, "key", current_key_});
     }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <thread>
+
 #include <silkworm/db/etl/collector_settings.hpp>
 #include <silkworm/db/stage.hpp>
 
@@ -25,8 +27,11 @@ class HashState final : public Stage {
   public:
     HashState(
         SyncContext* sync_context,
-        const db::etl::CollectorSettings& etl_settings)
+        const db::etl::CollectorSettings& etl_settings,
+        size_t num_workers = std::thread::hardware_concurrency())
         : Stage(sync_context, db::stages::kHashStateKey),
+          etl_settings_(etl_settings),
+          num_workers_(num_workers),
           collector_(std::make_unique<db::etl_mdbx::Collector>(etl_settings)) {}
     ~HashState() override = default;
 
@@ -40,11 +45,19 @@ class HashState final : public Stage {
     //! \struct Address -> Address Hash -> Value
     using ChangedAddresses = absl::btree_map<evmc::address, std::pair<evmc::bytes32, Bytes>>;
 
+    //! \brief Address -> Address Hash for addresses having storage changes
+    using HashedAddresses = absl::btree_map<evmc::address, evmc::bytes32>;
+
     //! \brief Transforms PlainState into HashedAccounts and HashedStorage respectively in one single read pass over
     //! PlainState \remarks To be used only if this is very first time HashState stage runs forward (i.e. forwarding
     //! from 0)
     Stage::Result hash_from_plainstate(db::RWTxn& txn);
 
+    //! \brief Hashes the PlainState records whose first key byte is in range [first_byte, end_byte) and feeds
+    //! collector with the entries for HashedAccounts and HashedStorage
+    //! \remarks Safe to run concurrently on disjoint ranges, each with its own transaction and collector
+    void hash_plainstate_range(db::ROTxn& txn, size_t first_byte, size_t end_byte, db::etl_mdbx::Collector& collector);
+
     //! \brief Transforms PlainCodeHash into HashedCodeHash in one single read pass over PlainCodeHash
     //! \remarks To be used only if this is very first time HashState stage runs forward (i.e. forwarding from 0)
     Stage::Result hash_from_plaincode(db::RWTxn& txn);
@@ -53,11 +66,23 @@ class HashState final : public Stage {
     //! \remarks Though it could be used for initial sync only is way slower and builds an index of changed accounts.
     Stage::Result hash_from_account_changeset(db::RWTxn& txn, BlockNum previous_progress, BlockNum to);
 
+    //! \brief Collects the addresses changed in blocks [from, to] along with their current PlainState value
+    void collect_account_changes(db::ROTxn& txn, BlockNum from, BlockNum to, ChangedAddresses& changed_addresses);
+
     //! \brief Detects storage changes from StorageChangeSet and hashes the changed keys
     //! \remarks Though it could be used for initial sync only is way slower and builds an index of changed storage
     //! locations.
     Stage::Result hash_from_storage_changeset(db::RWTxn& txn, BlockNum previous_progress, BlockNum to);
 
+    //! \brief Collects the storage locations changed in blocks [from, to] along with their current PlainState value
+    void collect_storage_changes(db::ROTxn& txn, BlockNum from, BlockNum to, db::StorageChanges& storage_changes,
+                                 HashedAddresses& hashed_addresses);
+
+    //! \brief Returns the number of parallel block ranges a changeset scan of [from, to] is worth splitting into
+    //! \remarks Workers read with their own transactions hence they see only the changes already committed by the
+    //! previous stages: a single range is returned when txn commits are disabled
+    size_t changeset_scan_ranges(const db::RWTxn& txn, BlockNum from, BlockNum to) const;
+
     //! \brief Detects account changes from AccountChangeSet and reverts hashed states
     Stage::Result unwind_from_account_changeset(db::RWTxn& txn, BlockNum previous_progress, BlockNum to);
 
@@ -69,7 +94,7 @@ class HashState final : public Stage {
 
     //! \brief Writes to db the changes collected from storage changeset scan either in forward or unwind mode
     Stage::Result write_changes_from_changed_storage(db::RWTxn& txn, db::StorageChanges& storage_changes,
-                                                     const absl::btree_map<evmc::address, evmc::bytes32>& hashed_addresses);
+                                                     const HashedAddresses& hashed_addresses);
 
     //! \brief Resets all fields related to log progress tracking
     void reset_log_progress();
@@ -89,6 +114,11 @@ class HashState final : public Stage {
     // Actual processing key
     std::string current_key_;
 
+    // Settings for collectors
+    db::etl::CollectorSettings etl_settings_;
+    // Number of key (or block) ranges processed in parallel
+    size_t num_workers_;
+
     // Collector (used only in !incremental_)
     std::unique_ptr<db::etl_mdbx::Collector> collector_;
 };
@@ -0,0 +1,153 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <cstring>
+
+#include <catch2/catch_test_macros.hpp>
+#include <ethash/keccak.hpp>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/db/stages.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/stagedsync/stages/stage_hashstate.hpp>
+
+namespace silkworm::stagedsync {
+
+static evmc::address make_address(uint64_t i) {
+    Bytes seed(8, '\0');
+    endian::store_big_u64(seed.data(), i);
+    evmc::address address;
+    std::memcpy(address.bytes, keccak256(seed).bytes, kAddressLength);
+    return address;
+}
+
+TEST_CASE("HashState: full regeneration from PlainState") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    db::test_util::TempChainData context;
+    db::RWTxn& txn{context.rw_txn()};
+
+    static constexpr size_t kNumAccounts{1'000};
+    static constexpr size_t kNumLocations{3};
+    const Bytes account_value{*from_hex("0x0a0b0c")};
+    const Bytes storage_value{*from_hex("0x01ff")};
+
+    {
+        db::PooledCursor plain_state{txn, db::table::kPlainState};
+        for (size_t i{0}; i < kNumAccounts; ++i) {
+            const auto address{make_address(i)};
+            plain_state.upsert(db::to_slice(address), db::to_slice(account_value));
+            if (i % 10 == 0) {
+                const Bytes storage_key{db::storage_prefix(address, /*incarnation=*/1)};
+                for (uint64_t j{0}; j < kNumLocations; ++j) {
+                    Bytes location(kHashLength, '\0');
+                    endian::store_big_u64(&location[kHashLength - 8], j + 1);
+                    plain_state.upsert(db::to_slice(storage_key), db::to_slice(location + storage_value));
+                }
+            }
+        }
+    }
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, 1);
+
+    size_t num_workers{1};
+    SECTION("sequential") {
+        txn.disable_commit();
+    }
+    SECTION("partitioned") {
+        txn.commit_and_renew();
+        num_workers = 4;
+    }
+
+    SyncContext sync_context{};
+    HashState stage{&sync_context, db::etl::CollectorSettings{context.dir().etl().path(), 256_Mebi}, num_workers};
+    REQUIRE(stage.forward(txn) == Stage::Result::kSuccess);
+
+    db::PooledCursor hashed_accounts{txn, db::table::kHashedAccounts};
+    db::PooledCursor hashed_storage{txn, db::table::kHashedStorage};
+    CHECK(hashed_accounts.size() == kNumAccounts);
+    CHECK(hashed_storage.size() == kNumAccounts / 10 * kNumLocations);
+
+    for (size_t i{0}; i < kNumAccounts; ++i) {
+        const auto address{make_address(i)};
+        const auto address_hash{keccak256(address.bytes)};
+        auto account{hashed_accounts.find(db::to_slice(address_hash.bytes), /*throw_notfound=*/false)};
+        REQUIRE(account.done);
+        CHECK(db::from_slice(account.value) == account_value);
+        if (i % 10 == 0) {
+            Bytes storage_key{address_hash.bytes, kHashLength};
+            storage_key.append(db::block_key(1));
+            REQUIRE(hashed_storage.find(db::to_slice(storage_key), /*throw_notfound=*/false).done);
+            CHECK(hashed_storage.count_multivalue() == kNumLocations);
+        }
+    }
+}
+
+TEST_CASE("HashState: incremental from AccountChangeSet with empty blocks") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    db::test_util::TempChainData context;
+    db::RWTxn& txn{context.rw_txn()};
+
+    // Enough blocks to be split into 4 ranges, none of them starting with a block having account changes
+    static constexpr BlockNum kFirstBlock{2};
+    static constexpr BlockNum kLastBlock{4'097};
+    static constexpr BlockNum kChangeStep{7};
+    const Bytes account_value{Account{.nonce = 1}.encode_for_storage()};
+
+    size_t num_changed_accounts{0};
+    {
+        db::PooledCursor plain_state{txn, db::table::kPlainState};
+        db::PooledCursor account_changes{txn, db::table::kAccountChangeSet};
+        for (BlockNum block_num{kFirstBlock}; block_num <= kLastBlock; ++block_num) {
+            if (block_num % kChangeStep != 0) {
+                continue;
+            }
+            const auto address{make_address(block_num)};
+            plain_state.upsert(db::to_slice(address), db::to_slice(account_value));
+            const Bytes change{address.bytes, kAddressLength};
+            account_changes.upsert(db::to_slice(db::block_key(block_num)), db::to_slice(change));
+            ++num_changed_accounts;
+        }
+    }
+    db::stages::write_stage_progress(txn, db::stages::kHashStateKey, kFirstBlock - 1);
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, kLastBlock);
+
+    size_t num_workers{1};
+    SECTION("sequential") {
+        txn.disable_commit();
+    }
+    SECTION("partitioned") {
+        txn.commit_and_renew();
+        num_workers = 4;
+    }
+
+    SyncContext sync_context{};
+    HashState stage{&sync_context, db::etl::CollectorSettings{context.dir().etl().path(), 256_Mebi}, num_workers};
+    REQUIRE(stage.forward(txn) == Stage::Result::kSuccess);
+
+    db::PooledCursor hashed_accounts{txn, db::table::kHashedAccounts};
+    CHECK(hashed_accounts.size() == num_changed_accounts);
+    for (BlockNum block_num{kChangeStep}; block_num <= kLastBlock; block_num += kChangeStep) {
+        const auto address_hash{keccak256(make_address(block_num).bytes)};
+        auto account{hashed_accounts.find(db::to_slice(address_hash.bytes), /*throw_notfound=*/false)};
+        REQUIRE(account.done);
+        CHECK(db::from_slice(account.value) == account_value);
+    }
+}
+
+}  // namespace silkworm::stagedsync
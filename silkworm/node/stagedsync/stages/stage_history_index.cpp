@@ -467,7 +467,8 @@ std::vector<std::string> HistoryIndex::get_log_progress() {
             case OperationType::Forward:
                 if (loading_) {
                     current_key_ = collector_ ? abridge(collector_->get_load_key(), kAddressLength) : "";
-                    ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_});
+                    ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_,
+                                           "rate", collector_ ? collector_->get_load_throughput() : ""});
                 } else {
                     ret.insert(ret.end(), {"from", current_source_, "to", "etl", "key", current_key_});
                 }
@@ -17,6 +17,7 @@
 #include "stage_interhashes.hpp"
 
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 #include <absl/container/btree_set.h>
@@ -452,6 +453,10 @@ Stage::Result InterHashes::regenerate_intermediate_hashes(db::RWTxn& txn, const
         current_key_.clear();
         trie_loader_ = std::make_unique<trie::TrieLoader>(txn, nullptr, nullptr, account_collector_.get(),
                                                           storage_collector_.get());
+        if (!txn.commit_disabled()) {
+            // Hashed state is committed: subtries can be computed by parallel readers
+            trie_loader_->set_workers(std::thread::hardware_concurrency(), etl_settings_);
+        }
         log_lck.unlock();
 
         const evmc::bytes32 computed_root{trie_loader_->calculate_root()};
@@ -509,6 +514,11 @@ Stage::Result InterHashes::increment_intermediate_hashes(db::RWTxn& txn, BlockNu
         trie::PrefixSet storage_changes{collect_storage_changes(txn, from, to, hashed_addresses)};
         // Remove unneeded RAM occupation
         hashed_addresses.clear();
+        // Parallel readers must see the storage trie nodes removed for deleted accounts
+        const bool use_workers{!txn.commit_disabled()};
+        if (use_workers) {
+            txn.commit_and_renew();
+        }
 
         log_lck.lock();
         current_source_ = "ChangeSets";
@@ -516,6 +526,9 @@ Stage::Result InterHashes::increment_intermediate_hashes(db::RWTxn& txn, BlockNu
         current_key_.clear();
         trie_loader_ = std::make_unique<trie::TrieLoader>(txn, &account_changes, &storage_changes,
                                                           account_collector_.get(), storage_collector_.get());
+        if (use_workers) {
+            trie_loader_->set_workers(std::thread::hardware_concurrency(), etl_settings_);
+        }
         log_lck.unlock();
 
         const evmc::bytes32 computed_root{trie_loader_->calculate_root()};
@@ -609,7 +622,7 @@ std::vector<std::string> InterHashes::get_log_progress() {
                 ret.insert(ret.end(), {"from", "etl", "to", current_target_});
                 if (loading_collector_) {
                     current_key_ = abridge(loading_collector_->get_load_key(), kHashLength);
-                    ret.insert(ret.end(), {"key", current_key_});
+                    ret.insert(ret.end(), {"key", current_key_, "rate", loading_collector_->get_load_throughput()});
                 }
             } else {
                 ret.insert(ret.end(), {"from", current_source_, "key", current_key_});
@@ -346,12 +346,16 @@ static Bytes nibbles_from_hex(std::string_view s) {
 }
 
 static evmc::bytes32 increment_intermediate_hashes(db::ROTxn& txn, const std::filesystem::path& etl_path,
-                                                   PrefixSet* account_changes, PrefixSet* storage_changes) {
+                                                   PrefixSet* account_changes, PrefixSet* storage_changes,
+                                                   size_t num_workers = 1) {
     Collector account_trie_node_collector{etl_path};
     Collector storage_trie_node_collector{etl_path};
 
     TrieLoader trie_loader(txn, account_changes, storage_changes, &account_trie_node_collector,
                            &storage_trie_node_collector);
+    if (num_workers > 1) {
+        trie_loader.set_workers(num_workers, db::etl::CollectorSettings{etl_path, 64_Mebi});
+    }
 
     auto computed_root{trie_loader.calculate_root()};
 
@@ -367,8 +371,9 @@ static evmc::bytes32 increment_intermediate_hashes(db::ROTxn& txn, const std::fi
     return computed_root;
 }
 
-static evmc::bytes32 regenerate_intermediate_hashes(db::ROTxn& txn, const std::filesystem::path& etl_path) {
-    return increment_intermediate_hashes(txn, etl_path, nullptr, nullptr);
+static evmc::bytes32 regenerate_intermediate_hashes(db::ROTxn& txn, const std::filesystem::path& etl_path,
+                                                    size_t num_workers = 1) {
+    return increment_intermediate_hashes(txn, etl_path, nullptr, nullptr, num_workers);
 }
 
 TEST_CASE("Account and storage trie") {
@@ -842,8 +847,20 @@ TEST_CASE("Trie Storage : incremental vs regeneration") {
     account_changes.insert(unpack_nibbles(hashed_address1.bytes));
     account_changes.insert(unpack_nibbles(hashed_address2.bytes));
 
-    const auto incremental_root{
-        increment_intermediate_hashes(txn, context.dir().etl().path(), &account_changes, &storage_changes)};
+    size_t num_workers{1};
+    SECTION("sequential") {}
+    SECTION("parallel") {
+        // Each contract has more than 1024 changed locations, so its storage root is computed in background on
+        // a parallel reader, which sees only committed data
+        num_workers = 4;
+        txn.commit_and_renew();
+        hashed_accounts.bind(txn, db::table::kHashedAccounts);
+        hashed_storage.bind(txn, db::table::kHashedStorage);
+        storage_trie.bind(txn, db::table::kTrieOfStorage);
+    }
+
+    const auto incremental_root{increment_intermediate_hashes(txn, context.dir().etl().path(), &account_changes,
+                                                              &storage_changes, num_workers)};
 
     const std::map<Bytes, Node> incremental_nodes{read_all_nodes(storage_trie)};
 
@@ -878,4 +895,63 @@ TEST_CASE("Trie Storage : incremental vs regeneration") {
     REQUIRE(fused_nodes == incremental_nodes);
 }
 
+TEST_CASE("Trie Accounts and Storage : parallel vs sequential regeneration") {
+    db::test_util::TempChainData context;
+    auto& txn{context.rw_txn()};
+
+    static constexpr size_t kNumAccounts{10'000};
+    static constexpr size_t kNumLocations{100};
+    static constexpr uint64_t kIncarnation{1};
+
+    // Plain accounts spread over all the subtries plus some contracts with storage
+    static constexpr Account one_eth{0, 1 * kEther};
+    static constexpr Account contract{
+        1,                                                                           // nonce
+        1 * kEther,                                                                  // balance
+        0x5e3c5ae99a1c6785210d0d233641562557ad763e18907cca3a8d42bd0a0b4ecb_bytes32,  // code_hash
+        kIncarnation,                                                                // incarnation
+    };
+    static const Bytes storage_value{*from_hex("42")};
+    {
+        db::PooledCursor hashed_accounts{txn, db::table::kHashedAccounts};
+        db::PooledCursor hashed_storage{txn, db::table::kHashedStorage};
+        for (size_t i{0}; i < kNumAccounts; ++i) {
+            const auto hash{keccak256(int_to_address(i))};
+            if (i % 1'000 != 0) {
+                hashed_accounts.upsert(db::to_slice(hash.bytes), db::to_slice(one_eth.encode_for_storage()));
+                continue;
+            }
+            hashed_accounts.upsert(db::to_slice(hash.bytes), db::to_slice(contract.encode_for_storage()));
+            const Bytes storage_prefix{db::storage_prefix(hash.bytes, kIncarnation)};
+            for (size_t j{0}; j < kNumLocations; ++j) {
+                const auto hashed_location{silkworm::keccak256(int_to_bytes32(j).bytes)};
+                db::upsert_storage_value(hashed_storage, storage_prefix, hashed_location.bytes, storage_value);
+            }
+        }
+    }
+
+    // Parallel readers see only committed data
+    txn.commit_and_renew();
+    const auto sequential_root{regenerate_intermediate_hashes(txn, context.dir().etl().path())};
+    db::PooledCursor account_trie{txn, db::table::kTrieOfAccounts};
+    db::PooledCursor storage_trie{txn, db::table::kTrieOfStorage};
+    const std::map<Bytes, Node> sequential_account_nodes{read_all_nodes(account_trie)};
+    const std::map<Bytes, Node> sequential_storage_nodes{read_all_nodes(storage_trie)};
+    REQUIRE(!sequential_account_nodes.empty());
+    REQUIRE(!sequential_storage_nodes.empty());
+
+    txn->clear_map(db::open_map(txn, db::table::kTrieOfAccounts));
+    txn->clear_map(db::open_map(txn, db::table::kTrieOfStorage));
+    txn.commit_and_renew();
+    const auto parallel_root{regenerate_intermediate_hashes(txn, context.dir().etl().path(), /*num_workers=*/4)};
+    account_trie.bind(txn, db::table::kTrieOfAccounts);
+    storage_trie.bind(txn, db::table::kTrieOfStorage);
+    const std::map<Bytes, Node> parallel_account_nodes{read_all_nodes(account_trie)};
+    const std::map<Bytes, Node> parallel_storage_nodes{read_all_nodes(storage_trie)};
+
+    CHECK(to_hex(parallel_root.bytes, true) == to_hex(sequential_root.bytes, true));
+    CHECK(parallel_account_nodes == sequential_account_nodes);
+    CHECK(parallel_storage_nodes == sequential_storage_nodes);
+}
+
 }  // namespace silkworm::trie
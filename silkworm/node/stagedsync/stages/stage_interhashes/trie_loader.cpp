@@ -16,6 +16,7 @@
 
 #include "trie_loader.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <silkworm/core/common/empty_hashes.hpp>
@@ -27,6 +28,19 @@
 
 namespace silkworm::trie {
 
+static const Bytes kNoPrefix{};  // Account trie nodes are keyed by nibbled key only
+
+//! \brief Returns a node collector feeding the etl collector with nodes keyed by key_prefix + nibbled key
+//! \remarks key_prefix is captured by reference
+static NodeCollector make_node_collector(db::etl::Collector& collector, const Bytes& key_prefix) {
+    return [&collector, &key_prefix](ByteView nibbled_key, const trie::Node& node) {
+        Bytes key{key_prefix};
+        key.append(nibbled_key);
+        Bytes value{node.state_mask() ? node.encode_for_storage() : Bytes{}};  // Node with no state should be deleted
+        collector.collect(key, value);
+    };
+}
+
 TrieLoader::TrieLoader(db::ROTxn& txn, PrefixSet* account_changes, PrefixSet* storage_changes,
                        db::etl::Collector* account_trie_node_collector, db::etl::Collector* storage_trie_node_collector)
     : txn_{txn},
@@ -43,6 +57,15 @@ TrieLoader::TrieLoader(db::ROTxn& txn, PrefixSet* account_changes, PrefixSet* st
     }
 }
 
+void TrieLoader::set_workers(size_t num_workers, const db::etl::CollectorSettings& etl_settings) {
+    num_workers_ = std::max<size_t>(num_workers, 1);
+    etl_settings_ = etl_settings;
+    workers_.reset();
+    if (num_workers_ > 1) {
+        workers_ = std::make_unique<ThreadPool>(static_cast<unsigned>(num_workers_));
+    }
+}
+
 evmc::bytes32 TrieLoader::calculate_root() {
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
@@ -61,22 +84,24 @@ evmc::bytes32 TrieLoader::calculate_root() {
         }
     }
 
+    if (workers_) {
+        if (!account_changes_) {
+            if (const auto root{calculate_root_by_subtries()}; root.has_value()) {
+                return *root;
+            }
+        } else {
+            schedule_storage_roots();
+        }
+    }
+
     Bytes storage_prefix_buffer{};
     storage_prefix_buffer.reserve(db::kHashedStoragePrefixLength);
 
     HashBuilder account_hash_builder;
-    account_hash_builder.node_collector = [&](ByteView nibbled_key, const trie::Node& node) {
-        Bytes value{node.state_mask() ? node.encode_for_storage() : Bytes{}};  // Node with no state should be deleted
-        account_trie_node_collector_->collect({Bytes{nibbled_key}, value});
-    };
+    account_hash_builder.node_collector = make_node_collector(*account_trie_node_collector_, kNoPrefix);
 
     HashBuilder storage_hash_builder;
-    storage_hash_builder.node_collector = [&](ByteView nibbled_key, const trie::Node& node) {
-        Bytes key{storage_prefix_buffer};
-        key.append(nibbled_key);
-        Bytes value{node.state_mask() ? node.encode_for_storage() : Bytes{}};  // Node with no state should be deleted
-        storage_trie_node_collector_->collect({key, value});
-    };
+    storage_hash_builder.node_collector = make_node_collector(*storage_trie_node_collector_, storage_prefix_buffer);
 
     // Open both tries (Account and Storage) to avoid reallocation of Storage on every contract
     TrieCursor trie_account_cursor(*trie_accounts, account_changes_, account_trie_node_collector_);
@@ -114,8 +139,19 @@ evmc::bytes32 TrieLoader::calculate_root() {
                 if (account->incarnation) {
                     // Calc storage root
                     storage_prefix_buffer.assign(db::storage_prefix(hashed_account_data_key_view, account->incarnation));
-                    storage_root = calculate_storage_root(trie_storage_cursor, storage_hash_builder, *hashed_storage,
-                                                          storage_prefix_buffer);
+                    if (auto it{scheduled_storage_roots_.find(storage_prefix_buffer)};
+                        it != scheduled_storage_roots_.end()) {
+                        // Computed in background: take over its nodes as if computed here
+                        auto scheduled{it->second.get()};
+                        scheduled.nodes->load([this](const db::etl::Entry& entry) {
+                            storage_trie_node_collector_->collect(entry);
+                        });
+                        storage_root = scheduled.root;
+                        scheduled_storage_roots_.erase(it);
+                    } else {
+                        storage_root = calculate_storage_root(trie_storage_cursor, storage_hash_builder,
+                                                              *hashed_storage, storage_prefix_buffer);
+                    }
                 }
 
                 account_hash_builder.add_leaf(hashed_account_data_key_nibbled, account->rlp(storage_root));
@@ -141,15 +177,146 @@ evmc::bytes32 TrieLoader::calculate_root() {
 
     auto root_hash{account_hash_builder.root_hash()};
     account_hash_builder.reset();
+    scheduled_storage_roots_.clear();  // Not requested by accounts traversal (e.g. stale incarnations)
     return root_hash;
 }
 
+std::optional<evmc::bytes32> TrieLoader::calculate_root_by_subtries() {
+    // Stitching requires a branch node as root, i.e. at least two non-empty subtries
+    std::vector<uint8_t> nibbles;
+    auto hashed_accounts = txn_.ro_cursor(db::table::kHashedAccounts);
+    for (uint8_t nibble{0}; nibble < 0x10; ++nibble) {
+        const Bytes first_key(1, static_cast<uint8_t>(nibble << 4));
+        const auto data{hashed_accounts->lower_bound(db::to_slice(first_key), /*throw_notfound=*/false)};
+        if (data && db::from_slice(data.key)[0] >> 4 == nibble) {
+            nibbles.push_back(nibble);
+        }
+    }
+    if (nibbles.size() < 2) {
+        return std::nullopt;
+    }
+
+    // Each subtrie collects its own account and storage nodes within a share of the overall collectors' memory
+    db::etl::CollectorSettings subtrie_etl_settings{etl_settings_};
+    subtrie_etl_settings.buffer_size = std::max<size_t>(etl_settings_.buffer_size / (2 * nibbles.size()), 1_Mebi);
+
+    const mdbx::env env{txn_.db()};
+    std::vector<std::unique_ptr<Subtrie>> subtries;
+    std::vector<std::future<void>> results;
+    for (const auto nibble : nibbles) {
+        Subtrie& subtrie{*subtries.emplace_back(std::make_unique<Subtrie>())};
+        subtrie.account_nodes = std::make_unique<db::etl::Collector>(subtrie_etl_settings);
+        subtrie.storage_nodes = std::make_unique<db::etl::Collector>(subtrie_etl_settings);
+        results.push_back(workers_->submit([this, env, nibble, &subtrie]() { calculate_subtrie(env, nibble, subtrie); }));
+    }
+    for (auto& result : results) {
+        result.wait();
+    }
+    for (auto& result : results) {
+        result.get();  // Rethrows the first error occurred in workers
+    }
+
+    HashBuilder account_hash_builder;
+    account_hash_builder.node_collector = make_node_collector(*account_trie_node_collector_, kNoPrefix);
+    for (auto& subtrie : subtries) {
+        account_hash_builder.add_subtrie(subtrie->hash_builder);
+        account_trie_node_collector_->merge(*subtrie->account_nodes);
+        storage_trie_node_collector_->merge(*subtrie->storage_nodes);
+    }
+
+    auto root_hash{account_hash_builder.root_hash()};
+    account_hash_builder.reset();
+    return root_hash;
+}
+
+void TrieLoader::calculate_subtrie(mdbx::env env, uint8_t nibble, Subtrie& subtrie) {
+    using namespace std::chrono_literals;
+    auto log_time{std::chrono::steady_clock::now()};
+
+    db::ROTxnManaged txn{env};
+    auto hashed_accounts = txn.ro_cursor(db::table::kHashedAccounts);
+    auto hashed_storage = txn.ro_cursor_dup_sort(db::table::kHashedStorage);
+    auto trie_storage = txn.ro_cursor(db::table::kTrieOfStorage);
+
+    Bytes storage_prefix_buffer{};
+    storage_prefix_buffer.reserve(db::kHashedStoragePrefixLength);
+
+    HashBuilder& account_hash_builder{subtrie.hash_builder};
+    account_hash_builder.node_collector = make_node_collector(*subtrie.account_nodes, kNoPrefix);
+
+    HashBuilder storage_hash_builder;
+    storage_hash_builder.node_collector = make_node_collector(*subtrie.storage_nodes, storage_prefix_buffer);
+    TrieCursor trie_storage_cursor(*trie_storage, nullptr, subtrie.storage_nodes.get());
+
+    const Bytes first_key(1, static_cast<uint8_t>(nibble << 4));
+    auto hashed_account_data{hashed_accounts->lower_bound(db::to_slice(first_key), /*throw_notfound=*/false)};
+    while (hashed_account_data) {
+        const auto hashed_account_data_key_view{db::from_slice(hashed_account_data.key)};
+        if (hashed_account_data_key_view[0] >> 4 != nibble) {
+            break;
+        }
+
+        if (const auto now{std::chrono::steady_clock::now()}; log_time <= now) {
+            SignalHandler::throw_if_signalled();
+            std::unique_lock log_lck(log_mtx_);
+            log_key_ = to_hex(hashed_account_data_key_view, true);
+            log_time = now + 2s;
+        }
+
+        const auto account{Account::from_encoded_storage(db::from_slice(hashed_account_data.value))};
+        success_or_throw(account);
+
+        evmc::bytes32 storage_root{kEmptyRoot};
+        if (account->incarnation) {
+            storage_prefix_buffer.assign(db::storage_prefix(hashed_account_data_key_view, account->incarnation));
+            storage_root = calculate_storage_root(trie_storage_cursor, storage_hash_builder, *hashed_storage,
+                                                  storage_prefix_buffer);
+        }
+
+        account_hash_builder.add_leaf(unpack_nibbles(hashed_account_data_key_view), account->rlp(storage_root));
+        hashed_account_data = hashed_accounts->to_next(/*throw_notfound=*/false);
+    }
+
+    account_hash_builder.close_subtrie();
+}
+
+void TrieLoader::schedule_storage_roots() {
+    // Below this number of changed locations the storage root is quickly computed in place
+    static constexpr size_t kMinChangesInBackground{1'024};
+
+    const mdbx::env env{txn_.db()};
+    for (auto& [storage_prefix, changes_count] : storage_changes_->count_by_prefix(db::kHashedStoragePrefixLength)) {
+        if (changes_count < kMinChangesInBackground) {
+            continue;
+        }
+        // Each task owns the changes of its contract as PrefixSet is not safe for concurrent use
+        auto changes{std::make_shared<PrefixSet>(storage_changes_->subset(storage_prefix))};
+        auto result{workers_->submit([this, env, prefix = storage_prefix, changes]() -> StorageRoot {
+            db::ROTxnManaged txn{mdbx::env{env}};
+            auto hashed_storage = txn.ro_cursor_dup_sort(db::table::kHashedStorage);
+            auto trie_storage = txn.ro_cursor(db::table::kTrieOfStorage);
+
+            db::etl::CollectorSettings nodes_etl_settings{etl_settings_};
+            nodes_etl_settings.buffer_size = std::max<size_t>(etl_settings_.buffer_size / (2 * num_workers_), 1_Mebi);
+            StorageRoot storage_root{kEmptyRoot, std::make_unique<db::etl::Collector>(nodes_etl_settings)};
+
+            HashBuilder storage_hash_builder;
+            storage_hash_builder.node_collector = make_node_collector(*storage_root.nodes, prefix);
+            TrieCursor trie_storage_cursor(*trie_storage, changes.get(), storage_root.nodes.get());
+            storage_root.root = calculate_storage_root(trie_storage_cursor, storage_hash_builder, *hashed_storage,
+                                                       prefix);
+            return storage_root;
+        })};
+        scheduled_storage_roots_.emplace(storage_prefix, std::move(result));
+    }
+}
+
 evmc::bytes32 TrieLoader::calculate_storage_root(TrieCursor& trie_storage_cursor, HashBuilder& storage_hash_builder,
                                                  db::ROCursorDupSort& hashed_storage, const Bytes& db_storage_prefix) {
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
 
-    static Bytes rlp_buffer{};
+    thread_local Bytes rlp_buffer{};  // Storage roots may be computed concurrently
 
     const auto db_storage_prefix_slice{db::to_slice(db_storage_prefix)};
     auto trie_storage_data{trie_storage_cursor.to_prefix(db_storage_prefix)};
@@ -16,10 +16,17 @@
 
 #pragma once
 
+#include <future>
+#include <map>
+#include <memory>
+#include <optional>
+
 #include <silkworm/core/trie/hash_builder.hpp>
 #include <silkworm/core/trie/prefix_set.hpp>
 #include <silkworm/db/etl/collector.hpp>
+#include <silkworm/db/etl/collector_settings.hpp>
 #include <silkworm/db/mdbx/mdbx.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/stagedsync/stages/stage_interhashes/trie_cursor.hpp>
 
 namespace silkworm::trie {
@@ -29,6 +36,14 @@ class TrieLoader {
     explicit TrieLoader(db::ROTxn& txn, PrefixSet* account_changes, PrefixSet* storage_changes,
                         db::etl::Collector* account_trie_node_collector, db::etl::Collector* storage_trie_node_collector);
 
+    //! \brief Enables the computation of subtries on parallel read-only transactions
+    //! \details On full regeneration the account trie is split by the first nibble of hashed addresses and the 16
+    //! subtries are built concurrently, then stitched into the root node. On incremental updates the storage tries of
+    //! contracts with many changed locations are computed in background while the account trie is traversed
+    //! \remarks Parallel readers only see committed data: txn must not hold uncommitted changes to hashed state nor to
+    //! tries. Nodes collected by workers are flushed (if needed) in etl_settings.work_path
+    void set_workers(size_t num_workers, const db::etl::CollectorSettings& etl_settings);
+
     //! \brief (re)calculates root hash on behalf of collected hashed changes and existing data in TrieOfAccount and
     //! TrieOfStorage buckets
     //! \return The computed hash
@@ -42,15 +57,45 @@ class TrieLoader {
     }
 
   private:
+    //! \brief A storage root computed in background along with the trie nodes collected for it
+    struct StorageRoot {
+        evmc::bytes32 root;
+        std::unique_ptr<db::etl::Collector> nodes;
+    };
+
+    //! \brief The builder and the nodes collected for the accounts subtrie rooted at one nibble
+    struct Subtrie {
+        HashBuilder hash_builder;
+        std::unique_ptr<db::etl::Collector> account_nodes;
+        std::unique_ptr<db::etl::Collector> storage_nodes;
+    };
+
+    //! \brief Computes the root of a fully regenerated trie building the subtries of each first nibble in parallel
+    //! \return The computed hash or nullopt if hashed accounts do not span at least two subtries
+    [[nodiscard]] std::optional<evmc::bytes32> calculate_root_by_subtries();
+
+    //! \brief Builds (from scratch) the accounts subtrie of hashed addresses beginning with provided nibble
+    void calculate_subtrie(mdbx::env env, uint8_t nibble, Subtrie& subtrie);
+
+    //! \brief Schedules on workers the computation of storage roots for contracts with many changed locations
+    void schedule_storage_roots();
+
     db::ROTxn& txn_;
     PrefixSet* account_changes_;
     PrefixSet* storage_changes_;
     db::etl::Collector* account_trie_node_collector_;
     db::etl::Collector* storage_trie_node_collector_;
 
+    size_t num_workers_{1};
+    db::etl::CollectorSettings etl_settings_{};
+    std::map<Bytes, std::future<StorageRoot>> scheduled_storage_roots_;  // Storage prefix -> storage root
+
     std::string log_key_{};         // To export logging key
     mutable std::mutex log_mtx_{};  // Guards async logging
 
+    // Declared after all the members used by its tasks, so that it is destroyed (i.e. joined) before them
+    std::unique_ptr<ThreadPool> workers_;
+
     //! \brief (re)calculates storage root hash on behalf of collected hashed changes and existing data in
     //! TrieOfStorage bucket
     //! \return The computed hash
@@ -22,37 +22,47 @@
 #include <magic_enum.hpp>
 
 #include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/log_summary.hpp>
 
 namespace silkworm::stagedsync {
 
 namespace {
     //! LogBitmapBuilder is a CBOR consumer which builds address and topic roaring bitmaps from the CBOR
-    //! representation of a sequence of Logs
+    //! representation of a sequence of Logs, optionally forwarding the decoded data to another consumer
     class LogBitmapBuilder : public LogCborConsumer {
       public:
         using AddressHandler = std::function<void(std::span<const uint8_t, kAddressLength>)>;
         using TopicHandler = std::function<void(HashAsSpan)>;
 
-        LogBitmapBuilder(AddressHandler address_callback, TopicHandler topic_callback)
-            : address_callback_{std::move(address_callback)}, topic_callback_{std::move(topic_callback)} {}
+        LogBitmapBuilder(AddressHandler address_callback, TopicHandler topic_callback, LogCborConsumer* next = nullptr)
+            : address_callback_{std::move(address_callback)}, topic_callback_{std::move(topic_callback)}, next_{next} {}
 
-        void on_num_logs(std::size_t /*num_logs*/) override {}
+        void on_num_logs(std::size_t num_logs) override {
+            if (next_) next_->on_num_logs(num_logs);
+        }
 
         void on_address(std::span<const uint8_t, kAddressLength> address) override {
             address_callback_(address);
+            if (next_) next_->on_address(address);
         }
 
-        void on_num_topics(std::size_t /*num_topics*/) override {}
+        void on_num_topics(std::size_t num_topics) override {
+            if (next_) next_->on_num_topics(num_topics);
+        }
 
         void on_topic(HashAsSpan topic) override {
             topic_callback_(topic);
+            if (next_) next_->on_topic(topic);
         }
 
-        void on_data(std::span<const uint8_t> /*data*/) override {}
+        void on_data(std::span<const uint8_t> data) override {
+            if (next_) next_->on_data(data);
+        }
 
       private:
         AddressHandler address_callback_;
         TopicHandler topic_callback_;
+        LogCborConsumer* next_;
     };
 }  // namespace
 
@@ -223,6 +233,7 @@ Stage::Result LogIndex::prune(db::RWTxn& txn) {
         if (!prune_progress || prune_progress < forward_progress) {
             prune_impl(txn, prune_threshold, db::table::kLogAddressIndex);
             prune_impl(txn, prune_threshold, db::table::kLogTopicIndex);
+            prune_log_summaries(txn, prune_threshold);
         }
 
         reset_log_progress();
@@ -324,6 +335,13 @@ void LogIndex::unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to) {
 
     log_lck.lock();
     index_loader_.reset();
+    current_target_ = db::table::kLogSummary.name;
+    log_lck.unlock();
+
+    auto summary_target = txn.rw_cursor(db::table::kLogSummary);
+    db::cursor_erase(*summary_target, db::block_key(to + 1), db::CursorMoveDirection::Forward);
+
+    log_lck.lock();
     current_source_.clear();
     current_target_.clear();
     current_key_.clear();
@@ -346,7 +364,20 @@ void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
     uint16_t topics_flush_count{0};
     uint16_t addresses_flush_count{0};
 
-    // The CBOR consumer we use to collect decoded data into bitmaps
+    // Block log summaries are written straight to their table as blocks are traversed in key order
+    auto summary_target = txn.rw_cursor(db::table::kLogSummary);
+    Bytes block_summary;
+    BlockNum summary_block_number{0};
+    uint32_t block_log_count{0};
+    LogSummaryBuilder summary_builder{block_summary};
+    const auto flush_block_summary = [&]() {
+        if (!block_summary.empty()) {
+            summary_target->upsert(db::to_slice(db::block_key(summary_block_number)), db::to_slice(block_summary));
+            block_summary.clear();
+        }
+    };
+
+    // The CBOR consumer we use to collect decoded data into bitmaps and summaries
     LogBitmapBuilder bitmap_builder{
         [&](std::span<const uint8_t, kAddressLength> address_data) {
             Bytes key(address_data.data(), address_data.size());
@@ -367,7 +398,8 @@ void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
             }
             it->second.add(gsl::narrow<uint32_t>(reached_block_number));
             topics_bitmaps_size += sizeof(uint32_t);
-        }};
+        },
+        &summary_builder};
 
     auto start_key{db::block_key(from + 1)};
     auto source = txn.ro_cursor(source_config);
@@ -384,8 +416,17 @@ void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
             log_time = now + 5s;
         }
 
-        // Decode CBOR value content and distribute it to the 2 bitmaps
+        if (reached_block_number != summary_block_number) {
+            flush_block_summary();
+            summary_block_number = reached_block_number;
+            block_log_count = 0;
+        }
+        const auto tx_index{endian::load_big_u32(static_cast<uint8_t*>(source_data.key.data()) + sizeof(BlockNum))};
+        summary_builder.reset(tx_index, block_log_count);
+
+        // Decode CBOR value content and distribute it to the 2 bitmaps and the block summary
         cbor_decode({static_cast<uint8_t*>(source_data.value.data()), source_data.value.length()}, bitmap_builder);
+        block_log_count += gsl::narrow<uint32_t>(summary_builder.num_entries());
 
         // Flush bitmaps batch by batch
         if (topics_bitmaps_size > batch_size_) {
@@ -405,7 +446,8 @@ void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
         source_data = source->to_next(/*throw_notfound=*/false);
     }
 
-    // Flush remaining portion of bitmaps (if any)
+    // Flush remaining portion of bitmaps and summaries (if any)
+    flush_block_summary();
     db::bitmap::IndexLoader::flush_bitmaps_to_etl(topics_bitmaps, topics_collector_.get(), topics_flush_count);
     db::bitmap::IndexLoader::flush_bitmaps_to_etl(addresses_bitmaps, addresses_collector_.get(), addresses_flush_count);
 }
@@ -475,6 +517,25 @@ void LogIndex::prune_impl(db::RWTxn& txn, BlockNum threshold, const db::MapConfi
     log_lck.unlock();
 }
 
+void LogIndex::prune_log_summaries(db::RWTxn& txn, BlockNum threshold) {
+    std::unique_lock log_lck(sl_mutex_);
+    operation_ = OperationType::Prune;
+    loading_ = false;
+    current_source_ = db::table::kLogSummary.name;
+    current_target_ = current_source_;
+    current_key_ = std::to_string(threshold);
+    log_lck.unlock();
+
+    auto summary_target = txn.rw_cursor(db::table::kLogSummary);
+    db::cursor_erase(*summary_target, db::block_key(threshold), db::CursorMoveDirection::Reverse);
+
+    log_lck.lock();
+    current_source_.clear();
+    current_target_.clear();
+    current_key_.clear();
+    log_lck.unlock();
+}
+
 std::vector<std::string> LogIndex::get_log_progress() {
     std::vector<std::string> ret{"op", std::string(magic_enum::enum_name<OperationType>(operation_))};
     std::unique_lock log_lck(sl_mutex_);
@@ -484,14 +545,17 @@ std::vector<std::string> LogIndex::get_log_progress() {
         switch (operation_) {
             case OperationType::Forward:
                 if (loading_) {
+                    std::string rate;
                     if (current_target_ == db::table::kLogAddressIndex.name) {
                         current_key_ = abridge(addresses_collector_->get_load_key(), kAddressLength);
+                        rate = addresses_collector_->get_load_throughput();
                     } else if (current_target_ == db::table::kLogTopicIndex.name) {
                         current_key_ = abridge(topics_collector_->get_load_key(), kAddressLength);
+                        rate = topics_collector_->get_load_throughput();
                     } else {
                         current_key_.clear();
                     }
-                    ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_});
+                    ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_, "rate", rate});
                 } else {
                     ret.insert(ret.end(), {"from", current_source_, "to", "etl", "key", current_key_});
                 }
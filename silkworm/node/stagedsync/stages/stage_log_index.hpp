@@ -60,8 +60,9 @@ class LogIndex : public Stage {
     void forward_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
     void unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
     void prune_impl(db::RWTxn& txn, BlockNum threshold, const db::MapConfig& target);
+    void prune_log_summaries(db::RWTxn& txn, BlockNum threshold);
 
-    //! \brief Collects bitmaps of block numbers for each log entry
+    //! \brief Collects bitmaps of block numbers for each log entry and writes the log summary of each block
     void collect_bitmaps_from_logs(db::RWTxn& txn, const db::MapConfig& source_config, BlockNum from, BlockNum to);
 
     //! \brief Collects unique keys for log entries within provided boundaries
@@ -0,0 +1,135 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/log_summary.hpp>
+#include <silkworm/db/stages.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/db/util.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/stagedsync/stages/stage_log_index.hpp>
+
+using namespace evmc::literals;
+
+namespace silkworm {
+
+static const auto kAddress1{0x7a250d5630b4cf539739df2c5dacb4c659f2488d_address};
+static const auto kAddress2{0xc02aaa39b223fe8d0a0e5c4f27ead9083c756cc2_address};
+static const auto kTopic{0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32};
+
+stagedsync::LogIndex make_stage_log_index(
+    stagedsync::SyncContext* sync_context,
+    const db::test_util::TempChainData& chain_data) {
+    return stagedsync::LogIndex{
+        sync_context,
+        /*batch_size=*/512_Mebi,
+        db::etl::CollectorSettings{
+            .work_path = chain_data.dir().etl().path(),
+            .buffer_size = 256_Mebi},
+        chain_data.prune_mode().history(),
+    };
+}
+
+static std::map<BlockNum, std::vector<LogSummaryEntry>> read_log_summaries(db::ROTxn& txn) {
+    std::map<BlockNum, std::vector<LogSummaryEntry>> summaries;
+    auto cursor = txn.ro_cursor(db::table::kLogSummary);
+    db::cursor_for_each(*cursor, [&](ByteView key, ByteView value) {
+        summaries.emplace(endian::load_big_u64(key.data()), decode_log_summary(value));
+    });
+    return summaries;
+}
+
+TEST_CASE("Stage Log Index") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    db::test_util::TempChainData context;
+    db::RWTxn& txn{context.rw_txn()};
+    txn.disable_commit();
+
+    // Block 1 holds two transactions with logs, blocks 2, 3 and 4 one transaction each
+    const std::vector<std::tuple<BlockNum, uint32_t, std::vector<Log>>> transaction_logs{
+        {1, 0, {Log{kAddress1, {kTopic}, {}}, Log{kAddress2, {}, {}}}},
+        {1, 1, {Log{kAddress2, {kTopic}, {}}}},
+        {2, 0, {Log{kAddress1, {kTopic}, {}}}},
+        {3, 2, {Log{kAddress2, {kTopic}, {}}}},
+        {4, 0, {Log{kAddress1, {}, {}}}},
+    };
+    auto logs_cursor = txn.rw_cursor(db::table::kLogs);
+    for (const auto& [block_number, tx_index, logs] : transaction_logs) {
+        logs_cursor->upsert(db::to_slice(db::log_key(block_number, tx_index)), db::to_slice(cbor_encode(logs)));
+    }
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, 4);
+
+    SECTION("Forward and unwind") {
+        stagedsync::SyncContext sync_context{};
+        stagedsync::LogIndex stage_log_index = make_stage_log_index(&sync_context, context);
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+
+        auto summaries = read_log_summaries(txn);
+        REQUIRE(summaries.size() == 4);
+        const auto& block1_summary = summaries[1];
+        REQUIRE(block1_summary.size() == 3);
+        CHECK(block1_summary[0] == LogSummaryEntry{.tx_index = 0, .log_index = 0, .address_fragment = 0x7a250d56, .topic0_fragment = 0xddf252ad});
+        CHECK(block1_summary[1] == LogSummaryEntry{.tx_index = 0, .log_index = 1, .address_fragment = 0xc02aaa39, .topic0_fragment = 0});
+        CHECK(block1_summary[2] == LogSummaryEntry{.tx_index = 1, .log_index = 2, .address_fragment = 0xc02aaa39, .topic0_fragment = 0xddf252ad});
+        REQUIRE(summaries[3].size() == 1);
+        CHECK(summaries[3][0] == LogSummaryEntry{.tx_index = 2, .log_index = 0, .address_fragment = 0xc02aaa39, .topic0_fragment = 0xddf252ad});
+
+        // Unwind erases the summaries of the blocks after the unwind point
+        sync_context.unwind_point.emplace(2);
+        REQUIRE(stage_log_index.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        summaries = read_log_summaries(txn);
+        CHECK(summaries.size() == 2);
+        CHECK(summaries.contains(1));
+        CHECK(summaries.contains(2));
+    }
+
+    SECTION("Prune") {
+        stagedsync::SyncContext sync_context{};
+        stagedsync::LogIndex stage_log_index = make_stage_log_index(&sync_context, context);
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(read_log_summaries(txn).size() == 4);
+
+        // Alter node settings pruning
+        db::PruneDistance older_history, older_receipts, older_senders, older_tx_index, older_call_traces;
+        db::PruneThreshold before_history, before_receipts, before_senders, before_tx_index, before_call_traces;
+        before_history.emplace(3);
+        context.set_prune_mode(
+            db::parse_prune_mode("h", older_history, older_receipts, older_senders, older_tx_index, older_call_traces,
+                                 before_history, before_receipts, before_senders, before_tx_index, before_call_traces));
+        REQUIRE(context.prune_mode().history().enabled());
+        REQUIRE(context.prune_mode().history().value_from_head(4) == 2);
+
+        // Prune erases the summaries of the blocks below the threshold
+        stagedsync::LogIndex stage_log_index_prune = make_stage_log_index(&sync_context, context);
+        REQUIRE(stage_log_index_prune.prune(txn) == stagedsync::Stage::Result::kSuccess);
+        const auto summaries = read_log_summaries(txn);
+        CHECK(summaries.size() == 3);
+        CHECK_FALSE(summaries.contains(1));
+        CHECK(summaries.contains(2));
+    }
+}
+
+}  // namespace silkworm
@@ -33,6 +33,23 @@ namespace silkworm::stagedsync {
 
 using namespace std::chrono_literals;
 
+void recover_senders(AddressRecoveryBatch& batch, const secp256k1_context* context) {
+    Bytes rlp;
+    uint8_t signature[2 * kHashLength];
+    for (auto& package : batch) {
+        const Transaction& transaction{package.transaction};
+        rlp.clear();
+        transaction.encode_for_signing(rlp);
+        const auto tx_hash{keccak256(rlp)};
+        intx::be::unsafe::store(signature, transaction.r);
+        intx::be::unsafe::store(signature + kHashLength, transaction.s);
+        if (!silkworm_recover_address(package.tx_from.bytes, tx_hash.bytes, signature, transaction.odd_y_parity,
+                                      context)) {
+            throw std::runtime_error("Unable to recover from address in block " + std::to_string(package.block_num));
+        }
+    }
+}
+
 Senders::Senders(
     SyncContext* sync_context,
     const ChainConfig& chain_config,
@@ -292,14 +309,21 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
 
         BlockNum start_block_num{previous_progress + 1u};
 
+        // Empty blocks are counted also by tasks running in worker pool, hence must outlive it
+        std::atomic<uint64_t> total_empty_blocks{0};
+
         // Create the pool of worker threads crunching the address recovery tasks
         ThreadPool worker_pool;
 
-        // Load block transactions from db and recover tx senders in batches
-        uint64_t total_collected_senders{0};
-        uint64_t total_empty_blocks{0};
+        // Blocks frozen into snapshots are read and recovered entirely by workers, without going through the db
+        const BlockNum frozen_block_num{std::min(db::DataModel::highest_frozen_block_number(), target_block_num)};
+        for (; start_block_num <= frozen_block_num; start_block_num += kFrozenBlocksPerTask) {
+            const BlockNum last_block_num{std::min(start_block_num + kFrozenBlocksPerTask - 1, frozen_block_num)};
+            recover_frozen_blocks(worker_pool, context, start_block_num, last_block_num, total_empty_blocks);
+        }
+        start_block_num = std::max(start_block_num, frozen_block_num + 1);
 
-        // Start from first block and read all in sequence
+        // Load block transactions from db and recover tx senders in batches
         for (auto current_block_num = start_block_num; current_block_num <= target_block_num; ++current_block_num) {
             auto current_hash = db::read_canonical_hash(txn, current_block_num);
             if (!current_hash) throw StageError(Stage::Result::kBadChainSequence,
@@ -320,8 +344,7 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
                 continue;
             }
 
-            total_collected_senders += block_body.transactions.size();
-            success_or_throw(add_to_batch(current_block_num, *current_hash, block_body.transactions));
+            success_or_throw(add_to_batch(*batch_, current_block_num, *current_hash, std::move(block_body.transactions)));
 
             // Process batch in parallel if max size has been reached
             if (batch_->size() >= max_batch_size_) {
@@ -337,7 +360,7 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
         }
 
         // Wait for all senders to be recovered and collected in ETL
-        while (collected_senders_ != total_collected_senders) {
+        while (!results_.empty()) {
             collect_senders();
             std::this_thread::sleep_for(1ms);
         }
@@ -373,7 +396,8 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
     return ret;
 }
 
-Stage::Result Senders::add_to_batch(BlockNum block_num, const Hash& block_hash, const std::vector<Transaction>& transactions) {
+Stage::Result Senders::add_to_batch(AddressRecoveryBatch& batch, BlockNum block_num, const Hash& block_hash,
+                                    std::vector<Transaction>&& transactions) {
     if (is_stopping()) {
         return Stage::Result::kAborted;
     }
@@ -384,7 +408,7 @@ Stage::Result Senders::add_to_batch(BlockNum block_num, const Hash& block_hash,
     const bool has_spurious_dragon{rev >= EVMC_SPURIOUS_DRAGON};
 
     uint32_t tx_id{0};
-    for (const auto& transaction : transactions) {
+    for (auto& transaction : transactions) {
         if (!protocol::transaction_type_is_supported(transaction.type, rev)) {
             log::Error(log_prefix_) << "Transaction type " << magic_enum::enum_name<TransactionType>(transaction.type)
                                     << " for transaction #" << tx_id << " in block #" << block_num << " before it's supported";
@@ -407,13 +431,7 @@ Stage::Result Senders::add_to_batch(BlockNum block_num, const Hash& block_hash,
             }
         }
 
-        Bytes rlp{};
-        transaction.encode_for_signing(rlp);
-
-        batch_->push_back(AddressRecovery{block_num, block_hash, transaction.odd_y_parity});
-        intx::be::unsafe::store(batch_->back().tx_signature, transaction.r);
-        intx::be::unsafe::store(batch_->back().tx_signature + kHashLength, transaction.s);
-        batch_->back().rlp = std::move(rlp);
+        batch.push_back(AddressRecovery{block_num, block_hash, std::move(transaction)});
 
         ++tx_id;
     }
@@ -422,6 +440,14 @@ Stage::Result Senders::add_to_batch(BlockNum block_num, const Hash& block_hash,
     return is_stopping() ? Stage::Result::kAborted : Stage::Result::kSuccess;
 }
 
+void Senders::wait_for_worker_pool(ThreadPool& worker_pool) {
+    // Wait until total unfinished tasks in worker pool falls below 2 * num workers
+    static const auto kMaxUnfinishedTasks{2 * worker_pool.get_thread_count()};
+    while (worker_pool.get_tasks_total() >= kMaxUnfinishedTasks) {
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
 void Senders::recover_batch(ThreadPool& worker_pool, const secp256k1_context* context) {
     // Launch parallel senders recovery
     log::Trace(log_prefix_, {"op", "recover_batch", "first", std::to_string(batch_->cbegin()->block_num)});
@@ -429,24 +455,14 @@ void Senders::recover_batch(ThreadPool& worker_pool, const secp256k1_context* co
     StopWatch sw;
     const auto start = sw.start();
 
-    // Wait until total unfinished tasks in worker pool falls below 2 * num workers
-    static const auto kMaxUnfinishedTasks{2 * worker_pool.get_thread_count()};
-    while (worker_pool.get_tasks_total() >= kMaxUnfinishedTasks) {
-        std::this_thread::sleep_for(1ms);
-    }
+    wait_for_worker_pool(worker_pool);
 
     // Swap the waiting batch w/ an empty one and submit a new recovery task to the worker pool
     std::shared_ptr<std::vector<AddressRecovery>> ready_batch{std::make_shared<std::vector<AddressRecovery>>()};
     ready_batch->reserve(max_batch_size_);
     ready_batch.swap(batch_);
     auto batch_result = worker_pool.submit([=]() {
-        std::for_each(ready_batch->begin(), ready_batch->end(), [&](auto& package) {
-            const auto tx_hash{keccak256(package.rlp)};
-            const bool ok = silkworm_recover_address(package.tx_from.bytes, tx_hash.bytes, package.tx_signature, package.odd_y_parity, context);
-            if (!ok) {
-                throw std::runtime_error("Unable to recover from address in block " + std::to_string(package.block_num));
-            }
-        });
+        recover_senders(*ready_batch, context);
         return ready_batch;
     });
     results_.emplace_back(std::move(batch_result));
@@ -460,6 +476,36 @@ void Senders::recover_batch(ThreadPool& worker_pool, const secp256k1_context* co
     if (is_stopping()) throw StageError(Stage::Result::kAborted);
 }
 
+void Senders::recover_frozen_blocks(ThreadPool& worker_pool, const secp256k1_context* context, BlockNum first,
+                                    BlockNum last, std::atomic<uint64_t>& total_empty_blocks) {
+    wait_for_worker_pool(worker_pool);
+
+    auto batch_result = worker_pool.submit([=, this, &total_empty_blocks]() {
+        auto batch{std::make_shared<AddressRecoveryBatch>()};
+        for (BlockNum block_num{first}; block_num <= last; ++block_num) {
+            Block block;
+            if (!db::DataModel::read_block_from_snapshot(block_num, block)) {
+                throw StageError(Stage::Result::kBadChainSequence,
+                                 "Frozen block at height " + std::to_string(block_num) + " not found");
+            }
+            if (block.transactions.empty()) {
+                ++total_empty_blocks;
+                continue;
+            }
+            success_or_throw(add_to_batch(*batch, block_num, block.header.hash(), std::move(block.transactions)));
+        }
+        increment_total_collected_transactions(batch->size());
+        recover_senders(*batch, context);
+        return batch;
+    });
+    results_.emplace_back(std::move(batch_result));
+
+    // Check completed batch of senders and collect them
+    collect_senders();
+
+    if (is_stopping()) throw StageError(Stage::Result::kAborted);
+}
+
 void Senders::collect_senders() {
     std::erase_if(results_, [&](auto& future_completed_batch) {
         if (future_completed_batch.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
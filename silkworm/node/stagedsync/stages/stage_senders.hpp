@@ -18,6 +18,7 @@
 
 #include <secp256k1.h>
 
+#include <atomic>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -28,6 +29,7 @@
 #include <silkworm/core/chain/config.hpp>
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/types/transaction.hpp>
 #include <silkworm/db/etl/collector.hpp>
 #include <silkworm/db/etl/collector_settings.hpp>
 #include <silkworm/db/prune_mode.hpp>
@@ -38,16 +40,20 @@ namespace silkworm::stagedsync {
 
 //! \brief The information to compute the sender address from transaction signature
 struct AddressRecovery {
-    BlockNum block_num{0};       // Number of block containing the transaction
-    Hash block_hash;             // Hash of the block containing the transaction
-    bool odd_y_parity{false};    // Whether y parity is odd (https://eips.ethereum.org/EIPS/eip-155)
-    uint8_t tx_signature[64]{};  // Signature of the transaction
-    evmc::address tx_from;       // Recovered sender address
-    Bytes rlp;                   // RLP representation of the transaction
+    BlockNum block_num{0};    // Number of block containing the transaction
+    Hash block_hash;          // Hash of the block containing the transaction
+    Transaction transaction;  // Signed transaction
+    evmc::address tx_from;    // Recovered sender address
 };
 
 using AddressRecoveryBatch = std::vector<AddressRecovery>;
 
+//! \brief Recovers the senders of all the transactions in a batch
+//! \details Signing payloads are encoded and hashed on the calling thread using one buffer for the whole batch,
+//! so that the thread reading block bodies does not spend time on it
+//! \throws std::runtime_error if any sender cannot be recovered
+void recover_senders(AddressRecoveryBatch& batch, const secp256k1_context* context);
+
 class Senders final : public Stage {
   public:
     Senders(
@@ -68,8 +74,15 @@ class Senders final : public Stage {
   private:
     Stage::Result parallel_recover(db::RWTxn& txn);
 
-    Stage::Result add_to_batch(BlockNum block_num, const Hash& block_hash, const std::vector<Transaction>& transactions);
+    //! The number of blocks frozen into snapshots read and recovered by a single worker task
+    static constexpr BlockNum kFrozenBlocksPerTask{128};
+
+    Stage::Result add_to_batch(AddressRecoveryBatch& batch, BlockNum block_num, const Hash& block_hash,
+                               std::vector<Transaction>&& transactions);
+    void wait_for_worker_pool(ThreadPool& worker_pool);
     void recover_batch(ThreadPool& worker_pool, const secp256k1_context* context);
+    void recover_frozen_blocks(ThreadPool& worker_pool, const secp256k1_context* context, BlockNum first,
+                               BlockNum last, std::atomic<uint64_t>& total_empty_blocks);
     void collect_senders();
     void collect_senders(std::shared_ptr<AddressRecoveryBatch>& batch);
     void store_senders(db::RWTxn& txn);
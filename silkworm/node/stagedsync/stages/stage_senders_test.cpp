@@ -0,0 +1,78 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/crypto/ecdsa.h>
+#include <silkworm/node/stagedsync/stages/stage_senders.hpp>
+
+namespace silkworm::stagedsync {
+
+using namespace evmc::literals;
+
+TEST_CASE("Senders: recover senders of a batch") {
+    secp256k1_context* context{secp256k1_context_create(SILKWORM_SECP256K1_CONTEXT_FLAGS)};
+    REQUIRE(context);
+
+    // https://etherscan.io/tx/0x5c504ed432cb51138bcf09aa5e8a410dd4a1e204ef84bfed1be16dfba1b22060
+    Transaction txn1;
+    txn1.type = TransactionType::kLegacy;
+    txn1.nonce = 0;
+    txn1.max_priority_fee_per_gas = 50'000 * kGiga;
+    txn1.max_fee_per_gas = 50'000 * kGiga;
+    txn1.gas_limit = 21'000;
+    txn1.to = 0x5df9b87991262f6ba471f09758cde1c0fc1de734_address;
+    txn1.value = 31337;
+    txn1.odd_y_parity = true;
+    txn1.r = intx::from_string<intx::uint256>("0x88ff6cf0fefd94db46111149ae4bfc179e9b94721fffd821d38d16464b3f71d0");
+    txn1.s = intx::from_string<intx::uint256>("0x45e0aff800961cfce805daef7016b9b675c137a6a41a548f7b60a3484c06a33a");
+
+    // https://etherscan.io/tx/0xe17d4d0c4596ea7d5166ad5da600a6fdc49e26e0680135a2f7300eedfd0d8314
+    Transaction txn2;
+    txn2.type = TransactionType::kLegacy;
+    txn2.nonce = 1;
+    txn2.max_priority_fee_per_gas = 50'000 * kGiga;
+    txn2.max_fee_per_gas = 50'000 * kGiga;
+    txn2.gas_limit = 21'750;
+    txn2.to = 0xc9d4035f4a9226d50f79b73aafb5d874a1b6537e_address;
+    txn2.value = 31337;
+    txn2.data = *from_hex("0x74796d3474406469676978");
+    txn2.odd_y_parity = true;
+    txn2.r = intx::from_string<intx::uint256>("0x1c48defe76d367bb92b4fc0628aca42a4d8037062865635d955673e57eddfbfa");
+    txn2.s = intx::from_string<intx::uint256>("0x65f766849f97b15f01d0877636fbed0fa4e39f8834896c0354f56ac44dcb50a6");
+
+    SECTION("valid signatures") {
+        AddressRecoveryBatch batch;
+        batch.push_back(AddressRecovery{46147, {}, txn1});
+        batch.push_back(AddressRecovery{46214, {}, txn2});
+        REQUIRE_NOTHROW(recover_senders(batch, context));
+        CHECK(batch[0].tx_from == 0xa1e4380a3b1f749673e270229993ee55f35663b4_address);
+        CHECK(batch[1].tx_from == 0xa1e4380a3b1f749673e270229993ee55f35663b4_address);
+    }
+
+    SECTION("invalid signature") {
+        txn2.r = 0;
+        AddressRecoveryBatch batch;
+        batch.push_back(AddressRecovery{46147, {}, txn1});
+        batch.push_back(AddressRecovery{46214, {}, txn2});
+        CHECK_THROWS_AS(recover_senders(batch, context), std::runtime_error);
+    }
+
+    secp256k1_context_destroy(context);
+}
+
+}  // namespace silkworm::stagedsync
@@ -373,7 +373,7 @@ void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
         for (auto& rlp_encoded_tx : rlp_encoded_txs) {
             // Hash transaction rlp
             auto transaction_hash = keccak256(rlp_encoded_tx);  // see Transaction::hash()
-            collector_->collect({Bytes(transaction_hash.bytes, kHashLength), etl_value});
+            collector_->collect(transaction_hash.bytes, etl_value);
         }
     }
 }
@@ -386,7 +386,8 @@ std::vector<std::string> TxLookup::get_log_progress() {
     } else {
         if (loading_) {
             current_key_ = collector_ ? abridge(collector_->get_load_key(), kAddressLength) : "";
-            ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_});
+            ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_,
+                                   "rate", collector_ ? collector_->get_load_throughput() : ""});
         } else {
             ret.insert(ret.end(), {"from", current_source_, "to", "etl", "key", current_key_});
         }
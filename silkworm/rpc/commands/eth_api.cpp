@@ -1650,52 +1650,82 @@ Task<void> EthereumRpcApi::handle_eth_uninstall_filter(const nlohmann::json& req
 }
 
 // https://eth.wiki/json-rpc/API#eth_getlogs
-Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, std::string& reply) {
+Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, json::Stream& stream) {
     if (!request.contains("params")) {
         auto error_msg = "missing value for required argument 0";
         SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(request, kInvalidParams, error_msg, reply);
+        stream.write_json(make_json_error(request, kInvalidParams, error_msg));
         co_return;
     }
     auto params = request["params"];
     if (params.size() > 1) {
         auto error_msg = "too many arguments, want at most 1";
         SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(request, kInvalidParams, error_msg, reply);
+        stream.write_json(make_json_error(request, kInvalidParams, error_msg));
         co_return;
     }
 
     auto filter = params[0].get<Filter>();
     SILK_DEBUG << "filter: " << filter;
 
+    stream.open_object();
+    stream.write_json_field("id", request["id"]);
+    stream.write_field("jsonrpc", "2.0");
+
     auto tx = co_await database_->begin();
 
+    // Logs are streamed block by block as soon as they are produced, so the result array may be already open on error
+    bool result_open{false};
     try {
-        LogsWalker logs_walker{*block_cache_, *tx};
+        LogsWalker logs_walker{*block_cache_, *tx, workers_};
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
             SILK_ERROR << error_msg;
-            reply = make_json_error(request, 100, error_msg);
-            co_await tx->close();  // RAII not (yet) available with coroutines
-            co_return;
-        }
-
-        std::vector<Log> logs;
-        co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
+            const Error error{100, error_msg};
+            stream.write_json_field("error", error);
+        } else {
+            stream.write_field("result");
+            stream.open_array();
+            result_open = true;
+
+            LogFilterOptions options;
+            co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, options, /*desc_order=*/true, [&stream](Logs& block_logs) {
+                for (const auto& log : block_logs) {
+                    stream.write_json(log);
+                }
+            });
 
-        make_glaze_json_content(request, logs, reply);
-    } catch (const std::invalid_argument& iv) {
-        std::vector<silkworm::rpc::Log> log{};
-        make_glaze_json_content(request, log, reply);
+            stream.close_array();
+            result_open = false;
+        }
+    } catch (const std::invalid_argument&) {
+        if (!result_open) {
+            stream.write_field("result");
+            stream.open_array();
+        }
+        stream.close_array();
+        result_open = false;
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        make_glaze_json_error(request, kInternalError, e.what(), reply);
+        if (result_open) {
+            stream.close_array();
+            result_open = false;
+        }
+        const Error error{kInternalError, e.what()};
+        stream.write_json_field("error", error);
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        make_glaze_json_error(request, kServerError, "unexpected exception", reply);
+        if (result_open) {
+            stream.close_array();
+            result_open = false;
+        }
+        const Error error{kServerError, "unexpected exception"};
+        stream.write_json_field("error", error);
     }
 
+    stream.close_object();
+
     co_await tx->close();  // RAII not (yet) available with coroutines
 }
 
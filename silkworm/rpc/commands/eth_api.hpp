@@ -31,6 +31,7 @@
 #include <silkworm/rpc/core/filter_storage.hpp>
 #include <silkworm/rpc/ethbackend/backend.hpp>
 #include <silkworm/rpc/ethdb/database.hpp>
+#include <silkworm/rpc/json/stream.hpp>
 #include <silkworm/rpc/json/types.hpp>
 #include <silkworm/rpc/txpool/miner.hpp>
 #include <silkworm/rpc/txpool/transaction_pool.hpp>
@@ -111,7 +112,7 @@ class EthereumRpcApi {
     Task<void> handle_eth_call_many(const nlohmann::json& request, nlohmann::json& reply);
 
     // GLAZE format routine
-    Task<void> handle_eth_get_logs(const nlohmann::json& request, std::string& reply);
+    Task<void> handle_eth_get_logs(const nlohmann::json& request, json::Stream& stream);
     Task<void> handle_eth_call(const nlohmann::json& request, std::string& reply);
     Task<void> handle_eth_get_block_by_number(const nlohmann::json& request, std::string& reply);
     Task<void> handle_eth_get_block_by_hash(const nlohmann::json& request, std::string& reply);
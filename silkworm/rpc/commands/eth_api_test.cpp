@@ -14,6 +14,7 @@
    limitations under the License.
 */
 
+#include <string>
 #include <thread>
 
 #include <catch2/catch_test_macros.hpp>
@@ -141,6 +142,45 @@ TEST_CASE_METHOD(test_util::RpcApiE2ETest, "fuzzy: eth_feeHistory sigsegv valid
             "reward":[["0x0","0x0"],["0x1","0x1"],["0x1","0x1"]]}
     })"_json);
 }
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "unit: eth_getLogs streams logs of whole range", "[rpc][api]") {
+    const auto request = R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[{"fromBlock":"0x0","toBlock":"0x9"}]})"_json;
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request, reply);
+    const auto reply_json = nlohmann::json::parse(reply);
+    CHECK(reply_json["jsonrpc"] == "2.0");
+    CHECK(reply_json["id"] == 1);
+    CHECK(!reply_json.contains("error"));
+    const auto& logs = reply_json["result"];
+    REQUIRE(logs.is_array());
+    REQUIRE(!logs.empty());
+    // Blocks are emitted from the most recent one
+    for (size_t i{1}; i < logs.size(); ++i) {
+        CHECK(std::stoull(logs[i - 1]["blockNumber"].get<std::string>(), nullptr, 16) >=
+              std::stoull(logs[i]["blockNumber"].get<std::string>(), nullptr, 16));
+    }
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "unit: eth_getLogs streams empty result", "[rpc][api]") {
+    const auto request = R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[{"fromBlock":"0x0","toBlock":"0x0"}]})"_json;
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request, reply);
+    CHECK(nlohmann::json::parse(reply) == R"({
+        "jsonrpc":"2.0",
+        "id":1,
+        "result":[]
+    })"_json);
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "unit: eth_getLogs fails if params missing", "[rpc][api]") {
+    const auto request = R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs"})"_json;
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request, reply);
+    CHECK(nlohmann::json::parse(reply) == R"({
+        "jsonrpc":"2.0",
+        "id":1,
+        "error":{"code":-32602,"message":"missing value for required argument 0"}
+    })"_json);
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc::commands
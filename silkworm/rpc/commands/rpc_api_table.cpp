@@ -159,9 +159,9 @@ void RpcApiTable::add_eth_handlers() {
     method_handlers_[json_rpc::method::k_eth_maxPriorityFeePerGas] = &commands::RpcApi::handle_eth_max_priority_fee_per_gas;
     method_handlers_[json_rpc::method::k_eth_feeHistory] = &commands::RpcApi::handle_fee_history;
     method_handlers_[json_rpc::method::k_eth_callMany] = &commands::RpcApi::handle_eth_call_many;
+    stream_handlers_[json_rpc::method::k_eth_getLogs] = &commands::RpcApi::handle_eth_get_logs;
 
     // GLAZE methods
-    method_handlers_glaze_[json_rpc::method::k_eth_getLogs] = &commands::RpcApi::handle_eth_get_logs;
     method_handlers_glaze_[json_rpc::method::k_eth_call] = &commands::RpcApi::handle_eth_call;
     method_handlers_glaze_[json_rpc::method::k_eth_getBlockByNumber] = &commands::RpcApi::handle_eth_get_block_by_number;
     method_handlers_glaze_[json_rpc::method::k_eth_getBlockByHash] = &commands::RpcApi::handle_eth_get_block_by_hash;
@@ -16,6 +16,7 @@
 
 #include "logs_walker.hpp"
 
+#include <algorithm>
 #include <string>
 
 #include <boost/endian/conversion.hpp>
@@ -25,6 +26,8 @@
 #include <silkworm/db/chain/chain.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
+#include <silkworm/rpc/common/async_task.hpp>
 #include <silkworm/rpc/core/blocks.hpp>
 #include <silkworm/rpc/core/cached_chain.hpp>
 #include <silkworm/rpc/ethdb/bitmap.hpp>
@@ -68,9 +71,17 @@ Task<std::pair<uint64_t, uint64_t>> LogsWalker::get_block_numbers(const Filter&
 
 Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
                                 const FilterAddresses& addresses, const FilterTopics& topics, const LogFilterOptions& options, bool desc_order, std::vector<Log>& logs) {
+    co_await get_logs(start, end, addresses, topics, options, desc_order, [&logs](Logs& block_logs) {
+        logs.insert(logs.end(), std::make_move_iterator(block_logs.begin()), std::make_move_iterator(block_logs.end()));
+    });
+    SILK_DEBUG << "resulting logs size: " << logs.size();
+}
+
+Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
+                                const FilterAddresses& addresses, const FilterTopics& topics, const LogFilterOptions& options, bool desc_order,
+                                const BlockLogsConsumer& consumer) {
     SILK_DEBUG << "start block: " << start << " end block: " << end;
 
-    const auto chain_storage{tx_.create_storage()};
     roaring::Roaring block_numbers;
     block_numbers.addRange(start, end + 1);  // [min, max)
 
@@ -108,9 +119,33 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
         std::reverse(matching_block_numbers.begin(), matching_block_numbers.end());
     }
 
+    // The block log summaries allow to skip decoding the transactions having no candidate log
+    std::vector<ByteView> summary_addresses;
+    summary_addresses.reserve(addresses.size());
+    for (const auto& address : addresses) {
+        summary_addresses.emplace_back(address.bytes, kAddressLength);
+    }
+    std::vector<ByteView> summary_topics0;
+    if (!topics.empty()) {
+        summary_topics0.reserve(topics[0].size());
+        for (const auto& topic : topics[0]) {
+            summary_topics0.emplace_back(topic.bytes, kHashLength);
+        }
+    }
+    const LogSummaryFilter summary_filter{summary_addresses, summary_topics0};
+
+    // Limited queries stop as soon as the limit is hit, so they must be walked sequentially
+    if (workers_ && options.log_count == 0 && options.block_count == 0) {
+        co_await get_logs_in_parallel(matching_block_numbers, summary_filter, addresses, topics, options, consumer);
+        co_return;
+    }
+
+    const auto chain_storage{tx_.create_storage()};
+
     std::uint64_t log_count{0};
     std::uint64_t block_count{0};
 
+    RawLogs raw_logs;
     Logs chunk_logs;
     Logs filtered_chunk_logs;
     Logs filtered_block_logs;
@@ -122,52 +157,29 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
         uint32_t log_index{0};
 
         filtered_block_logs.clear();
-        const auto block_key = silkworm::db::block_key(block_to_match);
-        SILK_DEBUG << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
-        co_await ethdb::for_prefix(tx_, db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
-            chunk_logs.clear();
-            const bool decoding_ok{cbor_decode(v, chunk_logs)};
-            if (!decoding_ok) {
-                return false;
+        SILK_DEBUG << "block_to_match: " << block_to_match;
+        co_await read_raw_logs(block_to_match, summary_filter, raw_logs);
+        for (const auto& [k, v, first_log_index] : raw_logs) {
+            if (first_log_index) {
+                log_index = *first_log_index;
             }
-            for (auto& log : chunk_logs) {
-                log.index = log_index++;
+            const size_t max_logs = options.log_count == 0 ? 0 : options.log_count - log_count;
+            const auto filtered_count = decode_and_filter(k, v, log_index, addresses, topics, max_logs,
+                                                          chunk_logs, filtered_chunk_logs, filtered_block_logs);
+            if (!filtered_count) {
+                break;
             }
-            SILK_DEBUG << "chunk_logs.size(): " << chunk_logs.size();
-
-            filtered_chunk_logs.clear();
-            filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs, options.log_count == 0 ? 0 : options.log_count - log_count);
-
-            if (!filtered_chunk_logs.empty()) {
-                const auto tx_index = boost::endian::load_big_u32(&k[sizeof(uint64_t)]);
-                SILK_TRACE << "Transaction index: " << tx_index;
-                for (auto& log : filtered_chunk_logs) {
-                    log.tx_index = tx_index;
-                }
-                log_count += filtered_chunk_logs.size();
-                SILK_TRACE << "log_count: " << log_count;
-                filtered_block_logs.insert(filtered_block_logs.end(), filtered_chunk_logs.rbegin(), filtered_chunk_logs.rend());
+            log_count += *filtered_count;
+            SILK_TRACE << "log_count: " << log_count;
+            if (options.log_count != 0 && options.log_count <= log_count) {
+                break;
             }
-            return options.log_count == 0 || options.log_count > log_count;
-        });
+        }
         SILK_DEBUG << "filtered_block_logs.size(): " << filtered_block_logs.size();
 
         if (!filtered_block_logs.empty()) {
-            const auto block_with_hash = co_await core::read_block_by_number(block_cache_, *chain_storage, block_to_match);
-            if (!block_with_hash) {
-                throw std::invalid_argument("read_block_by_number: block not found " + std::to_string(block_to_match));
-            }
-            SILK_TRACE << "assigning block_hash: " << silkworm::to_hex(block_with_hash->hash);
-            for (auto& log : filtered_block_logs) {
-                const auto tx_hash{block_with_hash->block.transactions[log.tx_index].hash()};
-                log.block_number = block_to_match;
-                log.block_hash = block_with_hash->hash;
-                log.tx_hash = silkworm::to_bytes32({tx_hash.bytes, silkworm::kHashLength});
-                if (options.add_timestamp) {
-                    log.timestamp = block_with_hash->block.header.timestamp;
-                }
-            }
-            logs.insert(logs.end(), filtered_block_logs.begin(), filtered_block_logs.end());
+            co_await assign_block_fields(block_to_match, options, *chain_storage, filtered_block_logs);
+            consumer(filtered_block_logs);
         }
         block_count++;
         if (options.log_count != 0 && options.log_count <= log_count) {
@@ -177,9 +189,162 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
             break;
         }
     }
-    SILK_DEBUG << "resulting logs size: " << logs.size();
+}
+
+Task<void> LogsWalker::get_logs_in_parallel(const std::vector<BlockNum>& block_numbers, const LogSummaryFilter& summary_filter,
+                                            const FilterAddresses& addresses, const FilterTopics& topics,
+                                            const LogFilterOptions& options, const BlockLogsConsumer& consumer) {
+    const auto chain_storage{tx_.create_storage()};
+
+    // Memory is bounded by the window size: at most one window of raw and decoded logs is alive at any time
+    std::vector<RawLogs> window_raw_logs(std::min(kParallelWindowSize, block_numbers.size()));
+    std::vector<Logs> window_block_logs(window_raw_logs.size());
+
+    for (size_t window_start{0}; window_start < block_numbers.size(); window_start += kParallelWindowSize) {
+        const size_t window_size{std::min(kParallelWindowSize, block_numbers.size() - window_start)};
+        SILK_DEBUG << "window_start: " << window_start << " window_size: " << window_size;
+
+        // Read the raw logs of the window blocks from the transaction
+        for (size_t i{0}; i < window_size; ++i) {
+            co_await read_raw_logs(block_numbers[window_start + i], summary_filter, window_raw_logs[i]);
+        }
+
+        // Decode and filter the window blocks concurrently on the workers
+        co_await concurrency::generate_parallel_group_task(window_size, [&](size_t i) -> Task<void> {
+            window_block_logs[i] = co_await async_task(workers_->executor(), [&, i]() {
+                return decode_and_filter(window_raw_logs[i], addresses, topics);
+            });
+        });
+
+        // Emit the matching logs preserving the block order
+        for (size_t i{0}; i < window_size; ++i) {
+            auto& block_logs = window_block_logs[i];
+            SILK_DEBUG << "block: " << block_numbers[window_start + i] << " filtered_block_logs.size(): " << block_logs.size();
+            if (!block_logs.empty()) {
+                co_await assign_block_fields(block_numbers[window_start + i], options, *chain_storage, block_logs);
+                consumer(block_logs);
+            }
+            block_logs.clear();
+        }
+    }
+}
 
-    co_return;
+Task<void> LogsWalker::read_raw_logs(BlockNum block_number, const LogSummaryFilter& summary_filter, RawLogs& raw_logs) {
+    raw_logs.clear();
+    const auto summary = co_await read_log_summary(block_number);
+    if (!summary.empty()) {
+        const auto candidates = summary_filter.find_candidates(summary);
+        SILK_DEBUG << "block: " << block_number << " #candidate transactions: " << candidates.size();
+        for (const auto& candidate : candidates) {
+            auto key = db::log_key(block_number, candidate.tx_index);
+            auto value = co_await tx_.get_one(db::table::kLogsName, key);
+            if (value.empty()) {
+                continue;
+            }
+            raw_logs.push_back({std::move(key), std::move(value), candidate.first_log_index});
+        }
+        co_return;
+    }
+
+    // No summary for this block (e.g. not backfilled yet), so all the transaction logs must be read
+    const auto block_key = db::block_key(block_number);
+    co_await ethdb::for_prefix(tx_, db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
+        raw_logs.push_back({k, v, std::nullopt});
+        return true;
+    });
+    if (raw_logs.empty()) {
+        // Logs of frozen blocks are pruned from the database along with their summary
+        co_await read_frozen_raw_logs(block_number, raw_logs);
+    }
+}
+
+Task<void> LogsWalker::read_frozen_raw_logs(BlockNum block_number, RawLogs& raw_logs) {
+    const auto chain_storage{tx_.create_storage()};
+    const auto frozen_receipts = co_await chain_storage->read_frozen_receipts(block_number);
+    if (!frozen_receipts) {
+        co_return;
+    }
+    const auto& transaction_logs = frozen_receipts->transaction_logs;
+    for (uint32_t tx_index{0}; tx_index < transaction_logs.size(); ++tx_index) {
+        if (transaction_logs[tx_index].empty()) continue;
+        raw_logs.push_back({db::log_key(block_number, tx_index), transaction_logs[tx_index], std::nullopt});
+    }
+}
+
+Task<Bytes> LogsWalker::read_log_summary(BlockNum block_number) {
+    if (!log_summary_available_) {
+        co_return Bytes{};
+    }
+    try {
+        co_return co_await tx_.get_one(db::table::kLogSummaryName, db::block_key(block_number));
+    } catch (const std::exception& e) {
+        // The remote database may not have the log summary table: fallback to full decoding
+        SILK_DEBUG << "log summary not available: " << e.what();
+        log_summary_available_ = false;
+    }
+    co_return Bytes{};
+}
+
+Task<void> LogsWalker::assign_block_fields(BlockNum block_number, const LogFilterOptions& options,
+                                           const ChainStorage& chain_storage, Logs& block_logs) {
+    const auto block_with_hash = co_await core::read_block_by_number(block_cache_, chain_storage, block_number);
+    if (!block_with_hash) {
+        throw std::invalid_argument("read_block_by_number: block not found " + std::to_string(block_number));
+    }
+    SILK_TRACE << "assigning block_hash: " << silkworm::to_hex(block_with_hash->hash);
+    for (auto& log : block_logs) {
+        const auto tx_hash{block_with_hash->block.transactions[log.tx_index].hash()};
+        log.block_number = block_number;
+        log.block_hash = block_with_hash->hash;
+        log.tx_hash = silkworm::to_bytes32({tx_hash.bytes, silkworm::kHashLength});
+        if (options.add_timestamp) {
+            log.timestamp = block_with_hash->block.header.timestamp;
+        }
+    }
+}
+
+std::optional<std::size_t> LogsWalker::decode_and_filter(const Bytes& key, const Bytes& value, uint32_t& log_index,
+                                                         const FilterAddresses& addresses, const FilterTopics& topics,
+                                                         size_t max_logs, Logs& chunk_logs, Logs& filtered_chunk_logs,
+                                                         Logs& block_logs) {
+    chunk_logs.clear();
+    const bool decoding_ok{cbor_decode(value, chunk_logs)};
+    if (!decoding_ok) {
+        return std::nullopt;
+    }
+    for (auto& log : chunk_logs) {
+        log.index = log_index++;
+    }
+    SILK_DEBUG << "chunk_logs.size(): " << chunk_logs.size();
+
+    filtered_chunk_logs.clear();
+    filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs, max_logs);
+
+    if (!filtered_chunk_logs.empty()) {
+        const auto tx_index = boost::endian::load_big_u32(&key[sizeof(uint64_t)]);
+        SILK_TRACE << "Transaction index: " << tx_index;
+        for (auto& log : filtered_chunk_logs) {
+            log.tx_index = tx_index;
+        }
+        block_logs.insert(block_logs.end(), filtered_chunk_logs.rbegin(), filtered_chunk_logs.rend());
+    }
+    return filtered_chunk_logs.size();
+}
+
+Logs LogsWalker::decode_and_filter(const RawLogs& raw_logs, const FilterAddresses& addresses, const FilterTopics& topics) {
+    uint32_t log_index{0};
+    Logs chunk_logs;
+    Logs filtered_chunk_logs;
+    Logs block_logs;
+    for (const auto& [key, value, first_log_index] : raw_logs) {
+        if (first_log_index) {
+            log_index = *first_log_index;
+        }
+        if (!decode_and_filter(key, value, log_index, addresses, topics, /*max_logs=*/0, chunk_logs, filtered_chunk_logs, block_logs)) {
+            break;
+        }
+    }
+    return block_logs;
 }
 
 void LogsWalker::filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs,
@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
 #include <vector>
 
 #include <boost/asio/awaitable.hpp>
 
 #include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/db/chain/chain_storage.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
+#include <silkworm/db/log_summary.hpp>
+#include <silkworm/rpc/common/worker_pool.hpp>
 #include <silkworm/rpc/ethbackend/backend.hpp>
 #include <silkworm/rpc/types/filter.hpp>
 #include <silkworm/rpc/types/log.hpp>
@@ -32,9 +37,19 @@ using boost::asio::awaitable;
 
 class LogsWalker {
   public:
+    //! Consumer of the matching logs, called once per block with a non-empty set of logs in emission order
+    using BlockLogsConsumer = std::function<void(Logs&)>;
+
+    //! Number of matching blocks decoded and filtered concurrently before their logs are emitted
+    static constexpr std::size_t kParallelWindowSize{64};
+
     explicit LogsWalker(BlockCache& block_cache, db::kv::api::Transaction& tx)
         : block_cache_(block_cache), tx_(tx) {}
 
+    //! Walker decoding and filtering logs of unlimited queries concurrently on the specified workers
+    LogsWalker(BlockCache& block_cache, db::kv::api::Transaction& tx, WorkerPool& workers)
+        : block_cache_(block_cache), tx_(tx), workers_(&workers) {}
+
     LogsWalker(const LogsWalker&) = delete;
     LogsWalker& operator=(const LogsWalker&) = delete;
 
@@ -48,12 +63,45 @@ class LogsWalker {
                         const FilterAddresses& addresses, const FilterTopics& topics,
                         const LogFilterOptions& options, bool desc_order,
                         std::vector<Log>& logs);
+    Task<void> get_logs(std::uint64_t start, std::uint64_t end,
+                        const FilterAddresses& addresses, const FilterTopics& topics,
+                        const LogFilterOptions& options, bool desc_order,
+                        const BlockLogsConsumer& consumer);
 
   private:
-    void filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs, size_t max_logs);
+    //! Logs of one transaction as read from the database
+    struct RawTxLogs {
+        Bytes key;
+        Bytes value;
+        std::optional<uint32_t> first_log_index;  // Known only when located through the block log summary
+    };
+    using RawLogs = std::vector<RawTxLogs>;
+
+    //! Read the logs of the transactions in block which may match the filter, using the block log summary if any
+    Task<void> read_raw_logs(BlockNum block_number, const LogSummaryFilter& summary_filter, RawLogs& raw_logs);
+    //! Read the logs of all the transactions in block from the receipts snapshot, if any
+    Task<void> read_frozen_raw_logs(BlockNum block_number, RawLogs& raw_logs);
+    Task<Bytes> read_log_summary(BlockNum block_number);
+
+    Task<void> get_logs_in_parallel(const std::vector<BlockNum>& block_numbers, const LogSummaryFilter& summary_filter,
+                                    const FilterAddresses& addresses, const FilterTopics& topics,
+                                    const LogFilterOptions& options, const BlockLogsConsumer& consumer);
+    Task<void> assign_block_fields(BlockNum block_number, const LogFilterOptions& options,
+                                   const db::chain::ChainStorage& chain_storage, Logs& block_logs);
+
+    //! Decode the logs of one transaction and append the ones matching the filter to block_logs
+    //! \return the number of appended logs or std::nullopt if decoding fails
+    static std::optional<std::size_t> decode_and_filter(const Bytes& key, const Bytes& value, uint32_t& log_index,
+                                                        const FilterAddresses& addresses, const FilterTopics& topics,
+                                                        size_t max_logs, Logs& chunk_logs, Logs& filtered_chunk_logs,
+                                                        Logs& block_logs);
+    static Logs decode_and_filter(const RawLogs& raw_logs, const FilterAddresses& addresses, const FilterTopics& topics);
+    static void filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs, size_t max_logs);
 
     BlockCache& block_cache_;
     db::kv::api::Transaction& tx_;
+    WorkerPool* workers_{nullptr};
+    bool log_summary_available_{true};
 };
 
 }  // namespace silkworm::rpc
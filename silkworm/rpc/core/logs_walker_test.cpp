@@ -0,0 +1,295 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "logs_walker.hpp"
+
+#include <memory>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/use_future.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/core/common/test_util.hpp>
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/kv/api/local_transaction.hpp>
+#include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/log_summary.hpp>
+#include <silkworm/db/mdbx/bitmap.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/mock_chain_storage.hpp>
+#include <silkworm/db/test_util/mock_cursor.hpp>
+#include <silkworm/db/test_util/mock_transaction.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/db/test_util/test_database_context.hpp>
+#include <silkworm/db/util.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/rpc/common/worker_pool.hpp>
+#include <silkworm/rpc/test_util/service_context_test_base.hpp>
+
+namespace silkworm::rpc {
+
+using namespace evmc::literals;
+using db::kv::api::KeyValue;
+using testing::_;
+using testing::Invoke;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+
+//! Last block in the test database
+static constexpr BlockNum kLatestBlock{9};
+
+class LogsWalkerTest : public db::test_util::TestDatabaseContext, public test_util::ServiceContextTestBase {
+  public:
+    Logs get_logs(bool parallel, LogFilterOptions options = {}, bool desc_order = false) {
+        return spawn_and_wait(read_logs(parallel, options, desc_order));
+    }
+
+  private:
+    Task<Logs> read_logs(bool parallel, LogFilterOptions options, bool desc_order) {
+        db::kv::api::LocalTransaction tx{mdbx_env(), /*state_cache=*/nullptr};
+        co_await tx.open();
+        auto walker = parallel ? std::make_unique<LogsWalker>(block_cache_, tx, workers_)
+                               : std::make_unique<LogsWalker>(block_cache_, tx);
+        Logs logs;
+        co_await walker->get_logs(0, kLatestBlock, /*addresses=*/{}, /*topics=*/{}, options, desc_order, logs);
+        co_await tx.close();
+        co_return logs;
+    }
+
+    WorkerPool workers_{2};
+    BlockCache block_cache_;
+};
+
+static void check_same_logs(const Logs& logs, const Logs& expected_logs) {
+    REQUIRE(logs.size() == expected_logs.size());
+    for (size_t i{0}; i < logs.size(); ++i) {
+        CHECK(logs[i].address == expected_logs[i].address);
+        CHECK(logs[i].topics == expected_logs[i].topics);
+        CHECK(logs[i].data == expected_logs[i].data);
+        CHECK(logs[i].block_number == expected_logs[i].block_number);
+        CHECK(logs[i].block_hash == expected_logs[i].block_hash);
+        CHECK(logs[i].tx_hash == expected_logs[i].tx_hash);
+        CHECK(logs[i].tx_index == expected_logs[i].tx_index);
+        CHECK(logs[i].index == expected_logs[i].index);
+    }
+}
+
+#ifndef SILKWORM_SANITIZE
+TEST_CASE_METHOD(LogsWalkerTest, "LogsWalker::get_logs parallel", "[rpc][core][logs_walker]") {
+    SECTION("ascending order") {
+        const auto sequential_logs = get_logs(/*parallel=*/false);
+        REQUIRE(!sequential_logs.empty());
+        check_same_logs(get_logs(/*parallel=*/true), sequential_logs);
+    }
+
+    SECTION("descending order") {
+        const auto sequential_logs = get_logs(/*parallel=*/false, {}, /*desc_order=*/true);
+        REQUIRE(!sequential_logs.empty());
+        CHECK(sequential_logs.front().block_number >= sequential_logs.back().block_number);
+        check_same_logs(get_logs(/*parallel=*/true, {}, /*desc_order=*/true), sequential_logs);
+    }
+
+    SECTION("log count limit walks blocks sequentially") {
+        const LogFilterOptions options{.log_count = 1};
+        const auto parallel_logs = get_logs(/*parallel=*/true, options);
+        CHECK(parallel_logs.size() == 1);
+        check_same_logs(parallel_logs, get_logs(/*parallel=*/false, options));
+    }
+
+    SECTION("block count limit walks blocks sequentially") {
+        const LogFilterOptions options{.block_count = 1};
+        const auto parallel_logs = get_logs(/*parallel=*/true, options, /*desc_order=*/true);
+        for (const auto& log : parallel_logs) {
+            CHECK(log.block_number == kLatestBlock);
+        }
+        check_same_logs(parallel_logs, get_logs(/*parallel=*/false, options, /*desc_order=*/true));
+    }
+}
+#endif  // SILKWORM_SANITIZE
+
+static const auto kAddress1{0x7a250d5630b4cf539739df2c5dacb4c659f2488d_address};
+static const auto kAddress2{0xc02aaa39b223fe8d0a0e5c4f27ead9083c756cc2_address};
+static const auto kTopic{0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32};
+
+//! Block having 3 transactions with logs, whose summary omits the transaction in the middle
+class LogsWalkerSummaryTest : public test_util::ServiceContextTestBase {
+  public:
+    static constexpr BlockNum kBlockNumber{1};
+
+    LogsWalkerSummaryTest() {
+        db::RWTxn& txn{context_.rw_txn()};
+
+        auto transactions{test::sample_transactions()};
+        transactions.push_back(transactions[0]);
+        BlockHeader header;
+        header.number = kBlockNumber;
+        const auto hash{header.hash()};
+        db::write_header(txn, header, /*with_header_numbers=*/true);
+        db::write_canonical_hash(txn, kBlockNumber, hash);
+        db::write_body(txn, BlockBody{.transactions = transactions}, hash, kBlockNumber);
+
+        const std::vector<std::vector<silkworm::Log>> transaction_logs{
+            {silkworm::Log{kAddress1, {kTopic}, {}}},
+            {silkworm::Log{kAddress2, {}, {}}, silkworm::Log{kAddress1, {}, {}}},
+            {silkworm::Log{kAddress1, {}, {}}},
+        };
+        auto logs_cursor = txn.rw_cursor(db::table::kLogs);
+        for (uint32_t tx_index{0}; tx_index < transaction_logs.size(); ++tx_index) {
+            const Bytes logs_cbor{cbor_encode(transaction_logs[tx_index])};
+            logs_cursor->upsert(db::to_slice(db::log_key(kBlockNumber, tx_index)), db::to_slice(logs_cbor));
+        }
+
+        // The summary locates the logs of the first and last transactions only, so the middle one must be skipped
+        Bytes summary;
+        append_log_summary(cbor_encode(transaction_logs[0]), /*tx_index=*/0, /*first_log_index=*/0, summary);
+        append_log_summary(cbor_encode(transaction_logs[2]), /*tx_index=*/2, /*first_log_index=*/3, summary);
+        txn.rw_cursor(db::table::kLogSummary)->upsert(db::to_slice(db::block_key(kBlockNumber)), db::to_slice(summary));
+
+        for (const auto& address : {kAddress1, kAddress2}) {
+            roaring::Roaring bitmap{roaring::Roaring::bitmapOf(1, static_cast<uint32_t>(kBlockNumber))};
+            Bytes key{address.bytes, kAddressLength};
+            key.append({0xff, 0xff, 0xff, 0xff});
+            txn.rw_cursor(db::table::kLogAddressIndex)->upsert(db::to_slice(key), db::to_slice(db::bitmap::to_bytes(bitmap)));
+        }
+        context_.commit_txn();
+    }
+
+    Logs get_logs() {
+        return spawn_and_wait(read_logs());
+    }
+
+    void erase_summary() {
+        db::RWTxnManaged txn{context_.env()};
+        txn.rw_cursor(db::table::kLogSummary)->erase(db::to_slice(db::block_key(kBlockNumber)));
+        txn.commit_and_stop();
+    }
+
+    void drop_summary_table() {
+        db::RWTxnManaged txn{context_.env()};
+        txn->drop_map(db::table::kLogSummary.name);
+        txn.commit_and_stop();
+    }
+
+  private:
+    Task<Logs> read_logs() {
+        db::kv::api::LocalTransaction tx{context_.env(), /*state_cache=*/nullptr};
+        co_await tx.open();
+        LogsWalker walker{block_cache_, tx};
+        Logs logs;
+        co_await walker.get_logs(kBlockNumber, kBlockNumber, {kAddress1}, /*topics=*/{}, LogFilterOptions{}, /*desc_order=*/false, logs);
+        co_await tx.close();
+        co_return logs;
+    }
+
+    db::test_util::TempChainData context_;
+    BlockCache block_cache_;
+};
+
+TEST_CASE_METHOD(LogsWalkerSummaryTest, "LogsWalker::get_logs log summary", "[rpc][core][logs_walker]") {
+    SECTION("only candidate transactions are decoded") {
+        const auto logs = get_logs();
+        REQUIRE(logs.size() == 2);
+        CHECK(logs[0].tx_index == 0);
+        CHECK(logs[0].index == 0);
+        // The log index is seeded from the summary
+        CHECK(logs[1].tx_index == 2);
+        CHECK(logs[1].index == 3);
+    }
+
+    SECTION("fallback to all transactions without block summary") {
+        erase_summary();
+        const auto logs = get_logs();
+        REQUIRE(logs.size() == 3);
+        CHECK(logs[1].tx_index == 1);
+        CHECK(logs[1].index == 2);
+        CHECK(logs[2].tx_index == 2);
+        CHECK(logs[2].index == 3);
+    }
+
+    SECTION("fallback to all transactions without summary table") {
+        drop_summary_table();
+        const auto logs = get_logs();
+        REQUIRE(logs.size() == 3);
+        CHECK(logs[1].tx_index == 1);
+        CHECK(logs[1].index == 2);
+        CHECK(logs[2].tx_index == 2);
+        CHECK(logs[2].index == 3);
+    }
+}
+
+TEST_CASE("LogsWalker::get_logs frozen receipts", "[rpc][core][logs_walker]") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    WorkerPool pool{1};
+    BlockCache block_cache;
+    db::test_util::MockTransaction transaction;
+    const BlockNum block_number{1};
+
+    // Logs of frozen blocks are pruned from the database along with their summary
+    EXPECT_CALL(transaction, get_one(db::table::kLogSummaryName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<Bytes> {
+        co_return Bytes{};
+    }));
+    auto cursor = std::make_shared<db::test_util::MockCursor>();
+    EXPECT_CALL(transaction, cursor(db::table::kLogsName)).WillOnce(Invoke([&cursor](auto&&) -> Task<std::shared_ptr<db::kv::api::Cursor>> {
+        co_return cursor;
+    }));
+    EXPECT_CALL(*cursor, seek(_)).WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> { co_return KeyValue{}; }));
+    auto chain_storage = std::make_shared<db::test_util::MockChainStorage>();
+    EXPECT_CALL(transaction, create_storage()).WillRepeatedly(Return(chain_storage));
+
+    SECTION("logs read from receipts snapshot") {
+        const std::vector<silkworm::Log> logs{silkworm::Log{kAddress1, {kTopic}, {}}, silkworm::Log{kAddress2, {}, {}}};
+        EXPECT_CALL(*chain_storage, read_frozen_receipts(block_number)).WillOnce(InvokeWithoutArgs([&]() -> Task<std::optional<snapshots::BlockReceiptsForStorage>> {
+            co_return snapshots::BlockReceiptsForStorage{.transaction_logs = {Bytes{}, cbor_encode(logs)}};
+        }));
+        EXPECT_CALL(*chain_storage, read_canonical_hash(block_number)).WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<Hash>> {
+            co_return Hash{ByteView{(0x01_bytes32).bytes}};
+        }));
+        EXPECT_CALL(*chain_storage, read_block(_, block_number, true, _)).WillOnce(Invoke([](auto, auto, auto, silkworm::Block& block) -> Task<bool> {
+            block.transactions = test::sample_transactions();
+            co_return true;
+        }));
+
+        LogsWalker walker{block_cache, transaction};
+        Logs result;
+        auto future = boost::asio::co_spawn(pool, walker.get_logs(block_number, block_number, {}, {}, LogFilterOptions{}, false, result), boost::asio::use_future);
+        CHECK_NOTHROW(future.get());
+        REQUIRE(result.size() == 2);
+        for (const auto& log : result) {
+            CHECK(log.block_number == block_number);
+            CHECK(log.tx_index == 1);
+        }
+        // Logs of one transaction are emitted in reverse order
+        CHECK(result[0].address == kAddress2);
+        CHECK(result[0].index == 1);
+        CHECK(result[1].address == kAddress1);
+        CHECK(result[1].index == 0);
+    }
+
+    SECTION("no receipts snapshot") {
+        EXPECT_CALL(*chain_storage, read_frozen_receipts(block_number)).WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<snapshots::BlockReceiptsForStorage>> {
+            co_return std::nullopt;
+        }));
+
+        LogsWalker walker{block_cache, transaction};
+        Logs result;
+        auto future = boost::asio::co_spawn(pool, walker.get_logs(block_number, block_number, {}, {}, LogFilterOptions{}, false, result), boost::asio::use_future);
+        CHECK_NOTHROW(future.get());
+        CHECK(result.empty());
+    }
+}
+
+}  // namespace silkworm::rpc
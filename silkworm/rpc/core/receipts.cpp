@@ -96,12 +96,38 @@ Task<std::optional<Receipts>> read_receipts(db::kv::api::Transaction& tx, const
     co_return raw_receipts;
 }
 
+//! Read the raw receipts of a block pruned from the database after being frozen in the receipts snapshot
+static Task<std::optional<Receipts>> read_frozen_raw_receipts(db::kv::api::Transaction& tx, BlockNum block_number) {
+    const auto chain_storage = tx.create_storage();
+    const auto frozen_receipts = co_await chain_storage->read_frozen_receipts(block_number);
+    if (!frozen_receipts || frozen_receipts->receipts.empty()) {
+        co_return std::nullopt;
+    }
+
+    Receipts receipts{};
+    const bool decoding_ok{cbor_decode(frozen_receipts->receipts, receipts)};
+    if (!decoding_ok) {
+        throw std::runtime_error("cannot decode frozen receipts in block: " + std::to_string(block_number));
+    }
+    const auto& transaction_logs = frozen_receipts->transaction_logs;
+    for (size_t tx_id{0}; tx_id < transaction_logs.size() && tx_id < receipts.size(); ++tx_id) {
+        if (transaction_logs[tx_id].empty()) continue;
+        const bool decode_ok{cbor_decode(transaction_logs[tx_id], receipts[tx_id].logs)};
+        if (!decode_ok) {
+            SILK_WARN << "cannot decode frozen logs for receipt: " << tx_id << " in block: " << block_number;
+            break;
+        }
+        receipts[tx_id].bloom = bloom_from_logs(receipts[tx_id].logs);
+    }
+    co_return receipts;
+}
+
 Task<std::optional<Receipts>> read_raw_receipts(db::kv::api::Transaction& tx, BlockNum block_number) {
     const auto block_key = db::block_key(block_number);
     const auto data = co_await tx.get_one(db::table::kBlockReceiptsName, block_key);
     SILK_TRACE << "read_raw_receipts data: " << silkworm::to_hex(data);
     if (data.empty()) {
-        co_return std::nullopt;
+        co_return co_await read_frozen_raw_receipts(tx, block_number);
     }
 
     Receipts receipts{};
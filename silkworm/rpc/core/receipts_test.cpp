@@ -28,6 +28,7 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/db/kv/api/endpoint/key_value.hpp>
 #include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/mock_chain_storage.hpp>
 #include <silkworm/db/test_util/mock_cursor.hpp>
 #include <silkworm/db/test_util/mock_transaction.hpp>
 #include <silkworm/infra/test_util/log.hpp>
@@ -40,6 +41,7 @@ using testing::_;
 using testing::InSequence;
 using testing::Invoke;
 using testing::InvokeWithoutArgs;
+using testing::Return;
 using testing::Unused;
 
 static silkworm::Bytes kNumber{*silkworm::from_hex("00000000003D0900")};
@@ -58,6 +60,14 @@ static silkworm::Bytes kHeader{*silkworm::from_hex(
     "00000000000000000000000000000000000000000000880000000000000000")};
 static silkworm::Bytes kBody{*silkworm::from_hex("c68369e45a03c0")};
 
+static void expect_frozen_receipts(db::test_util::MockTransaction& transaction, std::optional<snapshots::BlockReceiptsForStorage> frozen_receipts) {
+    auto chain_storage = std::make_shared<db::test_util::MockChainStorage>();
+    EXPECT_CALL(transaction, create_storage()).WillOnce(Return(chain_storage));
+    EXPECT_CALL(*chain_storage, read_frozen_receipts(_)).WillOnce(InvokeWithoutArgs([=]() -> Task<std::optional<snapshots::BlockReceiptsForStorage>> {
+        co_return frozen_receipts;
+    }));
+}
+
 TEST_CASE("read_raw_receipts") {
     silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
     WorkerPool pool{1};
@@ -66,10 +76,26 @@ TEST_CASE("read_raw_receipts") {
     SECTION("null receipts") {
         const uint64_t block_number{0};
         EXPECT_CALL(transaction, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> { co_return silkworm::Bytes{}; }));
+        expect_frozen_receipts(transaction, std::nullopt);
         auto result = boost::asio::co_spawn(pool, read_raw_receipts(transaction, block_number), boost::asio::use_future);
         CHECK(!result.get().has_value());
     }
 
+    SECTION("frozen receipts") {
+        const uint64_t block_number{0};
+        EXPECT_CALL(transaction, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> { co_return silkworm::Bytes{}; }));
+        expect_frozen_receipts(transaction, snapshots::BlockReceiptsForStorage{
+                                                .receipts = *silkworm::from_hex("828400f6011a00016e5b8400f6011a0002dc76"),
+                                                .transaction_logs = {silkworm::Bytes{}, silkworm::Bytes{}},
+                                            });
+        auto result = boost::asio::co_spawn(pool, read_raw_receipts(transaction, block_number), boost::asio::use_future);
+        const auto receipts = result.get();
+        REQUIRE(receipts.has_value());
+        CHECK(receipts->size() == 2);
+        CHECK((*receipts)[0].cumulative_gas_used == 93787);
+        CHECK((*receipts)[1].cumulative_gas_used == 187510);
+    }
+
     SECTION("zero receipts") {
         const uint64_t block_number{0};
         EXPECT_CALL(transaction, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> { co_return *silkworm::from_hex("f6"); }));
@@ -228,6 +254,7 @@ TEST_CASE("read_receipts") {
     SECTION("null receipts without data") {
         const silkworm::BlockWithHash block_with_hash{};
         EXPECT_CALL(transaction, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> { co_return silkworm::Bytes{}; }));
+        expect_frozen_receipts(transaction, std::nullopt);
         auto result = boost::asio::co_spawn(pool, read_receipts(transaction, block_with_hash), boost::asio::use_future);
         const auto receipts = result.get();
         CHECK(!receipts.has_value());
@@ -267,6 +294,7 @@ TEST_CASE("read_receipts") {
         const std::shared_ptr<silkworm::BlockWithHash> bwh = result.get();
 
         EXPECT_CALL(transaction, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> { co_return silkworm::Bytes{}; }));
+        expect_frozen_receipts(transaction, std::nullopt);
         auto result1 = boost::asio::co_spawn(pool, read_receipts(transaction, *bwh), boost::asio::use_future);
 #ifdef SILKWORM_SANITIZE  // Avoid comparison against exception message: it triggers a TSAN data race seemingly related to libstdc++ string implementation
         CHECK_THROWS_AS(result1.get(), std::runtime_error);
@@ -30,6 +30,8 @@
 
 #include <silkworm/db/access_layer.hpp>
 #include <silkworm/db/kv/api/direct_client.hpp>
+#include <silkworm/db/kv/api/historical_state_cache.hpp>
+#include <silkworm/db/kv/api/sharded_state_cache.hpp>
 #include <silkworm/db/kv/grpc/client/remote_client.hpp>
 #include <silkworm/db/snapshot_bundle_factory_impl.hpp>
 #include <silkworm/infra/common/ensure.hpp>
@@ -279,6 +281,7 @@ void Daemon::add_private_services() {
         auto& grpc_context{*context.grpc_context()};
 
         auto* state_cache{must_use_shared_service<db::kv::api::StateCache>(io_context)};
+        auto* historical_state_cache{use_shared_service<db::kv::api::HistoricalStateCache>(io_context)};
 
         auto backend{std::make_unique<rpc::ethbackend::RemoteBackEnd>(io_context, grpc_channel, grpc_context)};
         auto tx_pool{std::make_unique<txpool::TransactionPool>(io_context, grpc_channel, grpc_context)};
@@ -287,7 +290,8 @@ void Daemon::add_private_services() {
         if (chaindata_env_) {
             database = std::make_unique<ethdb::file::LocalDatabase>(state_cache, *chaindata_env_);
         } else {
-            database = std::make_unique<ethdb::kv::RemoteDatabase>(backend.get(), state_cache, grpc_context, grpc_channel);
+            database = std::make_unique<ethdb::kv::RemoteDatabase>(backend.get(), state_cache, grpc_context, grpc_channel,
+                                                                   historical_state_cache);
         }
 
         add_private_service<ethdb::Database>(io_context, std::move(database));
@@ -301,7 +305,18 @@ void Daemon::add_shared_services() {
     // Create the unique block cache to be shared among the execution contexts
     auto block_cache = std::make_shared<BlockCache>();
     // Create the unique state cache to be shared among the execution contexts
-    auto state_cache = std::make_shared<db::kv::api::CoherentStateCache>();
+    std::shared_ptr<db::kv::api::StateCache> state_cache;
+    if (settings_.sharded_state_cache) {
+        state_cache = std::make_shared<db::kv::api::ShardedStateCache>();
+    } else {
+        state_cache = std::make_shared<db::kv::api::CoherentStateCache>();
+    }
+    // Create the unique historical state cache (if enabled) to be shared among the execution contexts
+    std::shared_ptr<db::kv::api::HistoricalStateCache> historical_state_cache;
+    if (settings_.historical_state_cache_size > 0) {
+        historical_state_cache = std::make_shared<db::kv::api::HistoricalStateCache>(
+            db::kv::api::HistoricalCacheConfig{.max_entries = settings_.historical_state_cache_size});
+    }
     // Create the unique filter storage to be shared among the execution contexts
     auto filter_storage = std::make_shared<FilterStorage>(context_pool_.num_contexts() * kDefaultFilterStorageSize);
 
@@ -313,7 +328,10 @@ void Daemon::add_shared_services() {
         auto engine{std::make_shared<engine::RemoteExecutionEngine>(settings_.private_api_addr, *context.grpc_context())};
 
         add_shared_service(io_context, block_cache);
-        add_shared_service<db::kv::api::StateCache>(io_context, std::move(state_cache));
+        add_shared_service<db::kv::api::StateCache>(io_context, state_cache);
+        if (historical_state_cache) {
+            add_shared_service(io_context, historical_state_cache);
+        }
         add_shared_service(io_context, filter_storage);
         add_shared_service<engine::ExecutionEngine>(io_context, std::move(engine));
     }
@@ -29,16 +29,26 @@ using db::kv::grpc::client::RemoteTransaction;
 RemoteDatabase::RemoteDatabase(ethbackend::BackEnd* backend,
                                StateCache* state_cache,
                                agrpc::GrpcContext& grpc_context,
-                               const std::shared_ptr<grpc::Channel>& channel)
-    : backend_{backend}, state_cache_{state_cache}, grpc_context_{grpc_context}, stub_{remote::KV::NewStub(channel)} {
+                               const std::shared_ptr<grpc::Channel>& channel,
+                               HistoricalStateCache* historical_state_cache)
+    : backend_{backend},
+      state_cache_{state_cache},
+      grpc_context_{grpc_context},
+      historical_state_cache_{historical_state_cache},
+      stub_{remote::KV::NewStub(channel)} {
     SILK_TRACE << "RemoteDatabase::ctor " << this;
 }
 
 RemoteDatabase::RemoteDatabase(ethbackend::BackEnd* backend,
                                StateCache* state_cache,
                                agrpc::GrpcContext& grpc_context,
-                               std::unique_ptr<remote::KV::StubInterface>&& stub)
-    : backend_{backend}, state_cache_{state_cache}, grpc_context_{grpc_context}, stub_(std::move(stub)) {
+                               std::unique_ptr<remote::KV::StubInterface>&& stub,
+                               HistoricalStateCache* historical_state_cache)
+    : backend_{backend},
+      state_cache_{state_cache},
+      grpc_context_{grpc_context},
+      historical_state_cache_{historical_state_cache},
+      stub_(std::move(stub)) {
     SILK_TRACE << "RemoteDatabase::ctor " << this;
 }
 
@@ -52,7 +62,8 @@ Task<std::unique_ptr<db::kv::api::Transaction>> RemoteDatabase::begin() {
                                                    grpc_context_,
                                                    state_cache_,
                                                    block_provider(backend_),
-                                                   block_number_from_txn_hash_provider(backend_));
+                                                   block_number_from_txn_hash_provider(backend_),
+                                                   historical_state_cache_);
     co_await txn->open();
     SILK_TRACE << "RemoteDatabase::begin " << this << " txn: " << txn.get() << " end";
     co_return txn;
@@ -22,6 +22,7 @@
 #include <agrpc/grpc_context.hpp>
 #include <grpcpp/grpcpp.h>
 
+#include <silkworm/db/kv/api/historical_state_cache.hpp>
 #include <silkworm/db/kv/api/state_cache.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
@@ -30,6 +31,7 @@
 
 namespace silkworm::rpc::ethdb::kv {
 
+using db::kv::api::HistoricalStateCache;
 using db::kv::api::StateCache;
 
 class RemoteDatabase : public Database {
@@ -37,11 +39,13 @@ class RemoteDatabase : public Database {
     RemoteDatabase(ethbackend::BackEnd* backend,
                    StateCache* state_cache,
                    agrpc::GrpcContext& grpc_context,
-                   const std::shared_ptr<grpc::Channel>& channel);
+                   const std::shared_ptr<grpc::Channel>& channel,
+                   HistoricalStateCache* historical_state_cache = nullptr);
     RemoteDatabase(ethbackend::BackEnd* backend,
                    StateCache* state_cache,
                    agrpc::GrpcContext& grpc_context,
-                   std::unique_ptr<remote::KV::StubInterface>&& stub);
+                   std::unique_ptr<remote::KV::StubInterface>&& stub,
+                   HistoricalStateCache* historical_state_cache = nullptr);
     ~RemoteDatabase() override;
 
     RemoteDatabase(const RemoteDatabase&) = delete;
@@ -53,6 +57,7 @@ class RemoteDatabase : public Database {
     ethbackend::BackEnd* backend_;
     StateCache* state_cache_;
     agrpc::GrpcContext& grpc_context_;
+    HistoricalStateCache* historical_state_cache_;
     std::unique_ptr<::remote::KV::StubInterface> stub_;
 };
 
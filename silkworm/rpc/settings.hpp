@@ -49,6 +49,8 @@ struct DaemonSettings {
     bool use_websocket{false};
     bool ws_compression{false};
     bool http_compression{true};
+    bool sharded_state_cache{false};
+    std::size_t historical_state_cache_size{kDefaultHistoricalStateCacheSize};
 };
 
 }  // namespace silkworm::rpc
@@ -20,6 +20,8 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -56,7 +58,15 @@ class ChannelForTest : public StreamWriter {
     Task<void> open_stream() override { co_return; }
     size_t get_capacity() const noexcept override { return kDefaultCapacity; }
     Task<void> close_stream() override { co_return; }
-    Task<std::size_t> write(std::string_view /* content */, bool /* last */) override { co_return 0; }
+    Task<std::size_t> write(std::string_view content, bool /* last */) override {
+        content_.append(content);
+        co_return content.size();
+    }
+
+    const std::string& content() const { return content_; }
+
+  private:
+    std::string content_;
 };
 
 class RequestHandler_ForTest : public json_rpc::RequestHandler {
@@ -64,10 +74,14 @@ class RequestHandler_ForTest : public json_rpc::RequestHandler {
     RequestHandler_ForTest(ChannelForTest* channel,
                            commands::RpcApi& rpc_api,
                            const commands::RpcApiTable& rpc_api_table)
-        : json_rpc::RequestHandler(channel, rpc_api, rpc_api_table) {}
+        : json_rpc::RequestHandler(channel, rpc_api, rpc_api_table), channel_{channel} {}
 
     Task<void> request_and_create_reply(const nlohmann::json& request_json, std::string& response) {
-        co_await RequestHandler::handle_request_and_create_reply(request_json, response);
+        const bool reply_created = co_await RequestHandler::handle_request_and_create_reply(request_json, response);
+        // Streaming handlers write their reply into the channel
+        if (!reply_created) {
+            response = channel_->content();
+        }
     }
 
     Task<void> handle_request(const std::string& request, std::string& response) {
@@ -78,6 +92,7 @@ class RequestHandler_ForTest : public json_rpc::RequestHandler {
     }
 
   private:
+    ChannelForTest* channel_;
     inline static const std::vector<std::string> allowed_origins;
 };
 